@@ -589,6 +589,25 @@ public:
             sfl::dtl::throw_length_error("sfl::compact_vector::emplace");
         }
 
+        if
+        (
+            pos == cend() &&
+            std::is_nothrow_constructible<value_type, Args&&...>::value &&
+            expand_storage(new_size)
+        )
+        {
+            sfl::dtl::construct_at_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                std::forward<Args>(args)...
+            );
+
+            ++data_.last_;
+
+            return begin() + offset;
+        }
+
         pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_size);
         pointer new_last  = new_first;
 
@@ -608,7 +627,7 @@ public:
 
             new_last = nullptr;
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -618,7 +637,7 @@ public:
 
             ++new_last;
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_ + offset,
@@ -656,7 +675,7 @@ public:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -802,7 +821,7 @@ public:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -810,7 +829,7 @@ public:
                 new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_ + offset2,
@@ -837,10 +856,24 @@ public:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
+            data_.first_ + offset1
+        );
+
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            data_.first_ + offset1,
+            data_.first_ + offset2
+        );
+
+        sfl::dtl::destroy_relocated_a
+        (
+            data_.ref_to_alloc(),
+            data_.first_ + offset2,
             data_.last_
         );
 
@@ -869,6 +902,23 @@ public:
             sfl::dtl::throw_length_error("sfl::compact_vector::resize");
         }
 
+        if
+        (
+            n > size() &&
+            std::is_nothrow_default_constructible<value_type>::value &&
+            (expand_storage(n) || reallocate_storage(n))
+        )
+        {
+            data_.last_ = sfl::dtl::uninitialized_default_construct_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                n - size()
+            );
+
+            return;
+        }
+
         pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
         pointer new_last  = new_first;
 
@@ -876,24 +926,31 @@ public:
         {
             if (n > size())
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                // New elements are constructed before relocation
+                // because relocation cannot be undone.
+
+                sfl::dtl::uninitialized_default_construct_n_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.last_,
-                    new_first
+                    new_first + size(),
+                    n - size()
                 );
 
-                new_last = sfl::dtl::uninitialized_default_construct_n_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    new_last,
-                    n - size()
+                    data_.first_,
+                    data_.last_,
+                    new_first
                 );
+
+                new_last += n - size();
             }
             else if (n < size())
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -904,12 +961,24 @@ public:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first + size(),
+                    new_first + n
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -921,10 +990,20 @@ public:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        // Elements in range [first_, mid) are relocated.
+        const pointer mid = (n < size()) ? data_.first_ + n : data_.last_;
+
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
+            mid
+        );
+
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            mid,
             data_.last_
         );
 
@@ -951,6 +1030,26 @@ public:
             sfl::dtl::throw_length_error("sfl::compact_vector::resize");
         }
 
+        // `value` can be a reference to an element in this container,
+        // so storage can be resized only in place.
+        if
+        (
+            n > size() &&
+            std::is_nothrow_copy_constructible<value_type>::value &&
+            expand_storage(n)
+        )
+        {
+            data_.last_ = sfl::dtl::uninitialized_fill_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                n - size(),
+                value
+            );
+
+            return;
+        }
+
         pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
         pointer new_last  = new_first;
 
@@ -958,25 +1057,32 @@ public:
         {
             if (n > size())
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                // New elements are constructed before relocation
+                // because relocation cannot be undone.
+
+                sfl::dtl::uninitialized_fill_n_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.last_,
-                    new_first
+                    new_first + size(),
+                    n - size(),
+                    value
                 );
 
-                new_last = sfl::dtl::uninitialized_fill_n_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    new_last,
-                    n - size(),
-                    value
+                    data_.first_,
+                    data_.last_,
+                    new_first
                 );
+
+                new_last += n - size();
             }
             else if (n < size())
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -987,12 +1093,24 @@ public:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first + size(),
+                    new_first + n
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -1004,10 +1122,20 @@ public:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        // Elements in range [first_, mid) are relocated.
+        const pointer mid = (n < size()) ? data_.first_ + n : data_.last_;
+
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
+            mid
+        );
+
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            mid,
             data_.last_
         );
 
@@ -1053,6 +1181,50 @@ public:
 
 private:
 
+    //
+    // Tries to resize storage to `new_size` elements in place, i.e. without
+    // moving elements. Returns true on success. On success the caller must
+    // construct new elements without throwing exceptions.
+    //
+    bool expand_storage(size_type new_size)
+    {
+        return sfl::dtl::try_expand
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            size(),
+            new_size
+        );
+    }
+
+    //
+    // Tries to resize storage to `new_size` elements by allocator's member
+    // function `reallocate`. Storage can be moved to a new location, but only
+    // if elements are trivially relocatable. Returns true on success. On
+    // success the caller must construct new elements without throwing
+    // exceptions.
+    //
+    bool reallocate_storage(size_type new_size)
+    {
+        const size_type size = this->size();
+
+        const pointer new_first = sfl::dtl::try_reallocate
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            size,
+            new_size
+        );
+
+        if (new_first != nullptr)
+        {
+            data_.first_ = new_first;
+            data_.last_  = new_first + size;
+            return true;
+        }
+        return false;
+    }
+
     void initialize_default_n(size_type n)
     {
         if (n > max_size())
@@ -1493,6 +1665,24 @@ private:
                 );
             }
 
+            if
+            (
+                pos == cend() &&
+                std::is_nothrow_copy_constructible<value_type>::value &&
+                expand_storage(new_size)
+            )
+            {
+                data_.last_ = sfl::dtl::uninitialized_fill_n_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.last_,
+                    n,
+                    value
+                );
+
+                return begin() + offset;
+            }
+
             pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_size);
             pointer new_last  = new_first;
 
@@ -1512,7 +1702,7 @@ private:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1522,7 +1712,7 @@ private:
 
                 new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -1561,7 +1751,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1625,23 +1815,30 @@ private:
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                // Elements are relocated after all new elements are
+                // constructed. Relocation cannot be undone.
+
+                sfl::dtl::uninitialized_copy_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.first_ + offset,
-                    new_first
+                    first,
+                    last,
+                    new_first + offset
                 );
 
-                new_last = sfl::dtl::uninitialized_copy_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    first,
-                    last,
-                    new_last
+                    data_.first_,
+                    data_.first_ + offset,
+                    new_first
                 );
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last += new_size - size();
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -1651,12 +1848,24 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::destroy_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_last
-                );
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first + offset,
+                        new_size - size()
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
 
                 sfl::dtl::deallocate
                 (
@@ -1668,7 +1877,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
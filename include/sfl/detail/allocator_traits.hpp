@@ -125,6 +125,44 @@ private:
         using type = decltype(test<Alloc>(nullptr));
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+
+    template <typename Alloc, typename Pointer, typename SizeType>
+    struct has_try_expand
+    {
+    private:
+        template <typename Alloc2, typename Pointer2, typename SizeType2,
+                  sfl::dtl::void_t<decltype(std::declval<Alloc2&>().try_expand(std::declval<Pointer2>(),
+                                                                               std::declval<SizeType2>(),
+                                                                               std::declval<SizeType2>()))>* = nullptr>
+        static std::true_type test(int);
+
+        template <typename Alloc2, typename Pointer2, typename SizeType2>
+        static std::false_type test(...);
+
+    public:
+        using type = decltype(test<Alloc, Pointer, SizeType>(0));
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    template <typename Alloc, typename Pointer, typename SizeType>
+    struct has_reallocate
+    {
+    private:
+        template <typename Alloc2, typename Pointer2, typename SizeType2,
+                  sfl::dtl::void_t<decltype(std::declval<Alloc2&>().reallocate(std::declval<Pointer2>(),
+                                                                               std::declval<SizeType2>(),
+                                                                               std::declval<SizeType2>()))>* = nullptr>
+        static std::true_type test(int);
+
+        template <typename Alloc2, typename Pointer2, typename SizeType2>
+        static std::false_type test(...);
+
+    public:
+        using type = decltype(test<Alloc, Pointer, SizeType>(0));
+    };
+
 public:
 
     using allocator_type = Allocator;
@@ -220,6 +258,47 @@ public:
         return priv_is_storage_unpropagable(a, p, is_partially_propagable());
     }
 
+    //
+    // Tries to resize storage pointed by `p` from `n` to `new_n` elements
+    // in place. Returns true on success. On failure storage is unchanged.
+    //
+    // Allocator can support this operation by member function
+    // `bool try_expand(pointer p, size_type n, size_type new_n)`.
+    // Otherwise this function always returns false.
+    //
+    SFL_NODISCARD
+    static bool try_expand(Allocator& a, pointer p, size_type n, size_type new_n)
+    {
+        return priv_try_expand(a, p, n, new_n, typename has_try_expand<Allocator, pointer, size_type>::type());
+    }
+
+    //
+    // Resizes storage pointed by `p` from `n` to `new_n` elements and returns
+    // pointer to the resized storage. Bytes of the first `min(n, new_n)`
+    // elements are preserved, but storage can be moved to a new location
+    // (as by `std::realloc`). On failure it throws an exception and storage
+    // is unchanged.
+    //
+    // Allocator can support this operation by member function
+    // `pointer reallocate(pointer p, size_type n, size_type new_n)`.
+    // Otherwise (or if `value_type` is not trivially relocatable) this function
+    // always returns null pointer and storage is unchanged.
+    //
+    SFL_NODISCARD
+    static pointer try_reallocate(Allocator& a, pointer p, size_type n, size_type new_n)
+    {
+        return priv_try_reallocate
+        (
+            a, p, n, new_n,
+            std::integral_constant
+            <
+                bool,
+                has_reallocate<Allocator, pointer, size_type>::type::value &&
+                sfl::is_trivially_relocatable<value_type>::value
+            >()
+        );
+    }
+
 private:
 
     static pointer priv_allocate(Allocator& a, size_type n, const_void_pointer hint, std::true_type)
@@ -264,6 +343,28 @@ private:
         sfl::dtl::ignore_unused(a, p);
         return false;
     }
+
+    static bool priv_try_expand(Allocator& a, pointer p, size_type n, size_type new_n, std::true_type)
+    {
+        return a.try_expand(p, n, new_n);
+    }
+
+    static bool priv_try_expand(Allocator& a, pointer p, size_type n, size_type new_n, std::false_type)
+    {
+        sfl::dtl::ignore_unused(a, p, n, new_n);
+        return false;
+    }
+
+    static pointer priv_try_reallocate(Allocator& a, pointer p, size_type n, size_type new_n, std::true_type)
+    {
+        return a.reallocate(p, n, new_n);
+    }
+
+    static pointer priv_try_reallocate(Allocator& a, pointer p, size_type n, size_type new_n, std::false_type)
+    {
+        sfl::dtl::ignore_unused(a, p, n, new_n);
+        return nullptr;
+    }
 };
 
 } // namespace dtl
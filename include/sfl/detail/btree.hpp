@@ -0,0 +1,3756 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_BTREE_HPP_INCLUDED
+#define SFL_DETAIL_BTREE_HPP_INCLUDED
+
+#include <sfl/detail/allocator_traits.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/sorted_search.hpp>
+#include <sfl/detail/to_address.hpp>
+#include <sfl/detail/type_traits.hpp>
+#include <sfl/detail/uninitialized_memory_algorithms.hpp>
+
+#include <algorithm>    // copy, copy_backward, equal, lexicographical_compare
+#include <cstddef>      // size_t, ptrdiff_t
+#include <cstdint>      // uint8_t
+#include <iterator>     // distance, bidirectional_iterator_tag, reverse_iterator
+#include <memory>       // addressof, pointer_traits
+#include <type_traits>  // is_xxxxx
+#include <utility>      // forward, move, move_if_noexcept, pair
+
+#ifdef SFL_TEST_BTREE
+template <int>
+void test_btree();
+#endif
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Returns the number of slots of size `slot_size` that fit into `bytes`,
+// clamped to [4, 255]. Slot indices must fit into one byte, and nodes must
+// not become empty when they are split.
+//
+constexpr std::size_t btree_node_capacity(std::size_t bytes, std::size_t slot_size) noexcept
+{
+    return bytes / slot_size < 4 ? 4 : (bytes / slot_size > 255 ? 255 : bytes / slot_size);
+}
+
+//
+// Node of B+tree. Leaf nodes hold values, inner nodes hold separator keys and
+// pointers to children. Both kinds of nodes have the same type and size, so
+// node allocator allocates nodes of single type.
+//
+// Slots of a node are not kept sorted. Array `order_` maps the rank of an
+// element to its slot, and the tail of `order_` lists free slots. Insertion
+// and removal shift only bytes in `order_`, and values are never moved within
+// a node. Inner nodes have one spare key slot, so a separator can be replaced
+// by constructing the new one before the old one is destroyed.
+//
+template <typename Key, typename Value, typename VoidPointer>
+struct btree_node
+{
+    using node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<btree_node>;
+
+    static constexpr std::size_t node_bytes = 512;
+
+    static constexpr std::size_t leaf_capacity =
+        btree_node_capacity(node_bytes, sizeof(Value) + 1);
+
+    static constexpr std::size_t inner_capacity =
+        btree_node_capacity(node_bytes, sizeof(Key) + sizeof(node_pointer) + 1) - 1;
+
+    static constexpr std::size_t min_leaf_size = leaf_capacity / 2;
+
+    static constexpr std::size_t min_inner_size = (inner_capacity - 1) / 2;
+
+    static constexpr std::size_t order_size =
+        leaf_capacity > inner_capacity + 1 ? leaf_capacity : inner_capacity + 1;
+
+    struct inner_data
+    {
+        Key keys_[inner_capacity + 1];
+        node_pointer children_[inner_capacity + 1];
+    };
+
+    node_pointer parent_;
+    node_pointer prev_;         // Previous leaf; unused in inner nodes.
+    node_pointer next_;         // Next leaf; unused in inner nodes.
+    std::uint8_t size_;         // Number of values or number of keys.
+    bool leaf_;
+    std::uint8_t order_[order_size];
+
+    union
+    {
+        Value values_[leaf_capacity];
+        inner_data inner_;
+    };
+
+    btree_node() noexcept
+    {}
+
+    btree_node(const btree_node& other) = delete;
+
+    btree_node(btree_node&& other) = delete;
+
+    btree_node& operator=(const btree_node& other) = delete;
+
+    btree_node& operator=(btree_node&& other) = delete;
+
+    #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+    ~btree_node()
+    {}
+    #else
+    ~btree_node() noexcept
+    {}
+    #endif
+
+    static constexpr std::size_t max_leaves(std::size_t n) noexcept
+    {
+        return n == 0 ? 0 : (n / min_leaf_size > 1 ? n / min_leaf_size : 1);
+    }
+
+    static constexpr std::size_t max_inner_nodes(std::size_t children) noexcept
+    {
+        return children <= 1
+            ? 0
+            : (children / (min_inner_size + 1) > 1 ? children / (min_inner_size + 1) : 1)
+                + max_inner_nodes(children / (min_inner_size + 1) > 1 ? children / (min_inner_size + 1) : 1);
+    }
+
+    //
+    // Returns the maximum number of nodes needed by a tree that holds up to
+    // `n` elements, including one spare node needed by element-wise swap.
+    //
+    static constexpr std::size_t max_nodes(std::size_t n) noexcept
+    {
+        return n == 0 ? 0 : max_leaves(n) + max_inner_nodes(max_leaves(n)) + 1;
+    }
+};
+
+//
+// Node handle returned by `extract` and accepted by node `insert`.
+//
+// Values do not live in separate nodes, so the handle holds the extracted
+// value.
+//
+template <typename Key, typename Value, typename KeyOfValue, typename Allocator>
+class btree_node_handle
+{
+    template <typename, typename, typename, typename, typename, typename>
+    friend class btree;
+
+public:
+
+    using key_type       = Key;
+    using value_type     = Value;
+    using allocator_type = Allocator;
+
+private:
+
+    bool has_value_;
+
+    union
+    {
+        value_type value_;
+    };
+
+    explicit btree_node_handle(value_type& value)
+        : has_value_(true)
+    {
+        sfl::dtl::construct_at(std::addressof(value_), std::move(value));
+    }
+
+public:
+
+    btree_node_handle() noexcept
+        : has_value_(false)
+    {}
+
+    btree_node_handle(const btree_node_handle& other) = delete;
+
+    btree_node_handle(btree_node_handle&& other)
+        noexcept(std::is_nothrow_move_constructible<value_type>::value)
+        : has_value_(false)
+    {
+        if (other.has_value_)
+        {
+            sfl::dtl::construct_at(std::addressof(value_), std::move(other.value_));
+            has_value_ = true;
+            other.clear();
+        }
+    }
+
+    btree_node_handle& operator=(const btree_node_handle& other) = delete;
+
+    btree_node_handle& operator=(btree_node_handle&& other)
+        noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            if (other.has_value_)
+            {
+                sfl::dtl::construct_at(std::addressof(value_), std::move(other.value_));
+                has_value_ = true;
+                other.clear();
+            }
+        }
+
+        return *this;
+    }
+
+    ~btree_node_handle()
+    {
+        clear();
+    }
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return !has_value_;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return has_value_;
+    }
+
+    SFL_NODISCARD
+    value_type& value() const noexcept
+    {
+        SFL_ASSERT(!empty());
+        return const_cast<value_type&>(value_);
+    }
+
+    SFL_NODISCARD
+    key_type& key() const noexcept
+    {
+        return const_cast<key_type&>(KeyOfValue()(value()));
+    }
+
+    template <typename V = value_type>
+    SFL_NODISCARD
+    typename V::second_type& mapped() const noexcept
+    {
+        return value().second;
+    }
+
+    void swap(btree_node_handle& other)
+        noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    {
+        btree_node_handle temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    friend void swap(btree_node_handle& x, btree_node_handle& y)
+        noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    {
+        x.swap(y);
+    }
+
+private:
+
+    void clear() noexcept
+    {
+        if (has_value_)
+        {
+            sfl::dtl::destroy_at(std::addressof(value_));
+            has_value_ = false;
+        }
+    }
+};
+
+template <typename Iterator, typename NodeHandle>
+struct btree_insert_return_type
+{
+    Iterator   position;
+    bool       inserted;
+    NodeHandle node;
+};
+
+//
+// B+tree. Values are stored in leaves, which are linked into a list in key
+// order. Inner nodes hold copies of keys that separate their children. Every
+// node except the root is at least half full. Only nodes on the right spine
+// may be left underfull, by `split` and by failed `join`, and they are fixed
+// before the next node is allocated.
+//
+// Nodes are large (about 512 bytes), so a lookup touches a few nodes and
+// iteration walks contiguous memory. Values are moved between nodes when
+// nodes are split, merged or rebalanced. Hence insertion and erasure
+// invalidate iterators, pointers and references to elements.
+//
+// Values are relocated by `std::move_if_noexcept`, and every step that
+// relocates values or keys constructs all destinations before it destroys
+// the sources, so a throwing constructor leaves the tree unchanged.
+//
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator,
+           typename UpperLevelContainer >
+class btree
+{
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, Value>::value,
+        "Allocator::value_type must be Value."
+    );
+
+    #ifdef SFL_TEST_BTREE
+    template <int>
+    friend void ::test_btree();
+    #endif
+
+    friend UpperLevelContainer;
+
+    template <typename, typename, typename, typename, typename, typename>
+    friend class btree;
+
+public:
+
+    using allocator_type  = Allocator;
+    using key_type        = Key;
+    using value_type      = Value;
+    using size_type       = typename sfl::dtl::allocator_traits<allocator_type>::size_type;
+    using difference_type = typename sfl::dtl::allocator_traits<allocator_type>::difference_type;
+    using key_compare     = KeyCompare;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = typename sfl::dtl::allocator_traits<allocator_type>::pointer;
+    using const_pointer   = typename sfl::dtl::allocator_traits<allocator_type>::const_pointer;
+
+private:
+
+    using void_pointer = typename sfl::dtl::allocator_traits<allocator_type>::void_pointer;
+
+    using node_type = btree_node<key_type, value_type, void_pointer>;
+
+    using node_allocator_type = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<node_type>;
+
+    using node_pointer = typename node_type::node_pointer;
+
+    static constexpr std::size_t leaf_capacity = node_type::leaf_capacity;
+
+    static constexpr std::size_t inner_capacity = node_type::inner_capacity;
+
+    static constexpr std::size_t min_leaf_size = node_type::min_leaf_size;
+
+    static constexpr std::size_t min_inner_size = node_type::min_inner_size;
+
+public:
+
+    class iterator
+    {
+        #ifdef SFL_TEST_BTREE
+        template <int>
+        friend void ::test_btree();
+        #endif
+
+        friend class btree;
+
+        friend UpperLevelContainer;
+
+    public:
+
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = Value;
+        using pointer           = Value*;
+        using reference         = Value&;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+    private:
+
+        node_pointer node_;
+
+        std::size_t index_;
+
+    private:
+
+        explicit iterator(node_pointer x, std::size_t i) noexcept
+            : node_(x)
+            , index_(i)
+        {}
+
+    public:
+
+        // Default constructor
+        iterator() noexcept
+            : node_()
+            , index_(0)
+        {}
+
+        // Copy constructor
+        iterator(const iterator& other) noexcept
+            : node_(other.node_)
+            , index_(other.index_)
+        {}
+
+        // Copy assignment operator
+        iterator& operator=(const iterator& other) noexcept
+        {
+            node_ = other.node_;
+            index_ = other.index_;
+            return *this;
+        }
+
+        SFL_NODISCARD
+        reference operator*() const noexcept
+        {
+            return btree::value(node_, index_);
+        }
+
+        SFL_NODISCARD
+        pointer operator->() const noexcept
+        {
+            return std::addressof(btree::value(node_, index_));
+        }
+
+        iterator& operator++() noexcept
+        {
+            btree::next(node_, index_);
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            btree::next(node_, index_);
+            return temp;
+        }
+
+        iterator& operator--() noexcept
+        {
+            btree::prev(node_, index_);
+            return *this;
+        }
+
+        iterator operator--(int) noexcept
+        {
+            auto temp = *this;
+            btree::prev(node_, index_);
+            return temp;
+        }
+
+        SFL_NODISCARD
+        friend bool operator==(const iterator& x, const iterator& y) noexcept
+        {
+            return x.node_ == y.node_ && x.index_ == y.index_;
+        }
+
+        SFL_NODISCARD
+        friend bool operator!=(const iterator& x, const iterator& y) noexcept
+        {
+            return !(x == y);
+        }
+    };
+
+    class const_iterator
+    {
+        #ifdef SFL_TEST_BTREE
+        template <int>
+        friend void ::test_btree();
+        #endif
+
+        friend class btree;
+
+        friend UpperLevelContainer;
+
+    public:
+
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = Value;
+        using pointer           = const Value*;
+        using reference         = const Value&;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+    private:
+
+        node_pointer node_;
+
+        std::size_t index_;
+
+    private:
+
+        explicit const_iterator(node_pointer x, std::size_t i) noexcept
+            : node_(x)
+            , index_(i)
+        {}
+
+    public:
+
+        // Default constructor
+        const_iterator() noexcept
+            : node_()
+            , index_(0)
+        {}
+
+        // Copy constructor
+        const_iterator(const const_iterator& other) noexcept
+            : node_(other.node_)
+            , index_(other.index_)
+        {}
+
+        // Converting constructor (from iterator to const_iterator)
+        const_iterator(const iterator& other) noexcept
+            : node_(other.node_)
+            , index_(other.index_)
+        {}
+
+        // Copy assignment operator
+        const_iterator& operator=(const const_iterator& other) noexcept
+        {
+            node_ = other.node_;
+            index_ = other.index_;
+            return *this;
+        }
+
+        SFL_NODISCARD
+        reference operator*() const noexcept
+        {
+            return btree::value(node_, index_);
+        }
+
+        SFL_NODISCARD
+        pointer operator->() const noexcept
+        {
+            return std::addressof(btree::value(node_, index_));
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            btree::next(node_, index_);
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            btree::next(node_, index_);
+            return temp;
+        }
+
+        const_iterator& operator--() noexcept
+        {
+            btree::prev(node_, index_);
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept
+        {
+            auto temp = *this;
+            btree::prev(node_, index_);
+            return temp;
+        }
+
+        SFL_NODISCARD
+        friend bool operator==(const const_iterator& x, const const_iterator& y) noexcept
+        {
+            return x.node_ == y.node_ && x.index_ == y.index_;
+        }
+
+        SFL_NODISCARD
+        friend bool operator!=(const const_iterator& x, const const_iterator& y) noexcept
+        {
+            return !(x == y);
+        }
+    };
+
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    using node_handle = btree_node_handle<Key, Value, KeyOfValue, Allocator>;
+
+    using insert_return_type = btree_insert_return_type<iterator, node_handle>;
+
+private:
+
+    class data_base
+    {
+    public:
+
+        node_pointer root_;
+
+        node_pointer first_;    // Leftmost leaf
+
+        node_pointer last_;     // Rightmost leaf
+
+        size_type size_;
+
+        void reset() noexcept
+        {
+            root_  = nullptr;
+            first_ = nullptr;
+            last_  = nullptr;
+            size_  = 0;
+        }
+
+        data_base() noexcept
+        {
+            reset();
+        }
+
+        data_base(const data_base& other) = delete;
+
+        data_base(data_base&& other) = delete;
+
+        data_base& operator=(const data_base& other) = delete;
+
+        data_base& operator=(data_base&& other) = delete;
+
+        ~data_base() noexcept
+        {};
+    };
+
+    class data : public data_base, public node_allocator_type, public key_compare
+    {
+    public:
+
+        data() noexcept
+        (
+            std::is_nothrow_default_constructible<node_allocator_type>::value &&
+            std::is_nothrow_default_constructible<key_compare>::value
+        )
+            : node_allocator_type()
+            , key_compare()
+        {}
+
+        template <typename Allocator2>
+        data(const Allocator2& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<node_allocator_type>::value &&
+            std::is_nothrow_default_constructible<key_compare>::value
+        )
+            : node_allocator_type(alloc)
+            , key_compare()
+        {}
+
+        data(const key_compare& comp) noexcept
+        (
+            std::is_nothrow_default_constructible<node_allocator_type>::value &&
+            std::is_nothrow_copy_constructible<key_compare>::value
+        )
+            : node_allocator_type()
+            , key_compare(comp)
+        {}
+
+        template <typename Allocator2>
+        data(const key_compare& comp, const Allocator2& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<node_allocator_type>::value &&
+            std::is_nothrow_copy_constructible<key_compare>::value
+        )
+            : node_allocator_type(alloc)
+            , key_compare(comp)
+        {}
+
+        template <typename Allocator2>
+        data(key_compare&& comp, const Allocator2& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<node_allocator_type>::value &&
+            std::is_nothrow_move_constructible<key_compare>::value
+        )
+            : node_allocator_type(alloc)
+            , key_compare(std::move(comp))
+        {}
+
+        template <typename Allocator2>
+        data(key_compare&& comp, Allocator2&& alloc) noexcept
+        (
+            std::is_nothrow_move_constructible<node_allocator_type>::value &&
+            std::is_nothrow_move_constructible<key_compare>::value
+        )
+            : node_allocator_type(std::move(alloc))
+            , key_compare(std::move(comp))
+        {}
+    };
+
+    mutable data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    btree() noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<KeyCompare>::value
+    )
+    {}
+
+    explicit btree(const KeyCompare& comp) noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<KeyCompare>::value
+    )
+        : data_(comp)
+    {}
+
+    template <typename Allocator2>
+    explicit btree(const Allocator2& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<KeyCompare>::value
+    )
+        : data_(alloc)
+    {}
+
+    template <typename Allocator2>
+    explicit btree(const KeyCompare& comp, const Allocator2& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<KeyCompare>::value
+    )
+        : data_(comp, alloc)
+    {}
+
+    btree(const btree& other)
+        : data_
+        (
+            other.ref_to_comp(),
+            sfl::dtl::allocator_traits<node_allocator_type>::select_on_container_copy_construction(other.ref_to_node_alloc())
+        )
+    {
+        initialize_copy(other);
+    }
+
+    template <typename Allocator2>
+    btree(const btree& other, const Allocator2& alloc)
+        : data_(other.ref_to_comp(), alloc)
+    {
+        initialize_copy(other);
+    }
+
+    btree(btree&& other)
+        : data_
+        (
+            std::move(other.ref_to_comp()),
+            std::move(other.ref_to_node_alloc())
+        )
+    {
+        initialize_move(other);
+    }
+
+    template <typename Allocator2>
+    btree(btree&& other, const Allocator2& alloc)
+        : data_
+        (
+            std::move(other.ref_to_comp()),
+            alloc
+        )
+    {
+        initialize_move(other);
+    }
+
+    ~btree() noexcept
+    {
+        if (data_.root_ != nullptr)
+        {
+            clear(data_.root_);
+        }
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    btree& operator=(const btree& other)
+    {
+        assign_copy(other);
+        return *this;
+    }
+
+    btree& operator=(btree&& other)
+    {
+        assign_move(other);
+        return *this;
+    }
+
+    //
+    // Inserts elements from range [first, last) if the tree doesn't already
+    // contain an element with an equivalent key.
+    //
+    // If the tree is empty, the sorted prefix of the range is appended to
+    // full leaves in linear time. Remaining elements are inserted one by one.
+    //
+    template <typename InputIt, typename Sentinel>
+    void insert_range_unique(InputIt first, Sentinel last)
+    {
+        if (data_.root_ == nullptr)
+        {
+            first = initialize_sorted_prefix(std::move(first), last, std::true_type());
+        }
+
+        while (first != last)
+        {
+            insert_unique(*first);
+            ++first;
+        }
+    }
+
+    //
+    // Inserts all elements from range [first, last).
+    //
+    // If the tree is empty, the sorted prefix of the range is appended to
+    // full leaves in linear time. Remaining elements are inserted one by one.
+    //
+    template <typename InputIt, typename Sentinel>
+    void insert_range_equal(InputIt first, Sentinel last)
+    {
+        if (data_.root_ == nullptr)
+        {
+            first = initialize_sorted_prefix(std::move(first), last, std::false_type());
+        }
+
+        while (first != last)
+        {
+            insert_equal(*first);
+            ++first;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void assign_range_equal(InputIt first, InputIt last)
+    {
+        clear();
+        insert_range_equal(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void assign_range_unique(InputIt first, InputIt last)
+    {
+        clear();
+        insert_range_unique(first, last);
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    node_allocator_type& ref_to_node_alloc() noexcept
+    {
+        return data_;
+    }
+
+    SFL_NODISCARD
+    const node_allocator_type& ref_to_node_alloc() const noexcept
+    {
+        return data_;
+    }
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const
+    {
+        return allocator_type(ref_to_node_alloc());
+    }
+
+    //
+    // ---- KEY COMPARE -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_compare& ref_to_comp() noexcept
+    {
+        return data_;
+    }
+
+    SFL_NODISCARD
+    const key_compare& ref_to_comp() const noexcept
+    {
+        return data_;
+    }
+
+    SFL_NODISCARD
+    key_compare key_comp() const
+    {
+        return ref_to_comp();
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return iterator(data_.first_, 0);
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(data_.first_, 0);
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(data_.first_, 0);
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return iterator(data_.last_, end_index());
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return const_iterator(data_.last_, end_index());
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(data_.last_, end_index());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        // Every node holds at least one element.
+        return sfl::dtl::allocator_traits<node_allocator_type>::max_size(ref_to_node_alloc());
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        if (data_.root_ != nullptr)
+        {
+            clear(data_.root_);
+        }
+
+        data_.reset();
+    }
+
+    template <typename... Args>
+    iterator emplace_equal(Args&&... args)
+    {
+        value_type tmp(std::forward<Args>(args)...);
+        return emplace_equal_key(KeyOfValue()(tmp), std::move(tmp));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace_unique(Args&&... args)
+    {
+        value_type tmp(std::forward<Args>(args)...);
+        return emplace_unique_key(KeyOfValue()(tmp), std::move(tmp));
+    }
+
+    template <typename... Args>
+    iterator emplace_hint_equal(const_iterator hint, Args&&... args)
+    {
+        value_type tmp(std::forward<Args>(args)...);
+        return emplace_hint_equal_key(hint, KeyOfValue()(tmp), std::move(tmp));
+    }
+
+    template <typename... Args>
+    iterator emplace_hint_unique(const_iterator hint, Args&&... args)
+    {
+        value_type tmp(std::forward<Args>(args)...);
+        return emplace_hint_unique_key(hint, KeyOfValue()(tmp), std::move(tmp));
+    }
+
+    //
+    // Inserts element constructed from `args` whose key is equivalent to `k`.
+    // Element is constructed directly in the leaf, after its position has
+    // been found.
+    //
+    // If the leaf is full, element is constructed before nodes are split,
+    // because `k` and `args` could refer to elements relocated by a split.
+    //
+    template <typename K, typename... Args>
+    iterator emplace_equal_key(const K& k, Args&&... args)
+    {
+        if (data_.root_ == nullptr)
+        {
+            make_root();
+        }
+
+        node_pointer x = find_leaf_upper(k);
+
+        if (x->size_ < leaf_capacity)
+        {
+            return insert_value(x, leaf_upper_bound(x, k), std::forward<Args>(args)...);
+        }
+
+        value_type tmp(std::forward<Args>(args)...);
+
+        while (x->size_ == leaf_capacity)
+        {
+            split_for_insert(x);
+            x = find_leaf_upper(KeyOfValue()(tmp));
+        }
+
+        return insert_value(x, leaf_upper_bound(x, KeyOfValue()(tmp)), std::move(tmp));
+    }
+
+    //
+    // Inserts element constructed from `args` whose key is equivalent to `k`
+    // if the tree doesn't already contain an element with an equivalent key.
+    // Element is constructed directly in the leaf, after its position has
+    // been found.
+    //
+    // If the leaf is full, element is constructed before nodes are split,
+    // because `args` could refer to elements relocated by a split.
+    //
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> emplace_unique_key(const K& k, Args&&... args)
+    {
+        if (data_.root_ == nullptr)
+        {
+            make_root();
+        }
+
+        node_pointer x = find_leaf_lower(k);
+
+        const size_type i = leaf_lower_bound(x, k);
+
+        const iterator it = make_iterator(x, i);
+
+        if (it != end() && !ref_to_comp()(k, key(it.node_, it.index_)))
+        {
+            return std::make_pair(it, false);
+        }
+
+        if (x->size_ < leaf_capacity)
+        {
+            return std::make_pair(insert_value(x, i, std::forward<Args>(args)...), true);
+        }
+
+        value_type tmp(std::forward<Args>(args)...);
+
+        while (x->size_ == leaf_capacity)
+        {
+            split_for_insert(x);
+            x = find_leaf_lower(KeyOfValue()(tmp));
+        }
+
+        return std::make_pair(insert_value(x, leaf_lower_bound(x, KeyOfValue()(tmp)), std::move(tmp)), true);
+    }
+
+    template <typename K, typename... Args>
+    iterator emplace_hint_equal_key(const_iterator hint, const K& k, Args&&... args)
+    {
+        if (is_insert_hint_good(hint, k, std::false_type()))
+        {
+            return insert_value(hint.node_, hint.index_, std::forward<Args>(args)...);
+        }
+
+        return emplace_equal_key(k, std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args>
+    iterator emplace_hint_unique_key(const_iterator hint, const K& k, Args&&... args)
+    {
+        if (is_insert_hint_good(hint, k, std::true_type()))
+        {
+            return insert_value(hint.node_, hint.index_, std::forward<Args>(args)...);
+        }
+
+        return emplace_unique_key(k, std::forward<Args>(args)...).first;
+    }
+
+    template <typename V>
+    iterator insert_equal(V&& value)
+    {
+        return emplace_equal_key(KeyOfValue()(value), std::forward<V>(value));
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> insert_unique(V&& value)
+    {
+        return emplace_unique_key(KeyOfValue()(value), std::forward<V>(value));
+    }
+
+    template <typename V>
+    iterator insert_hint_equal(const_iterator hint, V&& value)
+    {
+        return emplace_hint_equal_key(hint, KeyOfValue()(value), std::forward<V>(value));
+    }
+
+    template <typename V>
+    iterator insert_hint_unique(const_iterator hint, V&& value)
+    {
+        return emplace_hint_unique_key(hint, KeyOfValue()(value), std::forward<V>(value));
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    //
+    // Erases element at `pos` and returns iterator to the following element.
+    //
+    // Nodes that would become underfull are rebalanced top-down before the
+    // element is destroyed, so every step has strong exception guarantee.
+    // If an exception is thrown, the element is not erased and the tree is
+    // valid, although nodes on the path to the element may be rebalanced.
+    //
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(pos != cend());
+
+        node_pointer x = pos.node_;
+        size_type i = pos.index_;
+
+        while (x != data_.root_ && x->size_ <= min_leaf_size)
+        {
+            make_room_for_erase(x, i);
+        }
+
+        remove_value(x, i);
+
+        if (x->size_ == 0)
+        {
+            SFL_ASSERT(x == data_.root_);
+            drop_node(x);
+            data_.reset();
+            return end();
+        }
+
+        return make_iterator(x, i);
+    }
+
+    //
+    // Calls `f` with element at `pos` and then erases the element. Nodes are
+    // rebalanced before `f` is called, so if `f` moves the element into
+    // another tree, it is not lost or duplicated if an exception is thrown.
+    //
+    template <typename F>
+    iterator erase_after(const_iterator pos, F f)
+    {
+        SFL_ASSERT(pos != cend());
+
+        node_pointer x = pos.node_;
+        size_type i = pos.index_;
+
+        while (x != data_.root_ && x->size_ <= min_leaf_size)
+        {
+            make_room_for_erase(x, i);
+        }
+
+        f(value(x, i));
+
+        remove_value(x, i);
+
+        if (x->size_ == 0)
+        {
+            SFL_ASSERT(x == data_.root_);
+            drop_node(x);
+            data_.reset();
+            return end();
+        }
+
+        return make_iterator(x, i);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        // Iterators are invalidated by erasure, so the number of elements is
+        // counted first.
+        size_type n = std::distance(first, last);
+
+        iterator it(first.node_, first.index_);
+
+        while (n > 0)
+        {
+            it = erase(it);
+            --n;
+        }
+
+        return it;
+    }
+
+    template <typename K>
+    size_type erase(const K& k)
+    {
+        const auto er = equal_range(k);
+        const auto sz = std::distance(er.first, er.second);
+        erase(er.first, er.second);
+        return sz;
+    }
+
+    node_handle extract(iterator pos)
+    {
+        return extract(const_iterator(pos));
+    }
+
+    node_handle extract(const_iterator pos)
+    {
+        SFL_ASSERT(pos != cend());
+        node_handle nh(value(pos.node_, pos.index_));
+        erase(pos);
+        return nh;
+    }
+
+    template <typename K>
+    node_handle extract(const K& k)
+    {
+        const const_iterator it = find(k);
+        return it == cend() ? node_handle() : extract(it);
+    }
+
+    insert_return_type insert_node_unique(node_handle&& nh)
+    {
+        if (nh.empty())
+        {
+            return insert_return_type{end(), false, node_handle()};
+        }
+
+        auto res = emplace_unique_key(KeyOfValue()(nh.value_), std::move(nh.value_));
+
+        if (res.second)
+        {
+            nh.clear();
+            return insert_return_type{res.first, true, node_handle()};
+        }
+        else
+        {
+            return insert_return_type{res.first, false, std::move(nh)};
+        }
+    }
+
+    iterator insert_node_equal(node_handle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        const iterator it = emplace_equal_key(KeyOfValue()(nh.value_), std::move(nh.value_));
+        nh.clear();
+        return it;
+    }
+
+    iterator insert_node_hint_unique(const_iterator hint, node_handle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        const size_type old_size = data_.size_;
+
+        const iterator it = emplace_hint_unique_key(hint, KeyOfValue()(nh.value_), std::move(nh.value_));
+
+        if (data_.size_ != old_size)
+        {
+            nh.clear();
+        }
+
+        return it;
+    }
+
+    iterator insert_node_hint_equal(const_iterator hint, node_handle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        const iterator it = emplace_hint_equal_key(hint, KeyOfValue()(nh.value_), std::move(nh.value_));
+        nh.clear();
+        return it;
+    }
+
+    //
+    // Moves elements from `other` into this tree. Elements whose keys are
+    // already present are left in `other`.
+    //
+    template <typename KeyCompare2, typename UpperLevelContainer2>
+    void merge_unique(btree<Key, Value, KeyOfValue, KeyCompare2, Allocator, UpperLevelContainer2>& other)
+    {
+        if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+        {
+            return;
+        }
+
+        auto it = other.begin();
+
+        while (it != other.end())
+        {
+            if (contains(KeyOfValue()(*it)))
+            {
+                ++it;
+            }
+            else
+            {
+                it = other.erase_after(it, [this](value_type& v) { insert_equal(std::move_if_noexcept(v)); });
+            }
+        }
+    }
+
+    //
+    // Moves all elements from `other` into this tree.
+    //
+    template <typename KeyCompare2, typename UpperLevelContainer2>
+    void merge_equal(btree<Key, Value, KeyOfValue, KeyCompare2, Allocator, UpperLevelContainer2>& other)
+    {
+        if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+        {
+            return;
+        }
+
+        auto it = other.begin();
+
+        while (it != other.end())
+        {
+            it = other.erase_after(it, [this](value_type& v) { insert_equal(std::move_if_noexcept(v)); });
+        }
+    }
+
+    //
+    // Moves all elements from `other` into this tree. Elements whose keys are
+    // already present are left in `other`.
+    //
+    // If this tree is empty and nodes can be relinked, nodes are taken over
+    // in constant time. If all keys in `other` are greater than keys in this
+    // tree, elements are appended in linear time. Otherwise it is equivalent
+    // to `merge_unique`.
+    //
+    void join_unique(btree& other)
+    {
+        join(other, std::true_type());
+    }
+
+    //
+    // Moves all elements from `other` into this tree.
+    //
+    // If this tree is empty and nodes can be relinked, nodes are taken over
+    // in constant time. If no key in `other` is less than keys in this tree,
+    // elements are appended in linear time. Otherwise it is equivalent to
+    // `merge_equal`.
+    //
+    void join_equal(btree& other)
+    {
+        join(other, std::false_type());
+    }
+
+    //
+    // Moves elements with keys not less than `k` into `other`, which must be
+    // empty. Moved elements are appended to `other` in linear time. If an
+    // exception is thrown, both trees are unchanged.
+    //
+    template <typename K>
+    void split(btree& other, const K& k)
+    {
+        SFL_ASSERT(this != &other);
+        SFL_ASSERT(other.data_.root_ == nullptr);
+
+        const const_iterator first = lower_bound(k);
+
+        if (first == cend())
+        {
+            return;
+        }
+
+        const size_type n = std::distance(first, cend());
+
+        SFL_TRY
+        {
+            for (const_iterator it = first; it != cend(); ++it)
+            {
+                other.append(std::move_if_noexcept(value(it.node_, it.index_)));
+            }
+
+            other.fix_right_spine();
+        }
+        SFL_CATCH (...)
+        {
+            restore_values(iterator(first.node_, first.index_), other.begin(), other.data_.size_);
+            other.clear();
+            SFL_RETHROW;
+        }
+
+        truncate(first, n);
+
+        // Nodes left underfull on the right spine don't break the bound on
+        // the number of nodes, because `split_for_insert` fixes them before
+        // the next node is allocated. Elements are already split, so an
+        // exception is not propagated.
+        SFL_TRY
+        {
+            fix_right_spine();
+        }
+        SFL_CATCH (...)
+        {
+        }
+    }
+
+    void swap(btree& other)
+    {
+        if (this != &other)
+        {
+            swap(other, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
+        }
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    template <typename K>
+    SFL_NODISCARD
+    iterator lower_bound(const K& k) noexcept
+    {
+        const auto res = find_lower_bound(k);
+        return iterator(res.first, res.second);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    const_iterator lower_bound(const K& k) const noexcept
+    {
+        const auto res = find_lower_bound(k);
+        return const_iterator(res.first, res.second);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    iterator upper_bound(const K& k) noexcept
+    {
+        const auto res = find_upper_bound(k);
+        return iterator(res.first, res.second);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    const_iterator upper_bound(const K& k) const noexcept
+    {
+        const auto res = find_upper_bound(k);
+        return const_iterator(res.first, res.second);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const K& k) noexcept
+    {
+        return std::make_pair(lower_bound(k), upper_bound(k));
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const K& k) const noexcept
+    {
+        return std::make_pair(lower_bound(k), upper_bound(k));
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    iterator find(const K& k) noexcept
+    {
+        auto it = lower_bound(k);
+
+        if (it != end() && ref_to_comp()(k, key(it.node_, it.index_)))
+        {
+            it = end();
+        }
+
+        return it;
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    const_iterator find(const K& k) const noexcept
+    {
+        auto it = lower_bound(k);
+
+        if (it != end() && ref_to_comp()(k, key(it.node_, it.index_)))
+        {
+            it = end();
+        }
+
+        return it;
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    size_type count(const K& k) const noexcept
+    {
+        const auto er = equal_range(k);
+        return std::distance(er.first, er.second);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    bool contains(const K& k) const noexcept
+    {
+        return find(k) != end();
+    }
+
+    //
+    // Batched lookups. For each key in [first, last) writes the result of
+    // `lower_bound` or `find` to `out`.
+    //
+    // Keys are processed in groups of `batch_size`. All leaves are at the
+    // same depth, so descents of all keys in a group advance one level at
+    // a time in lockstep, and the next node of each descent is prefetched
+    // while the other descents are advanced.
+    //
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return search_batch<iterator>(first, last, out, std::false_type());
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return search_batch<const_iterator>(first, last, out, std::false_type());
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return search_batch<iterator>(first, last, out, std::true_type());
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return search_batch<const_iterator>(first, last, out, std::true_type());
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    SFL_NODISCARD
+    static value_type& value(node_pointer x, size_type i) noexcept
+    {
+        return x->values_[x->order_[i]];
+    }
+
+    SFL_NODISCARD
+    static const key_type& key(node_pointer x, size_type i) noexcept
+    {
+        return KeyOfValue()(value(x, i));
+    }
+
+    SFL_NODISCARD
+    static const key_type& separator(node_pointer x, size_type i) noexcept
+    {
+        return x->inner_.keys_[x->order_[i]];
+    }
+
+    SFL_NODISCARD
+    static node_pointer& child(node_pointer x, size_type i) noexcept
+    {
+        return x->inner_.children_[i];
+    }
+
+    SFL_NODISCARD
+    static size_type child_index(node_pointer p, node_pointer x) noexcept
+    {
+        size_type i = 0;
+
+        while (child(p, i) != x)
+        {
+            ++i;
+        }
+
+        return i;
+    }
+
+    static void next(node_pointer& x, std::size_t& i) noexcept
+    {
+        ++i;
+
+        if (i == x->size_ && x->next_ != nullptr)
+        {
+            x = x->next_;
+            i = 0;
+        }
+    }
+
+    static void prev(node_pointer& x, std::size_t& i) noexcept
+    {
+        if (i == 0)
+        {
+            x = x->prev_;
+            i = x->size_;
+        }
+
+        --i;
+    }
+
+    SFL_NODISCARD
+    size_type end_index() const noexcept
+    {
+        return data_.last_ == nullptr ? 0 : data_.last_->size_;
+    }
+
+    // Returns iterator to element at rank `i` of leaf `x`. Rank equal to the
+    // size of leaf denotes the first element of the next leaf.
+    SFL_NODISCARD
+    iterator make_iterator(node_pointer x, size_type i) noexcept
+    {
+        if (i == x->size_ && x->next_ != nullptr)
+        {
+            return iterator(x->next_, 0);
+        }
+
+        return iterator(x, i);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    //
+    // Returns the number of elements at the beginning of a node of size `n`
+    // for which `pred(rank)` is true. Node must be partitioned with respect
+    // to `pred`.
+    //
+    template <typename Predicate>
+    static size_type partition_point(size_type n, Predicate pred)
+    {
+        size_type first = 0;
+
+        while (n > 0)
+        {
+            const size_type half = n / 2;
+
+            if (pred(first + half))
+            {
+                first += half + 1;
+                n -= half + 1;
+            }
+            else
+            {
+                n = half;
+            }
+        }
+
+        return first;
+    }
+
+    template <typename K>
+    size_type leaf_lower_bound(node_pointer x, const K& k) const
+    {
+        return partition_point(x->size_, [&](size_type i) { return ref_to_comp()(key(x, i), k); });
+    }
+
+    template <typename K>
+    size_type leaf_upper_bound(node_pointer x, const K& k) const
+    {
+        return partition_point(x->size_, [&](size_type i) { return !ref_to_comp()(k, key(x, i)); });
+    }
+
+    // Child `i` holds keys not greater than separator `i`, and child `i + 1`
+    // holds keys not less than separator `i`.
+
+    template <typename K>
+    size_type inner_lower_bound(node_pointer x, const K& k) const
+    {
+        return partition_point(x->size_, [&](size_type i) { return ref_to_comp()(separator(x, i), k); });
+    }
+
+    template <typename K>
+    size_type inner_upper_bound(node_pointer x, const K& k) const
+    {
+        return partition_point(x->size_, [&](size_type i) { return !ref_to_comp()(k, separator(x, i)); });
+    }
+
+    template <typename K>
+    std::pair<node_pointer, size_type> find_lower_bound(const K& k) const
+    {
+        if (data_.root_ == nullptr)
+        {
+            return std::make_pair(data_.root_, size_type(0));
+        }
+
+        node_pointer x = find_leaf_lower(k);
+
+        size_type i = leaf_lower_bound(x, k);
+
+        if (i == x->size_ && x->next_ != nullptr)
+        {
+            x = x->next_;
+            i = 0;
+        }
+
+        return std::make_pair(x, i);
+    }
+
+    template <typename K>
+    std::pair<node_pointer, size_type> find_upper_bound(const K& k) const
+    {
+        if (data_.root_ == nullptr)
+        {
+            return std::make_pair(data_.root_, size_type(0));
+        }
+
+        node_pointer x = find_leaf_upper(k);
+
+        size_type i = leaf_upper_bound(x, k);
+
+        if (i == x->size_ && x->next_ != nullptr)
+        {
+            x = x->next_;
+            i = 0;
+        }
+
+        return std::make_pair(x, i);
+    }
+
+    template <typename K>
+    node_pointer find_leaf_lower(const K& k) const
+    {
+        node_pointer x = data_.root_;
+
+        while (!x->leaf_)
+        {
+            x = child(x, inner_lower_bound(x, k));
+        }
+
+        return x;
+    }
+
+    template <typename K>
+    node_pointer find_leaf_upper(const K& k) const
+    {
+        node_pointer x = data_.root_;
+
+        while (!x->leaf_)
+        {
+            x = child(x, inner_upper_bound(x, k));
+        }
+
+        return x;
+    }
+
+    static constexpr int batch_size = 8;
+
+    template <typename Iterator, typename ForwardIt, typename OutputIt, bool Find>
+    OutputIt search_batch(ForwardIt first, ForwardIt last, OutputIt out, std::integral_constant<bool, Find>) const
+    {
+        ForwardIt keys[batch_size];
+        node_pointer x[batch_size];
+
+        while (first != last)
+        {
+            int n = 0;
+
+            for (; n < batch_size && first != last; ++n, ++first)
+            {
+                keys[n] = first;
+                x[n] = data_.root_;
+            }
+
+            if (data_.root_ != nullptr)
+            {
+                while (!x[0]->leaf_)
+                {
+                    for (int i = 0; i < n; ++i)
+                    {
+                        x[i] = child(x[i], inner_lower_bound(x[i], *keys[i]));
+                        sfl::dtl::prefetch(x[i]);
+                    }
+                }
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                node_pointer y = x[i];
+                size_type j = 0;
+
+                if (y != nullptr)
+                {
+                    j = leaf_lower_bound(y, *keys[i]);
+
+                    if (j == y->size_ && y->next_ != nullptr)
+                    {
+                        y = y->next_;
+                        j = 0;
+                    }
+
+                    if (Find && j != y->size_ && ref_to_comp()(*keys[i], key(y, j)))
+                    {
+                        y = data_.last_;
+                        j = y->size_;
+                    }
+                }
+
+                *out = Iterator(y, j);
+                ++out;
+            }
+        }
+
+        return out;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    node_pointer allocate_node()
+    {
+        return sfl::dtl::allocate(ref_to_node_alloc(), 1);
+    }
+
+    void deallocate_node(node_pointer p) noexcept
+    {
+        sfl::dtl::deallocate(ref_to_node_alloc(), p, 1);
+    }
+
+    node_pointer make_leaf()
+    {
+        node_pointer x = allocate_node();
+
+        sfl::dtl::construct_at_a(ref_to_node_alloc(), x);
+
+        x->parent_ = nullptr;
+        x->prev_   = nullptr;
+        x->next_   = nullptr;
+        x->size_   = 0;
+        x->leaf_   = true;
+
+        for (std::size_t i = 0; i < leaf_capacity; ++i)
+        {
+            x->order_[i] = std::uint8_t(i);
+        }
+
+        return x;
+    }
+
+    node_pointer make_inner()
+    {
+        node_pointer x = allocate_node();
+
+        sfl::dtl::construct_at_a(ref_to_node_alloc(), x);
+
+        x->parent_ = nullptr;
+        x->prev_   = nullptr;
+        x->next_   = nullptr;
+        x->size_   = 0;
+        x->leaf_   = false;
+
+        for (std::size_t i = 0; i < inner_capacity + 1; ++i)
+        {
+            x->order_[i] = std::uint8_t(i);
+            sfl::dtl::construct_at(std::addressof(child(x, i)), nullptr);
+        }
+
+        return x;
+    }
+
+    // Destroys and deallocates node. Values and keys must be destroyed.
+    void drop_node(node_pointer x) noexcept
+    {
+        if (!x->leaf_)
+        {
+            for (std::size_t i = 0; i < inner_capacity + 1; ++i)
+            {
+                sfl::dtl::destroy_at(std::addressof(child(x, i)));
+            }
+        }
+
+        sfl::dtl::destroy_at_a(ref_to_node_alloc(), x);
+        deallocate_node(x);
+    }
+
+    void destroy_values(node_pointer x, size_type first, size_type last) noexcept
+    {
+        for (size_type i = first; i < last; ++i)
+        {
+            sfl::dtl::destroy_at_a(ref_to_node_alloc(), std::addressof(value(x, i)));
+        }
+    }
+
+    void destroy_separators(node_pointer x, size_type first, size_type last) noexcept
+    {
+        for (size_type i = first; i < last; ++i)
+        {
+            sfl::dtl::destroy_at(std::addressof(x->inner_.keys_[x->order_[i]]));
+        }
+    }
+
+    void clear(node_pointer x) noexcept
+    {
+        SFL_ASSERT(x != nullptr);
+
+        if (x->leaf_)
+        {
+            destroy_values(x, 0, x->size_);
+        }
+        else
+        {
+            destroy_separators(x, 0, x->size_);
+
+            for (size_type i = 0; i <= x->size_; ++i)
+            {
+                clear(child(x, i));
+            }
+        }
+
+        drop_node(x);
+    }
+
+    // Drops inner nodes of subtree `x`. Leaves are left untouched.
+    void drop_inner_nodes(node_pointer x) noexcept
+    {
+        if (!x->leaf_)
+        {
+            destroy_separators(x, 0, x->size_);
+
+            for (size_type i = 0; i <= x->size_; ++i)
+            {
+                drop_inner_nodes(child(x, i));
+            }
+
+            drop_node(x);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    //
+    // Constructs values at ranks [dst_rank, dst_rank + n) of leaf `dst` from
+    // values at ranks [src_rank, src_rank + n) of leaf `src`. Destination
+    // ranks must not be greater than the size of `dst`. Sources are moved if
+    // their move constructor cannot throw, otherwise they are copied. Sources
+    // are not destroyed. On exception, constructed values are destroyed.
+    //
+    void transfer_values(node_pointer dst, size_type dst_rank, node_pointer src, size_type src_rank, size_type n)
+    {
+        size_type i = 0;
+
+        SFL_TRY
+        {
+            for (; i < n; ++i)
+            {
+                sfl::dtl::construct_at_a
+                (
+                    ref_to_node_alloc(),
+                    std::addressof(value(dst, dst_rank + i)),
+                    std::move_if_noexcept(value(src, src_rank + i))
+                );
+            }
+        }
+        SFL_CATCH (...)
+        {
+            destroy_values(dst, dst_rank, dst_rank + i);
+            SFL_RETHROW;
+        }
+    }
+
+    //
+    // Copies separators at ranks [src_rank, src_rank + n) of inner node `src`
+    // to ranks [dst_rank, dst_rank + n) of inner node `dst`. On exception,
+    // constructed separators are destroyed.
+    //
+    void copy_separators(node_pointer dst, size_type dst_rank, node_pointer src, size_type src_rank, size_type n)
+    {
+        size_type i = 0;
+
+        SFL_TRY
+        {
+            for (; i < n; ++i)
+            {
+                sfl::dtl::construct_at
+                (
+                    std::addressof(dst->inner_.keys_[dst->order_[dst_rank + i]]),
+                    separator(src, src_rank + i)
+                );
+            }
+        }
+        SFL_CATCH (...)
+        {
+            destroy_separators(dst, dst_rank, dst_rank + i);
+            SFL_RETHROW;
+        }
+    }
+
+    // Constructs key at the first free slot of inner node `x` and returns
+    // the slot.
+    static std::uint8_t construct_free_separator(node_pointer x, const key_type& k)
+    {
+        const std::uint8_t s = x->order_[x->size_];
+        sfl::dtl::construct_at(std::addressof(x->inner_.keys_[s]), k);
+        return s;
+    }
+
+    static void destroy_free_separator(node_pointer x, std::uint8_t s) noexcept
+    {
+        sfl::dtl::destroy_at(std::addressof(x->inner_.keys_[s]));
+    }
+
+    // Replaces separator at rank `i` of inner node `x` with the key that is
+    // constructed at the first free slot `s`.
+    static void replace_separator(node_pointer x, size_type i, std::uint8_t s) noexcept
+    {
+        SFL_ASSERT(x->order_[x->size_] == s);
+        const std::uint8_t old = x->order_[i];
+        sfl::dtl::destroy_at(std::addressof(x->inner_.keys_[old]));
+        x->order_[i] = s;
+        x->order_[x->size_] = old;
+    }
+
+    // Inserts slot that is the first free slot at rank `i`.
+    static void insert_rank(node_pointer x, size_type i) noexcept
+    {
+        const std::uint8_t s = x->order_[x->size_];
+        std::copy_backward(x->order_ + i, x->order_ + x->size_, x->order_ + x->size_ + 1);
+        x->order_[i] = s;
+        ++x->size_;
+    }
+
+    // Removes slot at rank `i` and makes it the first free slot.
+    static void erase_rank(node_pointer x, size_type i) noexcept
+    {
+        const std::uint8_t s = x->order_[i];
+        std::copy(x->order_ + i + 1, x->order_ + x->size_, x->order_ + i);
+        --x->size_;
+        x->order_[x->size_] = s;
+    }
+
+    // Inserts separator constructed at the first free slot at rank `i` of
+    // inner node `p`, and inserts child `y` after it.
+    static void insert_child(node_pointer p, size_type i, node_pointer y) noexcept
+    {
+        std::copy_backward
+        (
+            p->inner_.children_ + i + 1,
+            p->inner_.children_ + p->size_ + 1,
+            p->inner_.children_ + p->size_ + 2
+        );
+
+        insert_rank(p, i);
+
+        child(p, i + 1) = y;
+        y->parent_ = p;
+    }
+
+    // Removes child `c` of inner node `p` together with separator on its left
+    // (or on its right if `c` is zero).
+    static void erase_child(node_pointer p, size_type c) noexcept
+    {
+        SFL_ASSERT(p->size_ > 0);
+
+        const size_type i = c > 0 ? c - 1 : 0;
+
+        sfl::dtl::destroy_at(std::addressof(p->inner_.keys_[p->order_[i]]));
+
+        std::copy
+        (
+            p->inner_.children_ + c + 1,
+            p->inner_.children_ + p->size_ + 1,
+            p->inner_.children_ + c
+        );
+
+        erase_rank(p, i);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void make_root()
+    {
+        SFL_ASSERT(data_.root_ == nullptr);
+        node_pointer x = make_leaf();
+        data_.root_  = x;
+        data_.first_ = x;
+        data_.last_  = x;
+    }
+
+    //
+    // Constructs element from `args` at rank `i` of leaf `x`, which must not
+    // be full. On exception the tree is unchanged, except that the root is
+    // dropped if the tree is empty.
+    //
+    template <typename... Args>
+    iterator insert_value(node_pointer x, size_type i, Args&&... args)
+    {
+        SFL_ASSERT(x->size_ < leaf_capacity);
+        SFL_ASSERT(i <= x->size_);
+
+        SFL_TRY
+        {
+            sfl::dtl::construct_at_a
+            (
+                ref_to_node_alloc(),
+                std::addressof(x->values_[x->order_[x->size_]]),
+                std::forward<Args>(args)...
+            );
+        }
+        SFL_CATCH (...)
+        {
+            if (data_.size_ == 0)
+            {
+                clear();
+            }
+
+            SFL_RETHROW;
+        }
+
+        insert_rank(x, i);
+        ++data_.size_;
+        return iterator(x, i);
+    }
+
+    // Destroys element at rank `i` of leaf `x`.
+    void remove_value(node_pointer x, size_type i) noexcept
+    {
+        sfl::dtl::destroy_at_a(ref_to_node_alloc(), std::addressof(value(x, i)));
+        erase_rank(x, i);
+        --data_.size_;
+    }
+
+    template <typename K, bool Unique>
+    bool is_insert_hint_good(const_iterator hint, const K& k, std::integral_constant<bool, Unique>)
+    {
+        const node_pointer x = hint.node_;
+        const size_type i = hint.index_;
+
+        if (x == nullptr || x->size_ == leaf_capacity)
+        {
+            return false;
+        }
+
+        // Element inserted at the beginning of leaf could be less than
+        // separator on the left of leaf.
+        if (i == 0 && x != data_.first_)
+        {
+            return false;
+        }
+
+        if (i < x->size_)
+        {
+            if (Unique ? !ref_to_comp()(k, key(x, i)) : ref_to_comp()(key(x, i), k))
+            {
+                return false;
+            }
+        }
+
+        if (i > 0)
+        {
+            if (Unique ? !ref_to_comp()(key(x, i - 1), k) : ref_to_comp()(k, key(x, i - 1)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //
+    // Makes room in the path from the root to full leaf `x`: splits the
+    // topmost full node on that path, whose parent (if any) is not full.
+    // Caller repeats the descent until the leaf is not full, so at most one
+    // node per level is split, top-down.
+    //
+    // Nodes left underfull on the right spine are fixed first, so the tree
+    // never has more nodes than a tree whose nodes are all half full. Caller
+    // must repeat the descent in that case.
+    //
+    void split_for_insert(node_pointer x)
+    {
+        if (fix_right_spine())
+        {
+            return;
+        }
+
+        while (x->parent_ != nullptr && x->parent_->size_ == inner_capacity)
+        {
+            x = x->parent_;
+        }
+
+        split(x);
+    }
+
+    //
+    // Splits full node `x` into two nodes. Parent of `x` must not be full.
+    // If `x` is the root, new root is created.
+    //
+    // The right half is copied (or moved, if that cannot throw) to a new node
+    // and separator is constructed in the parent before anything is linked,
+    // so on exception the tree is unchanged.
+    //
+    void split(node_pointer x)
+    {
+        node_pointer p = x->parent_;
+
+        SFL_ASSERT(p == nullptr || p->size_ < inner_capacity);
+
+        node_pointer y = x->leaf_ ? make_leaf() : make_inner();
+        node_pointer r = nullptr;
+
+        const size_type mid = x->size_ / 2;
+
+        SFL_TRY
+        {
+            if (p == nullptr)
+            {
+                r = make_inner();
+                p = r;
+            }
+
+            if (x->leaf_)
+            {
+                const std::uint8_t s = construct_free_separator(p, key(x, mid));
+
+                SFL_TRY
+                {
+                    transfer_values(y, 0, x, mid, x->size_ - mid);
+                }
+                SFL_CATCH (...)
+                {
+                    destroy_free_separator(p, s);
+                    SFL_RETHROW;
+                }
+            }
+            else
+            {
+                const std::uint8_t s = construct_free_separator(p, separator(x, mid));
+
+                SFL_TRY
+                {
+                    copy_separators(y, 0, x, mid + 1, x->size_ - mid - 1);
+                }
+                SFL_CATCH (...)
+                {
+                    destroy_free_separator(p, s);
+                    SFL_RETHROW;
+                }
+            }
+        }
+        SFL_CATCH (...)
+        {
+            if (r != nullptr)
+            {
+                drop_node(r);
+            }
+
+            drop_node(y);
+
+            SFL_RETHROW;
+        }
+
+        if (x->leaf_)
+        {
+            destroy_values(x, mid, x->size_);
+
+            y->size_ = std::uint8_t(x->size_ - mid);
+            x->size_ = std::uint8_t(mid);
+
+            y->prev_ = x;
+            y->next_ = x->next_;
+
+            if (x->next_ != nullptr)
+            {
+                x->next_->prev_ = y;
+            }
+            else
+            {
+                data_.last_ = y;
+            }
+
+            x->next_ = y;
+        }
+        else
+        {
+            const size_type n = x->size_ - mid - 1;
+
+            destroy_separators(x, mid, x->size_);
+
+            for (size_type i = 0; i <= n; ++i)
+            {
+                child(y, i) = child(x, mid + 1 + i);
+                child(y, i)->parent_ = y;
+            }
+
+            y->size_ = std::uint8_t(n);
+            x->size_ = std::uint8_t(mid);
+        }
+
+        if (r != nullptr)
+        {
+            child(r, 0) = x;
+            x->parent_ = r;
+            data_.root_ = r;
+            insert_child(r, 0, y);
+        }
+        else
+        {
+            insert_child(p, child_index(p, x), y);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    //
+    // Moves the last element of left sibling `s` to the beginning of leaf
+    // `x`, which is child `c` of `p`.
+    //
+    void borrow_from_left_leaf(node_pointer x, node_pointer s, node_pointer p, size_type c)
+    {
+        const size_type last = s->size_ - 1;
+
+        const std::uint8_t sep = construct_free_separator(p, key(s, last));
+
+        SFL_TRY
+        {
+            transfer_values(x, x->size_, s, last, 1);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_free_separator(p, sep);
+            SFL_RETHROW;
+        }
+
+        destroy_values(s, last, s->size_);
+        --s->size_;
+
+        const std::uint8_t slot = x->order_[x->size_];
+        std::copy_backward(x->order_, x->order_ + x->size_, x->order_ + x->size_ + 1);
+        x->order_[0] = slot;
+        ++x->size_;
+
+        replace_separator(p, c - 1, sep);
+    }
+
+    //
+    // Moves the first element of right sibling `s` to the end of leaf `x`,
+    // which is child `c` of `p`.
+    //
+    void borrow_from_right_leaf(node_pointer x, node_pointer s, node_pointer p, size_type c)
+    {
+        SFL_ASSERT(s->size_ > 1);
+
+        const std::uint8_t sep = construct_free_separator(p, key(s, 1));
+
+        SFL_TRY
+        {
+            transfer_values(x, x->size_, s, 0, 1);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_free_separator(p, sep);
+            SFL_RETHROW;
+        }
+
+        sfl::dtl::destroy_at_a(ref_to_node_alloc(), std::addressof(value(s, 0)));
+        erase_rank(s, 0);
+
+        ++x->size_;
+
+        replace_separator(p, c, sep);
+    }
+
+    //
+    // Moves all elements of leaf `r` to the end of its left sibling `l` and
+    // drops `r`, which is child `c` of `p`.
+    //
+    void merge_leaves(node_pointer l, node_pointer r, node_pointer p, size_type c)
+    {
+        SFL_ASSERT(size_type(l->size_) + r->size_ <= leaf_capacity);
+
+        transfer_values(l, l->size_, r, 0, r->size_);
+
+        destroy_values(r, 0, r->size_);
+
+        l->size_ = std::uint8_t(l->size_ + r->size_);
+
+        l->next_ = r->next_;
+
+        if (r->next_ != nullptr)
+        {
+            r->next_->prev_ = l;
+        }
+        else
+        {
+            data_.last_ = l;
+        }
+
+        drop_node(r);
+
+        erase_child(p, c);
+    }
+
+    //
+    // Rotates the last key and child of left sibling `s` through parent `p`
+    // into inner node `x`, which is child `c` of `p`.
+    //
+    void rotate_from_left(node_pointer x, node_pointer s, node_pointer p, size_type c)
+    {
+        const std::uint8_t k = construct_free_separator(x, separator(p, c - 1));
+
+        std::uint8_t sep = 0;
+
+        SFL_TRY
+        {
+            sep = construct_free_separator(p, separator(s, s->size_ - 1));
+        }
+        SFL_CATCH (...)
+        {
+            destroy_free_separator(x, k);
+            SFL_RETHROW;
+        }
+
+        const node_pointer m = child(s, s->size_);
+        destroy_separators(s, s->size_ - 1, s->size_);
+        --s->size_;
+
+        std::copy_backward
+        (
+            x->inner_.children_,
+            x->inner_.children_ + x->size_ + 1,
+            x->inner_.children_ + x->size_ + 2
+        );
+
+        insert_rank(x, 0);
+
+        child(x, 0) = m;
+        m->parent_ = x;
+
+        replace_separator(p, c - 1, sep);
+    }
+
+    //
+    // Rotates the first key and child of right sibling `s` through parent `p`
+    // into inner node `x`, which is child `c` of `p`.
+    //
+    void rotate_from_right(node_pointer x, node_pointer s, node_pointer p, size_type c)
+    {
+        SFL_ASSERT(s->size_ > 0);
+
+        construct_free_separator(x, separator(p, c));
+
+        std::uint8_t sep = 0;
+
+        SFL_TRY
+        {
+            sep = construct_free_separator(p, separator(s, 0));
+        }
+        SFL_CATCH (...)
+        {
+            destroy_free_separator(x, x->order_[x->size_]);
+            SFL_RETHROW;
+        }
+
+        const node_pointer m = child(s, 0);
+
+        destroy_separators(s, 0, 1);
+
+        std::copy
+        (
+            s->inner_.children_ + 1,
+            s->inner_.children_ + s->size_ + 1,
+            s->inner_.children_
+        );
+
+        erase_rank(s, 0);
+
+        ++x->size_;
+
+        child(x, x->size_) = m;
+        m->parent_ = x;
+
+        replace_separator(p, c, sep);
+    }
+
+    //
+    // Moves separator `c - 1` of `p` and all keys and children of inner node
+    // `r` to the end of its left sibling `l` and drops `r`, which is child `c`
+    // of `p`.
+    //
+    void merge_inner_nodes(node_pointer l, node_pointer r, node_pointer p, size_type c)
+    {
+        SFL_ASSERT(size_type(l->size_) + r->size_ + 1 <= inner_capacity);
+
+        const std::uint8_t k = construct_free_separator(l, separator(p, c - 1));
+
+        l->size_ += 1;
+
+        SFL_TRY
+        {
+            copy_separators(l, l->size_, r, 0, r->size_);
+        }
+        SFL_CATCH (...)
+        {
+            l->size_ -= 1;
+            destroy_free_separator(l, k);
+            SFL_RETHROW;
+        }
+
+        for (size_type i = 0; i <= r->size_; ++i)
+        {
+            child(l, l->size_ + i) = child(r, i);
+            child(r, i)->parent_ = l;
+        }
+
+        l->size_ = std::uint8_t(l->size_ + r->size_);
+
+        destroy_separators(r, 0, r->size_);
+
+        drop_node(r);
+
+        erase_child(p, c);
+    }
+
+    //
+    // Makes room for erasing element at rank `i` of non-root leaf `x`, which
+    // is not more than half full. Walks up from `x` while parent is not the
+    // root and is not more than half full, and rebalances the topmost node
+    // found, whose parent can lose a key. Caller repeats this until `x` can
+    // lose an element, so at most one node per level is rebalanced. `x` and
+    // `i` are updated if the element is moved to another leaf.
+    //
+    // Every step either completes or throws without changing the tree.
+    //
+    void make_room_for_erase(node_pointer& x, size_type& i)
+    {
+        node_pointer y = x;
+
+        while (y->parent_ != data_.root_ && y->parent_->size_ <= min_inner_size)
+        {
+            y = y->parent_;
+        }
+
+        const node_pointer p = y->parent_;
+        const size_type c = child_index(p, y);
+
+        if (y->leaf_)
+        {
+            if (c > 0 && child(p, c - 1)->size_ > min_leaf_size)
+            {
+                borrow_from_left_leaf(y, child(p, c - 1), p, c);
+                ++i;
+            }
+            else if (c < p->size_ && child(p, c + 1)->size_ > min_leaf_size)
+            {
+                borrow_from_right_leaf(y, child(p, c + 1), p, c);
+            }
+            else if (c > 0)
+            {
+                const node_pointer s = child(p, c - 1);
+                const size_type n = s->size_;
+                merge_leaves(s, y, p, c);
+                x = s;
+                i += n;
+            }
+            else
+            {
+                merge_leaves(y, child(p, c + 1), p, c + 1);
+            }
+        }
+        else
+        {
+            if (c > 0 && child(p, c - 1)->size_ > min_inner_size)
+            {
+                rotate_from_left(y, child(p, c - 1), p, c);
+            }
+            else if (c < p->size_ && child(p, c + 1)->size_ > min_inner_size)
+            {
+                rotate_from_right(y, child(p, c + 1), p, c);
+            }
+            else if (c > 0)
+            {
+                merge_inner_nodes(child(p, c - 1), y, p, c);
+            }
+            else
+            {
+                merge_inner_nodes(y, child(p, c + 1), p, c + 1);
+            }
+        }
+
+        collapse_root();
+    }
+
+    //
+    // Removes empty non-root leaf `x` from the tree without rebalancing, and
+    // collapses the root while it has no keys. Inner nodes above `x` without
+    // keys, created by `attach_right`, are removed together with `x`. Used to
+    // undo appends, which leaves the tree as it was before them.
+    //
+    void remove_empty_leaf(node_pointer x) noexcept
+    {
+        SFL_ASSERT(x->size_ == 0);
+        SFL_ASSERT(x != data_.root_);
+
+        if (x->prev_ != nullptr)
+        {
+            x->prev_->next_ = x->next_;
+        }
+        else
+        {
+            data_.first_ = x->next_;
+        }
+
+        if (x->next_ != nullptr)
+        {
+            x->next_->prev_ = x->prev_;
+        }
+        else
+        {
+            data_.last_ = x->prev_;
+        }
+
+        node_pointer y = x;
+        node_pointer p = x->parent_;
+
+        while (p->size_ == 0)
+        {
+            y = p;
+            p = p->parent_;
+        }
+
+        erase_child(p, child_index(p, y));
+
+        while (y != x)
+        {
+            const node_pointer n = child(y, 0);
+            drop_node(y);
+            y = n;
+        }
+
+        drop_node(x);
+
+        collapse_root();
+    }
+
+    // Replaces the root with its only child while the root has no keys.
+    void collapse_root() noexcept
+    {
+        while (!data_.root_->leaf_ && data_.root_->size_ == 0)
+        {
+            const node_pointer r = data_.root_;
+            data_.root_ = child(r, 0);
+            data_.root_->parent_ = nullptr;
+            drop_node(r);
+        }
+    }
+
+    //
+    // Destroys the last element, which was appended. Leaf that becomes empty
+    // is removed without rebalancing.
+    //
+    void undo_append() noexcept
+    {
+        const node_pointer x = data_.last_;
+
+        remove_value(x, x->size_ - 1);
+
+        if (x->size_ == 0)
+        {
+            if (x == data_.root_)
+            {
+                drop_node(x);
+                data_.reset();
+            }
+            else
+            {
+                remove_empty_leaf(x);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    //
+    // Appends element constructed from `args` after the last element. Key of
+    // the element must not be less than keys of all elements. Leaves and
+    // inner nodes of the right spine are filled completely before new ones
+    // are created, so `fix_right_spine` must be called after the last append.
+    //
+    // On exception the tree is unchanged.
+    //
+    template <typename... Args>
+    void append(Args&&... args)
+    {
+        node_pointer x = data_.last_;
+
+        if (x != nullptr && x->size_ < leaf_capacity)
+        {
+            sfl::dtl::construct_at_a
+            (
+                ref_to_node_alloc(),
+                std::addressof(x->values_[x->order_[x->size_]]),
+                std::forward<Args>(args)...
+            );
+
+            ++x->size_;
+            ++data_.size_;
+            return;
+        }
+
+        node_pointer y = make_leaf();
+
+        SFL_TRY
+        {
+            sfl::dtl::construct_at_a
+            (
+                ref_to_node_alloc(),
+                std::addressof(y->values_[0]),
+                std::forward<Args>(args)...
+            );
+        }
+        SFL_CATCH (...)
+        {
+            drop_node(y);
+            SFL_RETHROW;
+        }
+
+        y->size_ = 1;
+
+        if (x == nullptr)
+        {
+            data_.root_  = y;
+            data_.first_ = y;
+            data_.last_  = y;
+        }
+        else
+        {
+            SFL_TRY
+            {
+                attach_right(y);
+            }
+            SFL_CATCH (...)
+            {
+                restore_arg(y->values_[0], std::forward<Args>(args)...);
+                destroy_values(y, 0, 1);
+                drop_node(y);
+                SFL_RETHROW;
+            }
+        }
+
+        ++data_.size_;
+    }
+
+    //
+    // Moves value back to the argument of `append` from which it was moved,
+    // so on exception the argument is unchanged. Does nothing if value was
+    // copied or constructed from other arguments.
+    //
+    void restore_arg(value_type& v, value_type&& arg) noexcept
+    {
+        if (std::is_nothrow_move_constructible<value_type>::value)
+        {
+            sfl::dtl::destroy_at_a(ref_to_node_alloc(), std::addressof(arg));
+            sfl::dtl::construct_at_a(ref_to_node_alloc(), std::addressof(arg), std::move(v));
+        }
+    }
+
+    template <typename... Args>
+    void restore_arg(value_type& /*v*/, Args&&... /*args*/) noexcept
+    {
+    }
+
+    //
+    // Links non-empty leaf `y` after the last leaf. New inner nodes are
+    // created above `y` for every full ancestor of the last leaf, and the
+    // root is split if all ancestors are full. All nodes and the separator
+    // are created before anything is linked.
+    //
+    void attach_right(node_pointer y)
+    {
+        node_pointer a = data_.last_->parent_;
+
+        size_type h = 0;
+
+        while (a != nullptr && a->size_ == inner_capacity)
+        {
+            a = a->parent_;
+            ++h;
+        }
+
+        node_pointer top = y;
+        node_pointer r = nullptr;
+
+        SFL_TRY
+        {
+            for (size_type i = 0; i < h; ++i)
+            {
+                node_pointer n = make_inner();
+                child(n, 0) = top;
+                top->parent_ = n;
+                top = n;
+            }
+
+            if (a == nullptr)
+            {
+                r = make_inner();
+                a = r;
+            }
+
+            construct_free_separator(a, key(y, 0));
+        }
+        SFL_CATCH (...)
+        {
+            if (r != nullptr)
+            {
+                drop_node(r);
+            }
+
+            while (top != y)
+            {
+                node_pointer n = child(top, 0);
+                drop_node(top);
+                top = n;
+            }
+
+            y->parent_ = nullptr;
+
+            SFL_RETHROW;
+        }
+
+        if (r != nullptr)
+        {
+            child(r, 0) = data_.root_;
+            data_.root_->parent_ = r;
+            data_.root_ = r;
+        }
+
+        ++a->size_;
+        child(a, a->size_) = top;
+        top->parent_ = a;
+
+        y->prev_ = data_.last_;
+        data_.last_->next_ = y;
+        data_.last_ = y;
+    }
+
+    //
+    // Restores minimum occupancy of nodes on the right spine, which may be
+    // left underfull by appends and by `truncate`. The topmost underfull node
+    // is merged with its left sibling if they fit into one node, otherwise it
+    // takes one element (or child) from it. This is repeated until no node on
+    // the right spine is underfull. Every step either completes or throws
+    // without changing the elements.
+    //
+    // Returns true if any node was changed.
+    //
+    bool fix_right_spine()
+    {
+        bool changed = false;
+
+        while (true)
+        {
+            node_pointer p = nullptr;
+            node_pointer x = data_.root_;
+
+            while (x != nullptr)
+            {
+                if (p != nullptr && x->size_ < (x->leaf_ ? min_leaf_size : min_inner_size))
+                {
+                    break;
+                }
+
+                p = x;
+                x = x->leaf_ ? nullptr : child(x, x->size_);
+            }
+
+            if (x == nullptr)
+            {
+                return changed;
+            }
+
+            const size_type c = p->size_;
+
+            SFL_ASSERT(c > 0);
+
+            const node_pointer s = child(p, c - 1);
+
+            if (x->leaf_)
+            {
+                if (size_type(s->size_) + x->size_ <= leaf_capacity)
+                {
+                    merge_leaves(s, x, p, c);
+                }
+                else
+                {
+                    borrow_from_left_leaf(x, s, p, c);
+                }
+            }
+            else
+            {
+                if (size_type(s->size_) + x->size_ + 1 <= inner_capacity)
+                {
+                    merge_inner_nodes(s, x, p, c);
+                }
+                else
+                {
+                    rotate_from_left(x, s, p, c);
+                }
+            }
+
+            collapse_root();
+
+            changed = true;
+        }
+    }
+
+    //
+    // Destroys `n` elements from `first` to the end without rebalancing.
+    // Nodes on the new right spine may be left underfull, and inner nodes
+    // may be left without keys.
+    //
+    void truncate(const_iterator first, size_type n) noexcept
+    {
+        if (first == cbegin())
+        {
+            clear();
+            return;
+        }
+
+        // Leaf `x` keeps elements at ranks [0, i).
+        node_pointer x = first.node_;
+        size_type i = first.index_;
+
+        if (i == 0)
+        {
+            x = x->prev_;
+            i = x->size_;
+        }
+
+        destroy_values(x, i, x->size_);
+        x->size_ = std::uint8_t(i);
+
+        if (x->next_ != nullptr)
+        {
+            x->next_->prev_ = nullptr;
+            x->next_ = nullptr;
+        }
+
+        data_.last_ = x;
+
+        for (node_pointer y = x, p = x->parent_; p != nullptr; y = p, p = p->parent_)
+        {
+            const size_type c = child_index(p, y);
+
+            for (size_type j = c + 1; j <= p->size_; ++j)
+            {
+                clear(child(p, j));
+            }
+
+            destroy_separators(p, c, p->size_);
+            p->size_ = std::uint8_t(c);
+        }
+
+        data_.size_ -= n;
+
+        collapse_root();
+    }
+
+    //
+    // Moves values of `n` elements starting at `src` back to `n` elements of
+    // this tree starting at `dst`, from which they were moved by
+    // `std::move_if_noexcept`. Does nothing if values were copied.
+    //
+    void restore_values(iterator dst, iterator src, size_type n) noexcept
+    {
+        if (std::is_nothrow_move_constructible<value_type>::value)
+        {
+            for (; n > 0; ++dst, ++src, --n)
+            {
+                sfl::dtl::destroy_at_a(ref_to_node_alloc(), std::addressof(*dst));
+                sfl::dtl::construct_at_a(ref_to_node_alloc(), std::addressof(*dst), std::move(*src));
+            }
+        }
+    }
+
+    //
+    // Appends elements from range [first, last) while the range is sorted.
+    // If `Unique` is true, elements equivalent to the previous one are
+    // skipped. Tree must be empty. The first element that is out of order is
+    // inserted as usual and the function returns iterator following it.
+    // On exception the tree is cleared.
+    //
+    template <typename InputIt, typename Sentinel, bool Unique>
+    InputIt initialize_sorted_prefix(InputIt first, Sentinel last, std::integral_constant<bool, Unique>)
+    {
+        SFL_ASSERT(data_.root_ == nullptr);
+
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                value_type tmp(*first);
+
+                ++first;
+
+                if (data_.last_ != nullptr)
+                {
+                    const key_type& lk = key(data_.last_, data_.last_->size_ - 1);
+
+                    if (ref_to_comp()(KeyOfValue()(tmp), lk))
+                    {
+                        fix_right_spine();
+                        insert_out_of_order(std::move(tmp), std::integral_constant<bool, Unique>());
+                        return first;
+                    }
+
+                    if (Unique && !ref_to_comp()(lk, KeyOfValue()(tmp)))
+                    {
+                        continue;
+                    }
+                }
+
+                append(std::move(tmp));
+            }
+
+            fix_right_spine();
+        }
+        SFL_CATCH (...)
+        {
+            clear();
+            SFL_RETHROW;
+        }
+
+        return first;
+    }
+
+    void insert_out_of_order(value_type&& value, std::true_type)
+    {
+        insert_unique(std::move(value));
+    }
+
+    void insert_out_of_order(value_type&& value, std::false_type)
+    {
+        insert_equal(std::move(value));
+    }
+
+    template <bool Unique>
+    void join(btree& other, std::integral_constant<bool, Unique>)
+    {
+        if (this == &other || other.data_.root_ == nullptr)
+        {
+            return;
+        }
+
+        if
+        (
+            data_.root_ == nullptr &&
+            !sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable::value &&
+            ref_to_node_alloc() == other.ref_to_node_alloc()
+        )
+        {
+            take_nodes(other);
+            return;
+        }
+
+        if
+        (
+            data_.root_ != nullptr &&
+            (
+                Unique
+                    ? !ref_to_comp()(key(data_.last_, data_.last_->size_ - 1), key(other.data_.first_, 0))
+                    : ref_to_comp()(key(other.data_.first_, 0), key(data_.last_, data_.last_->size_ - 1))
+            )
+        )
+        {
+            if (Unique)
+            {
+                merge_unique(other);
+            }
+            else
+            {
+                merge_equal(other);
+            }
+
+            return;
+        }
+
+        size_type n = 0;
+
+        SFL_TRY
+        {
+            for (auto it = other.begin(); it != other.end(); ++it)
+            {
+                append(std::move_if_noexcept(*it));
+                ++n;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            // Appends only added elements and nodes on the right side, so
+            // they are removed in reverse order without rebalancing.
+            other.restore_values(other.begin(), std::prev(end(), n), n);
+
+            for (; n > 0; --n)
+            {
+                undo_append();
+            }
+
+            SFL_RETHROW;
+        }
+
+        SFL_TRY
+        {
+            fix_right_spine();
+        }
+        SFL_CATCH (...)
+        {
+            const const_iterator first = std::prev(cend(), n);
+            other.restore_values(other.begin(), iterator(first.node_, first.index_), n);
+            truncate(first, n);
+            SFL_RETHROW;
+        }
+
+        other.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    //
+    // Appends copies of all elements of `other`. On exception the tree is
+    // cleared.
+    //
+    template <typename Iterator>
+    void append_all(Iterator first, Iterator last)
+    {
+        SFL_TRY
+        {
+            for (; first != last; ++first)
+            {
+                append(*first);
+            }
+
+            fix_right_spine();
+        }
+        SFL_CATCH (...)
+        {
+            clear();
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_copy(const btree& other)
+    {
+        append_all(other.begin(), other.end());
+    }
+
+    void initialize_move(btree& other)
+    {
+        initialize_move(other, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
+    }
+
+    void initialize_move(btree& other, std::true_type)
+    {
+        append_all(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    }
+
+    void initialize_move(btree& other, std::false_type)
+    {
+        initialize_move(other, std::false_type(), typename sfl::dtl::allocator_traits<node_allocator_type>::is_always_equal());
+    }
+
+    //
+    // Takes over all nodes of `other`, which is empty after the call.
+    // This tree must be empty.
+    //
+    void take_nodes(btree& other) noexcept
+    {
+        SFL_ASSERT(data_.root_ == nullptr);
+
+        data_.root_  = other.data_.root_;
+        data_.first_ = other.data_.first_;
+        data_.last_  = other.data_.last_;
+        data_.size_  = other.data_.size_;
+        other.data_.reset();
+    }
+
+    void initialize_move(btree& other, std::false_type, std::true_type)
+    {
+        take_nodes(other);
+    }
+
+    void initialize_move(btree& other, std::false_type, std::false_type)
+    {
+        if (ref_to_node_alloc() == other.ref_to_node_alloc())
+        {
+            initialize_move(other, std::false_type(), std::true_type());
+        }
+        else
+        {
+            initialize_move(other, std::true_type());
+        }
+    }
+
+    void assign_copy(const btree& other)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_copy_assignment::value)
+            {
+                ref_to_node_alloc() = other.ref_to_node_alloc();
+            }
+
+            ref_to_comp() = other.ref_to_comp();
+
+            append_all(other.begin(), other.end());
+        }
+    }
+
+    void assign_move(btree& other)
+    {
+        assign_move(other, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
+    }
+
+    void assign_move(btree& other, std::true_type)
+    {
+        clear();
+
+        if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_move_assignment::value)
+        {
+            ref_to_node_alloc() = std::move(other.ref_to_node_alloc());
+        }
+
+        ref_to_comp() = std::move(other.ref_to_comp());
+
+        append_all(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    }
+
+    void assign_move(btree& other, std::false_type)
+    {
+        assign_move(other, std::false_type(), typename sfl::dtl::allocator_traits<node_allocator_type>::is_always_equal());
+    }
+
+    void assign_move(btree& other, std::false_type, std::true_type)
+    {
+        clear();
+
+        if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_move_assignment::value)
+        {
+            ref_to_node_alloc() = std::move(other.ref_to_node_alloc());
+        }
+
+        ref_to_comp() = std::move(other.ref_to_comp());
+
+        take_nodes(other);
+    }
+
+    void assign_move(btree& other, std::false_type, std::false_type)
+    {
+        if
+        (
+            sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_move_assignment::value ||
+            ref_to_node_alloc() == other.ref_to_node_alloc()
+        )
+        {
+            assign_move(other, std::false_type(), std::true_type());
+        }
+        else
+        {
+            assign_move(other, std::true_type());
+        }
+    }
+
+    //
+    // Swaps elements one leaf at a time. Inner nodes are dropped first. Then
+    // values of leaves of both trees are alternately appended to the other
+    // tree, and every leaf is dropped as soon as it is emptied, so each tree
+    // needs at most one node more than it needs to hold its elements.
+    //
+    void swap(btree& other, std::true_type)
+    {
+        using std::swap;
+
+        node_pointer leaf_this = this->data_.first_;
+        node_pointer leaf_other = other.data_.first_;
+
+        if (this->data_.root_ != nullptr)
+        {
+            this->drop_inner_nodes(this->data_.root_);
+        }
+
+        if (other.data_.root_ != nullptr)
+        {
+            other.drop_inner_nodes(other.data_.root_);
+        }
+
+        this->data_.reset();
+        other.data_.reset();
+
+        const bool propagate = sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_swap::value;
+
+        if (propagate)
+        {
+            swap(this->ref_to_node_alloc(), other.ref_to_node_alloc());
+        }
+
+        swap(this->ref_to_comp(), other.ref_to_comp());
+
+        // Drops leaf that was allocated by `owner` before allocators were
+        // swapped.
+        struct help
+        {
+            static void drop_leaf(btree& owner, btree& peer, node_pointer x, bool propagate) noexcept
+            {
+                owner.destroy_values(x, 0, x->size_);
+
+                if
+                (
+                    propagate &&
+                    !sfl::dtl::allocator_traits<node_allocator_type>::is_storage_unpropagable
+                    (
+                        owner.ref_to_node_alloc(),
+                        x
+                    )
+                )
+                {
+                    peer.drop_node(x);
+                }
+                else
+                {
+                    owner.drop_node(x);
+                }
+            }
+        };
+
+        SFL_TRY
+        {
+            while (leaf_this != nullptr || leaf_other != nullptr)
+            {
+                if (leaf_this != nullptr)
+                {
+                    for (size_type i = 0; i < leaf_this->size_; ++i)
+                    {
+                        other.append(std::move(value(leaf_this, i)));
+                    }
+
+                    const node_pointer next_leaf = leaf_this->next_;
+                    help::drop_leaf(*this, other, leaf_this, propagate);
+                    leaf_this = next_leaf;
+                }
+
+                if (leaf_other != nullptr)
+                {
+                    for (size_type i = 0; i < leaf_other->size_; ++i)
+                    {
+                        this->append(std::move(value(leaf_other, i)));
+                    }
+
+                    const node_pointer next_leaf = leaf_other->next_;
+                    help::drop_leaf(other, *this, leaf_other, propagate);
+                    leaf_other = next_leaf;
+                }
+            }
+
+            this->fix_right_spine();
+            other.fix_right_spine();
+        }
+        SFL_CATCH (...)
+        {
+            while (leaf_this != nullptr)
+            {
+                const node_pointer next_leaf = leaf_this->next_;
+                help::drop_leaf(*this, other, leaf_this, propagate);
+                leaf_this = next_leaf;
+            }
+
+            while (leaf_other != nullptr)
+            {
+                const node_pointer next_leaf = leaf_other->next_;
+                help::drop_leaf(other, *this, leaf_other, propagate);
+                leaf_other = next_leaf;
+            }
+
+            this->clear();
+            other.clear();
+
+            SFL_RETHROW;
+        }
+    }
+
+    void swap(btree& other, std::false_type)
+    {
+        swap(other, std::false_type(), typename sfl::dtl::allocator_traits<node_allocator_type>::is_always_equal());
+    }
+
+    void swap(btree& other, std::false_type, std::true_type)
+    {
+        using std::swap;
+
+        if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_swap::value)
+        {
+            swap(ref_to_node_alloc(), other.ref_to_node_alloc());
+        }
+
+        swap(ref_to_comp(), other.ref_to_comp());
+
+        swap(data_.root_, other.data_.root_);
+        swap(data_.first_, other.data_.first_);
+        swap(data_.last_, other.data_.last_);
+        swap(data_.size_, other.data_.size_);
+    }
+
+    void swap(btree& other, std::false_type, std::false_type)
+    {
+        if
+        (
+            sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_swap::value ||
+            ref_to_node_alloc() == other.ref_to_node_alloc()
+        )
+        {
+            swap(other, std::false_type(), std::true_type());
+        }
+        else
+        {
+            swap(other, std::true_type());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    //
+    // Checks subtree `x` at depth `depth`. Keys must not be less than `lo`
+    // and not greater than `hi` (null means unbounded). Leaves are checked to
+    // follow `prev_leaf` in the leaf list. Nodes on the right spine (`spine`
+    // is true) may be underfull, see `fix_right_spine`. Returns false if
+    // subtree is not valid.
+    //
+    bool verify
+    (
+        node_pointer x,
+        node_pointer parent,
+        bool spine,
+        const key_type* lo,
+        const key_type* hi,
+        size_type depth,
+        size_type& leaf_depth,
+        node_pointer& prev_leaf,
+        size_type& count
+    ) const
+    {
+        if (x->parent_ != parent)
+        {
+            return false;
+        }
+
+        // Order must be a permutation of slots.
+        {
+            const size_type slots = x->leaf_ ? leaf_capacity : inner_capacity + 1;
+            bool seen[node_type::order_size] = {};
+
+            for (size_type i = 0; i < slots; ++i)
+            {
+                if (x->order_[i] >= slots || seen[x->order_[i]])
+                {
+                    return false;
+                }
+
+                seen[x->order_[i]] = true;
+            }
+        }
+
+        if (x->leaf_)
+        {
+            if (x->size_ > leaf_capacity)
+            {
+                return false;
+            }
+
+            if (x->size_ == 0 || (parent != nullptr && !spine && x->size_ < min_leaf_size))
+            {
+                return false;
+            }
+
+            if (leaf_depth == size_type(-1))
+            {
+                leaf_depth = depth;
+            }
+            else if (leaf_depth != depth)
+            {
+                return false;
+            }
+
+            if (x->prev_ != prev_leaf || (prev_leaf != nullptr && prev_leaf->next_ != x))
+            {
+                return false;
+            }
+
+            if (prev_leaf == nullptr && data_.first_ != x)
+            {
+                return false;
+            }
+
+            for (size_type i = 0; i < x->size_; ++i)
+            {
+                if (i > 0 && ref_to_comp()(key(x, i), key(x, i - 1)))
+                {
+                    return false;
+                }
+
+                if (lo != nullptr && ref_to_comp()(key(x, i), *lo))
+                {
+                    return false;
+                }
+
+                if (hi != nullptr && ref_to_comp()(*hi, key(x, i)))
+                {
+                    return false;
+                }
+            }
+
+            prev_leaf = x;
+            count += x->size_;
+            return true;
+        }
+
+        if (x->size_ > inner_capacity)
+        {
+            return false;
+        }
+
+        if (parent != nullptr ? !spine && x->size_ < min_inner_size : x->size_ == 0)
+        {
+            return false;
+        }
+
+        for (size_type i = 0; i < x->size_; ++i)
+        {
+            if (i > 0 && ref_to_comp()(separator(x, i), separator(x, i - 1)))
+            {
+                return false;
+            }
+        }
+
+        for (size_type i = 0; i <= x->size_; ++i)
+        {
+            const key_type* l = i == 0 ? lo : std::addressof(separator(x, i - 1));
+            const key_type* h = i == x->size_ ? hi : std::addressof(separator(x, i));
+
+            if (!verify(child(x, i), x, spine && i == x->size_, l, h, depth + 1, leaf_depth, prev_leaf, count))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool verify() const
+    {
+        if (data_.root_ == nullptr)
+        {
+            return data_.size_ == 0
+                && data_.first_ == nullptr
+                && data_.last_ == nullptr
+                && begin() == end();
+        }
+
+        size_type leaf_depth = size_type(-1);
+        node_pointer prev_leaf = nullptr;
+        size_type count = 0;
+
+        if (!verify(data_.root_, nullptr, true, nullptr, nullptr, 0, leaf_depth, prev_leaf, count))
+        {
+            return false;
+        }
+
+        return prev_leaf == data_.last_
+            && data_.last_->next_ == nullptr
+            && count == data_.size_
+            && size_type(std::distance(begin(), end())) == data_.size_;
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator,
+           typename UpperLevelContainer >
+SFL_NODISCARD
+bool operator==
+(
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+)
+{
+    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator,
+           typename UpperLevelContainer >
+SFL_NODISCARD
+bool operator!=
+(
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+)
+{
+    return !(x == y);
+}
+
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator,
+           typename UpperLevelContainer >
+SFL_NODISCARD
+bool operator<
+(
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+)
+{
+    return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator,
+           typename UpperLevelContainer >
+SFL_NODISCARD
+bool operator>
+(
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+)
+{
+    return y < x;
+}
+
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator,
+           typename UpperLevelContainer >
+SFL_NODISCARD
+bool operator<=
+(
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+)
+{
+    return !(y < x);
+}
+
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator,
+           typename UpperLevelContainer >
+SFL_NODISCARD
+bool operator>=
+(
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
+    const btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+)
+{
+    return !(x < y);
+}
+
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator,
+           typename UpperLevelContainer >
+void swap
+(
+    btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
+    btree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+)
+{
+    x.swap(y);
+}
+
+} //namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_BTREE_HPP_INCLUDED
@@ -25,7 +25,7 @@
 #include <sfl/detail/ignore_unused.hpp>
 
 #include <cstdlib>      // abort
-#include <stdexcept>    // length_error, out_of_range
+#include <stdexcept>    // invalid_argument, length_error, out_of_range
 
 namespace sfl
 {
@@ -33,6 +33,18 @@ namespace sfl
 namespace dtl
 {
 
+[[noreturn]]
+inline void throw_invalid_argument(const char* msg)
+{
+    #ifdef SFL_NO_EXCEPTIONS
+    sfl::dtl::ignore_unused(msg);
+    SFL_ASSERT(!"std::invalid_argument thrown");
+    std::abort();
+    #else
+    throw std::invalid_argument(msg);
+    #endif
+}
+
 [[noreturn]]
 inline void throw_length_error(const char* msg)
 {
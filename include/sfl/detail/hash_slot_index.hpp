@@ -0,0 +1,524 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_HASH_SLOT_INDEX_HPP_INCLUDED
+#define SFL_DETAIL_HASH_SLOT_INDEX_HPP_INCLUDED
+
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/simd_find.hpp>
+#include <sfl/detail/to_address.hpp>
+#include <sfl/detail/uninitialized_memory_algorithms.hpp>
+
+#include <algorithm>    // copy_n, fill_n
+#include <cstdint>      // uint8_t
+#include <memory>       // allocator_traits
+#include <type_traits>  // is_nothrow_default_constructible
+#include <utility>      // swap
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Hash index of elements of an unordered flat container. Elements are
+// identified by slots, i.e. positions in the contiguous storage.
+//
+// The index has three modes:
+//
+//   * `fingerprints`: used while the container holds at most `threshold`
+//     elements. The index keeps 8-bit fingerprint of hash of each element
+//     in an inline array. Lookup computes one hash, scans fingerprints
+//     and calls key equal function only for matching fingerprints.
+//
+//   * `table`: used once the container holds more than `threshold` elements.
+//     The index keeps open addressing table of slots allocated by container's
+//     allocator. Each entry holds slot plus one; zero marks empty entry.
+//     Collisions are resolved by linear probing. Entries are removed by
+//     backward shift, so there are no tombstones. Load factor is kept at or
+//     below one half.
+//
+//   * `none`: the index is out of date because hash function threw an
+//     exception. The container must find elements by linear search.
+//     The index is rebuilt once the container grows above `threshold` or
+//     becomes empty.
+//
+// Member functions that need keys of elements take callable `key_at` which
+// returns key of element at given slot.
+//
+template <typename Hash, typename Allocator>
+class hash_slot_index : public Hash
+{
+public:
+
+    using size_type = typename std::allocator_traits<Allocator>::size_type;
+
+    static constexpr size_type threshold = 16;
+
+private:
+
+    using table_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<size_type>;
+    using table_pointer   = typename std::allocator_traits<table_allocator>::pointer;
+
+    enum class index_mode : unsigned char
+    {
+        none,
+        fingerprints,
+        table
+    };
+
+    table_pointer table_;
+    size_type     capacity_;
+    index_mode    mode_;
+    std::uint8_t  fingerprints_[threshold];
+
+public:
+
+    hash_slot_index() noexcept(std::is_nothrow_default_constructible<Hash>::value)
+        : Hash()
+        , table_(nullptr)
+        , capacity_(0)
+        , mode_(index_mode::fingerprints)
+    {}
+
+    hash_slot_index(const hash_slot_index&) = delete;
+
+    hash_slot_index& operator=(const hash_slot_index&) = delete;
+
+    // Checks if elements can be found by `find`.
+    bool usable() const noexcept
+    {
+        return mode_ != index_mode::none;
+    }
+
+    template <typename K>
+    size_type hash_of(const K& key) const
+    {
+        return static_cast<const Hash&>(*this)(key);
+    }
+
+    // Releases the table. The index becomes unusable until `clear` is called.
+    void release(Allocator& alloc) noexcept
+    {
+        if (mode_ == index_mode::table)
+        {
+            table_allocator table_alloc(alloc);
+            sfl::dtl::deallocate(table_alloc, table_, capacity_);
+            table_    = nullptr;
+            capacity_ = 0;
+        }
+
+        mode_ = index_mode::none;
+    }
+
+    // Must be called once all elements have been removed from the container.
+    // The table (if any) remains allocated.
+    void clear() noexcept
+    {
+        if (mode_ == index_mode::table)
+        {
+            std::fill_n(sfl::dtl::to_address(table_), capacity_, size_type(0));
+        }
+        else
+        {
+            mode_ = index_mode::fingerprints;
+        }
+    }
+
+    // Exchanges indexes. Tables must have been allocated by equal allocators,
+    // as it is the case with element storage.
+    void swap(hash_slot_index& other) noexcept
+    {
+        using std::swap;
+        swap(table_, other.table_);
+        swap(capacity_, other.capacity_);
+        swap(mode_, other.mode_);
+        swap(fingerprints_, other.fingerprints_);
+    }
+
+    // Takes over the index of `other`. Tables must have been allocated by
+    // equal allocators. The index of `other` becomes unusable.
+    void steal(Allocator& alloc, hash_slot_index& other) noexcept
+    {
+        if (this != &other)
+        {
+            release(alloc);
+
+            table_    = other.table_;
+            capacity_ = other.capacity_;
+            mode_     = other.mode_;
+
+            std::copy_n(other.fingerprints_, threshold, fingerprints_);
+
+            other.table_    = nullptr;
+            other.capacity_ = 0;
+            other.mode_     = index_mode::none;
+        }
+    }
+
+    // Copies index of `other`. Must be called once elements of `other` have
+    // been copied or moved into this container in the same order.
+    // If allocation throws, the index becomes unusable.
+    void assign(Allocator& alloc, const hash_slot_index& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        if (other.mode_ != index_mode::table)
+        {
+            release(alloc);
+            mode_ = other.mode_;
+            std::copy_n(other.fingerprints_, threshold, fingerprints_);
+            return;
+        }
+
+        if (mode_ != index_mode::table || capacity_ != other.capacity_)
+        {
+            release(alloc);
+
+            table_allocator table_alloc(alloc);
+            table_    = sfl::dtl::allocate(table_alloc, other.capacity_);
+            capacity_ = other.capacity_;
+            mode_     = index_mode::table;
+        }
+
+        std::copy_n
+        (
+            sfl::dtl::to_address(other.table_),
+            capacity_,
+            sfl::dtl::to_address(table_)
+        );
+    }
+
+    // Must be called before the container grows to `n` elements. Allocates
+    // the table when `n` exceeds threshold and grows the table when load
+    // factor would exceed one half. First `count` elements are indexed.
+    // If this function throws, the index is unchanged.
+    template <typename KeyAt>
+    void reserve(Allocator& alloc, size_type n, size_type count, KeyAt key_at)
+    {
+        if (mode_ == index_mode::table ? n > capacity_ / 2 : n > threshold)
+        {
+            size_type new_capacity = 2 * threshold;
+
+            while (new_capacity / 2 < n)
+            {
+                new_capacity *= 2;
+            }
+
+            table_allocator table_alloc(alloc);
+
+            const table_pointer new_table = sfl::dtl::allocate(table_alloc, new_capacity);
+
+            const table_pointer old_table    = table_;
+            const size_type     old_capacity = capacity_;
+            const index_mode    old_mode     = mode_;
+
+            table_    = new_table;
+            capacity_ = new_capacity;
+            mode_     = index_mode::table;
+
+            SFL_TRY
+            {
+                std::fill_n(sfl::dtl::to_address(table_), capacity_, size_type(0));
+
+                for (size_type i = 0; i < count; ++i)
+                {
+                    insert_slot(hash_of(key_at(i)), i);
+                }
+            }
+            SFL_CATCH (...)
+            {
+                sfl::dtl::deallocate(table_alloc, new_table, new_capacity);
+                table_    = old_table;
+                capacity_ = old_capacity;
+                mode_     = old_mode;
+                SFL_RETHROW;
+            }
+
+            if (old_mode == index_mode::table)
+            {
+                sfl::dtl::deallocate(table_alloc, old_table, old_capacity);
+            }
+        }
+    }
+
+    // Indexes first `n` elements from scratch. Used after elements have been
+    // moved around. If hash function throws, the index becomes unusable.
+    template <typename KeyAt>
+    void refill(Allocator& alloc, size_type n, KeyAt key_at)
+    {
+        if (mode_ != index_mode::none)
+        {
+            SFL_TRY
+            {
+                clear();
+
+                for (size_type i = 0; i < n; ++i)
+                {
+                    insert_slot(hash_of(key_at(i)), i);
+                }
+            }
+            SFL_CATCH (...)
+            {
+                release(alloc);
+                SFL_RETHROW;
+            }
+        }
+    }
+
+    // Adds element at `slot` whose key has given hash.
+    void insert_slot(size_type hash, size_type slot) noexcept
+    {
+        if (mode_ == index_mode::fingerprints)
+        {
+            SFL_ASSERT(slot < threshold);
+            fingerprints_[slot] = fingerprint(hash);
+        }
+        else if (mode_ == index_mode::table)
+        {
+            size_type* const table = sfl::dtl::to_address(table_);
+            const size_type mask = capacity_ - 1;
+
+            size_type i = hash & mask;
+
+            while (table[i] != 0)
+            {
+                i = (i + 1) & mask;
+            }
+
+            table[i] = slot + 1;
+        }
+    }
+
+    // Returns slot of the first of `n` indexed elements with given hash
+    // for which `match(slot)` returns true, or `n` if there is no such
+    // element. Index must be usable.
+    template <typename Match>
+    size_type find(size_type hash, size_type n, Match match) const
+    {
+        SFL_ASSERT(mode_ != index_mode::none);
+
+        if (mode_ == index_mode::fingerprints)
+        {
+            SFL_ASSERT(n <= threshold);
+
+            const std::uint8_t fp = fingerprint(hash);
+            const std::uint8_t* const first = fingerprints_;
+            const std::uint8_t* const last  = fingerprints_ + n;
+
+            for
+            (
+                const std::uint8_t* p = sfl::dtl::simd_find(first, last, fp);
+                p != last;
+                p = sfl::dtl::simd_find(p + 1, last, fp)
+            )
+            {
+                if (match(size_type(p - first)))
+                {
+                    return p - first;
+                }
+            }
+
+            return n;
+        }
+
+        const size_type* const table = sfl::dtl::to_address(table_);
+        const size_type mask = capacity_ - 1;
+
+        size_type i = hash & mask;
+
+        while (table[i] != 0)
+        {
+            if (match(table[i] - 1))
+            {
+                return table[i] - 1;
+            }
+
+            i = (i + 1) & mask;
+        }
+
+        return n;
+    }
+
+    // Element at `slot` is going to be erased and element at `last_slot`
+    // is going to be moved into its place. Must be called while both elements
+    // are still in place. If hash function throws, the index becomes unusable.
+    template <typename KeyAt>
+    void erase_slot(Allocator& alloc, size_type slot, size_type last_slot, KeyAt key_at)
+    {
+        if (mode_ == index_mode::fingerprints)
+        {
+            fingerprints_[slot] = fingerprints_[last_slot];
+        }
+        else if (mode_ == index_mode::table)
+        {
+            SFL_TRY
+            {
+                remove_entry(locate_entry(hash_of(key_at(slot)), slot), key_at);
+
+                if (slot != last_slot)
+                {
+                    size_type* const table = sfl::dtl::to_address(table_);
+                    table[locate_entry(hash_of(key_at(last_slot)), last_slot)] = slot + 1;
+                }
+            }
+            SFL_CATCH (...)
+            {
+                release(alloc);
+                SFL_RETHROW;
+            }
+        }
+    }
+
+private:
+
+    // Folds all bytes of hash into one byte, so that fingerprint depends
+    // on all bits of hash and not only on bits used for table position.
+    static std::uint8_t fingerprint(size_type hash) noexcept
+    {
+        for (size_type shift = sizeof(size_type) * 4; shift >= 8; shift /= 2)
+        {
+            hash ^= hash >> shift;
+        }
+
+        return static_cast<std::uint8_t>(hash);
+    }
+
+    size_type locate_entry(size_type hash, size_type slot) const noexcept
+    {
+        const size_type* const table = sfl::dtl::to_address(table_);
+        const size_type mask = capacity_ - 1;
+
+        size_type i = hash & mask;
+
+        while (table[i] != slot + 1)
+        {
+            SFL_ASSERT(table[i] != 0);
+            i = (i + 1) & mask;
+        }
+
+        return i;
+    }
+
+    // Removes entry at position `i` and shifts following entries of the same
+    // cluster backward so that probing sequences remain unbroken.
+    template <typename KeyAt>
+    void remove_entry(size_type i, KeyAt key_at)
+    {
+        size_type* const table = sfl::dtl::to_address(table_);
+        const size_type mask = capacity_ - 1;
+
+        size_type j = i;
+
+        while (true)
+        {
+            j = (j + 1) & mask;
+
+            if (table[j] == 0)
+            {
+                break;
+            }
+
+            const size_type home = hash_of(key_at(table[j] - 1)) & mask;
+
+            // Entry at `j` must stay if its home is cyclically in (i, j].
+            const bool stays = (i <= j) ? (i < home && home <= j)
+                                        : (i < home || home <= j);
+
+            if (!stays)
+            {
+                table[i] = table[j];
+                i = j;
+            }
+        }
+
+        table[i] = 0;
+    }
+};
+
+//
+// Specialization for containers without hash function. The index is never
+// usable and elements are always found by linear search.
+//
+template <typename Allocator>
+class hash_slot_index<void, Allocator>
+{
+public:
+
+    using size_type = typename std::allocator_traits<Allocator>::size_type;
+
+    bool usable() const noexcept
+    {
+        return false;
+    }
+
+    template <typename K>
+    size_type hash_of(const K&) const noexcept
+    {
+        return 0;
+    }
+
+    void release(Allocator&) noexcept
+    {}
+
+    void clear() noexcept
+    {}
+
+    void swap(hash_slot_index&) noexcept
+    {}
+
+    void steal(Allocator&, hash_slot_index&) noexcept
+    {}
+
+    void assign(Allocator&, const hash_slot_index&) noexcept
+    {}
+
+    template <typename KeyAt>
+    void reserve(Allocator&, size_type, size_type, KeyAt) noexcept
+    {}
+
+    template <typename KeyAt>
+    void refill(Allocator&, size_type, KeyAt) noexcept
+    {}
+
+    void insert_slot(size_type, size_type) noexcept
+    {}
+
+    template <typename Match>
+    size_type find(size_type, size_type n, Match) const noexcept
+    {
+        return n;
+    }
+
+    template <typename KeyAt>
+    void erase_slot(Allocator&, size_type, size_type, KeyAt) noexcept
+    {}
+};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_HASH_SLOT_INDEX_HPP_INCLUDED
@@ -0,0 +1,1407 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_HASH_TABLE_HPP_INCLUDED
+#define SFL_DETAIL_HASH_TABLE_HPP_INCLUDED
+
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/to_address.hpp>
+#include <sfl/detail/type_traits.hpp>
+#include <sfl/detail/uninitialized_memory_algorithms.hpp>
+
+#include <algorithm>    // max, min
+#include <cstddef>      // size_t
+#include <cstdint>      // uint8_t
+#include <cstring>      // memcpy, memset
+#include <iterator>     // forward_iterator_tag
+#include <limits>       // numeric_limits
+#include <memory>       // allocator, allocator_traits, pointer_traits
+#include <type_traits>  // conditional, is_void, is_nothrow_xxxxx
+#include <utility>      // forward, move, move_if_noexcept, pair, swap
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Control bytes of open addressing hash table. Byte of occupied slot holds
+// 7-bit fingerprint of hash of the element, so the most significant bit is
+// zero. Special bytes have the most significant bit set.
+//
+struct hash_table_ctrl
+{
+    static constexpr std::uint8_t empty    = 0x80;
+    static constexpr std::uint8_t deleted  = 0xFE;
+    static constexpr std::uint8_t sentinel = 0xFF;
+
+    static bool is_full(std::uint8_t c) noexcept
+    {
+        return c < 0x80;
+    }
+
+    static bool is_free(std::uint8_t c) noexcept
+    {
+        return c == empty || c == deleted;
+    }
+};
+
+template <typename Pointer, typename Container>
+class hash_table_iterator
+{
+    template <typename, typename>
+    friend class hash_table_iterator;
+
+    friend Container;
+
+private:
+
+    const std::uint8_t* ctrl_;
+    Pointer slot_;
+
+public:
+
+    using difference_type   = typename std::pointer_traits<Pointer>::difference_type;
+    using value_type        = typename std::remove_const<typename std::pointer_traits<Pointer>::element_type>::type;
+    using pointer           = Pointer;
+    using reference         = typename std::pointer_traits<Pointer>::element_type&;
+    using iterator_category = std::forward_iterator_tag;
+
+private:
+
+    // Iterator points to the first occupied slot at or after given slot.
+    explicit hash_table_iterator(const std::uint8_t* ctrl, const Pointer& slot) noexcept
+        : ctrl_(ctrl)
+        , slot_(slot)
+    {
+        skip_free_slots();
+    }
+
+    void skip_free_slots() noexcept
+    {
+        // Sentinel byte after the last slot stops the loop.
+        while (sfl::dtl::hash_table_ctrl::is_free(*ctrl_))
+        {
+            ++ctrl_;
+            ++slot_;
+        }
+    }
+
+public:
+
+    // Default constructor
+    hash_table_iterator() noexcept
+        : ctrl_(nullptr)
+        , slot_()
+    {}
+
+    // Copy constructor
+    hash_table_iterator(const hash_table_iterator& other) noexcept
+        : ctrl_(other.ctrl_)
+        , slot_(other.slot_)
+    {}
+
+    // Converting constructor (from iterator to const_iterator)
+    template <typename OtherPointer,
+              sfl::dtl::enable_if_t<std::is_convertible<OtherPointer, Pointer>::value>* = nullptr>
+    hash_table_iterator(const hash_table_iterator<OtherPointer, Container>& other) noexcept
+        : ctrl_(other.ctrl_)
+        , slot_(other.slot_)
+    {}
+
+    // Copy assignment operator
+    hash_table_iterator& operator=(const hash_table_iterator& other) noexcept
+    {
+        ctrl_ = other.ctrl_;
+        slot_ = other.slot_;
+        return *this;
+    }
+
+    SFL_NODISCARD
+    reference operator*() const noexcept
+    {
+        return *slot_;
+    }
+
+    SFL_NODISCARD
+    pointer operator->() const noexcept
+    {
+        return slot_;
+    }
+
+    hash_table_iterator& operator++() noexcept
+    {
+        ++ctrl_;
+        ++slot_;
+        skip_free_slots();
+        return *this;
+    }
+
+    hash_table_iterator operator++(int) noexcept
+    {
+        auto temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    SFL_NODISCARD
+    friend bool operator==(const hash_table_iterator& x, const hash_table_iterator& y) noexcept
+    {
+        return x.ctrl_ == y.ctrl_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator!=(const hash_table_iterator& x, const hash_table_iterator& y) noexcept
+    {
+        return !(x == y);
+    }
+};
+
+//
+// Open addressing hash table with linear probing and control bytes.
+//
+// Slots and control bytes of the first `N` elements are stored inside the
+// table. If `Allocator` is `void`, the table never allocates memory and it
+// can hold at most `N` elements. Otherwise larger tables are allocated by
+// `Allocator`.
+//
+// Each slot has one control byte: empty, deleted or 7-bit fingerprint of
+// hash of the element. Search compares a key only if the control byte matches
+// its fingerprint, and stops at the first empty slot. Erased slots become
+// deleted (tombstones) so elements never move on erase; tombstones are reused
+// by insertion and dropped on rehash.
+//
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename Hash,
+           typename KeyEqual,
+           typename Allocator,
+           std::size_t N,
+           typename Container >
+class hash_table
+{
+    friend Container;
+
+public:
+
+    using is_static       = std::is_void<Allocator>;
+    using allocator_type  = typename std::conditional<is_static::value, std::allocator<Value>, Allocator>::type;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+    using key_type        = Key;
+    using value_type      = Value;
+    using hasher          = Hash;
+    using key_equal       = KeyEqual;
+    using size_type       = typename allocator_traits::size_type;
+    using difference_type = typename allocator_traits::difference_type;
+    using pointer         = typename allocator_traits::pointer;
+    using const_pointer   = typename allocator_traits::const_pointer;
+    using iterator        = sfl::dtl::hash_table_iterator<pointer, hash_table>;
+    using const_iterator  = sfl::dtl::hash_table_iterator<const_pointer, hash_table>;
+
+private:
+
+    using ctrl = sfl::dtl::hash_table_ctrl;
+
+    using ctrl_allocator = typename allocator_traits::template rebind_alloc<std::uint8_t>;
+    using ctrl_pointer   = typename std::allocator_traits<ctrl_allocator>::pointer;
+
+    // Number of inline slots. Maximal load factor is 7/8, so inline slots
+    // can hold `N` elements.
+    static constexpr std::size_t inline_bucket_count = N + (N + 6) / 7;
+
+    // Smallest number of allocated slots.
+    static constexpr std::size_t min_bucket_count = 8;
+
+    template <bool WithInternalStorage = true, typename = void>
+    class data_base
+    {
+    private:
+
+        union
+        {
+            value_type internal_storage_[inline_bucket_count];
+        };
+
+    public:
+
+        data_base() noexcept
+        {}
+
+        #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+        ~data_base()
+        {}
+        #else
+        ~data_base() noexcept
+        {}
+        #endif
+
+        pointer internal_storage() noexcept
+        {
+            return std::pointer_traits<pointer>::pointer_to(*internal_storage_);
+        }
+    };
+
+    template <typename Dummy>
+    class data_base<false, Dummy>
+    {
+    public:
+
+        pointer internal_storage() noexcept
+        {
+            return nullptr;
+        }
+    };
+
+    class hasher_base : public hasher
+    {
+    public:
+
+        hasher_base() noexcept(std::is_nothrow_default_constructible<hasher>::value)
+        {}
+
+        hasher_base(const hasher& h) noexcept(std::is_nothrow_copy_constructible<hasher>::value)
+            : hasher(h)
+        {}
+    };
+
+    class key_equal_base : public key_equal
+    {
+    public:
+
+        key_equal_base() noexcept(std::is_nothrow_default_constructible<key_equal>::value)
+        {}
+
+        key_equal_base(const key_equal& e) noexcept(std::is_nothrow_copy_constructible<key_equal>::value)
+            : key_equal(e)
+        {}
+    };
+
+    class data
+        : public data_base<(inline_bucket_count > 0)>
+        , public allocator_type
+        , public hasher_base
+        , public key_equal_base
+    {
+    public:
+
+        std::uint8_t internal_ctrl_[inline_bucket_count + 1];
+
+        std::uint8_t* ctrl_;
+        pointer       slots_;
+        size_type     bucket_count_;
+        size_type     size_;
+        size_type     deleted_;
+
+        data() noexcept
+        (
+            std::is_nothrow_default_constructible<allocator_type>::value &&
+            std::is_nothrow_default_constructible<hasher>::value &&
+            std::is_nothrow_default_constructible<key_equal>::value
+        )
+        {
+            initialize();
+        }
+
+        data(const hasher& h, const key_equal& e, const allocator_type& a) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_copy_constructible<hasher>::value &&
+            std::is_nothrow_copy_constructible<key_equal>::value
+        )
+            : allocator_type(a)
+            , hasher_base(h)
+            , key_equal_base(e)
+        {
+            initialize();
+        }
+
+        data(const hasher& h, const key_equal& e, allocator_type&& a) noexcept
+        (
+            std::is_nothrow_move_constructible<allocator_type>::value &&
+            std::is_nothrow_copy_constructible<hasher>::value &&
+            std::is_nothrow_copy_constructible<key_equal>::value
+        )
+            : allocator_type(std::move(a))
+            , hasher_base(h)
+            , key_equal_base(e)
+        {
+            initialize();
+        }
+
+        void initialize() noexcept
+        {
+            std::memset(internal_ctrl_, ctrl::empty, inline_bucket_count);
+            internal_ctrl_[inline_bucket_count] = ctrl::sentinel;
+
+            ctrl_         = internal_ctrl_;
+            slots_        = this->internal_storage();
+            bucket_count_ = inline_bucket_count;
+            size_         = 0;
+            deleted_      = 0;
+        }
+
+        allocator_type& ref_to_alloc() noexcept
+        {
+            return *this;
+        }
+
+        const allocator_type& ref_to_alloc() const noexcept
+        {
+            return *this;
+        }
+
+        hasher& ref_to_hash() noexcept
+        {
+            return *this;
+        }
+
+        const hasher& ref_to_hash() const noexcept
+        {
+            return *this;
+        }
+
+        key_equal& ref_to_equal() noexcept
+        {
+            return *this;
+        }
+
+        const key_equal& ref_to_equal() const noexcept
+        {
+            return *this;
+        }
+    };
+
+    data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    hash_table() noexcept(std::is_nothrow_default_constructible<data>::value)
+        : data_()
+    {}
+
+    hash_table(const hasher& h, const key_equal& e, const allocator_type& a)
+        : data_(h, e, a)
+    {}
+
+    hash_table(const hash_table& other)
+        : data_
+        (
+            other.data_.ref_to_hash(),
+            other.data_.ref_to_equal(),
+            allocator_traits::select_on_container_copy_construction(other.data_.ref_to_alloc())
+        )
+    {
+        initialize_copy(other);
+    }
+
+    hash_table(const hash_table& other, const allocator_type& a)
+        : data_(other.data_.ref_to_hash(), other.data_.ref_to_equal(), a)
+    {
+        initialize_copy(other);
+    }
+
+    hash_table(hash_table&& other)
+        : data_
+        (
+            other.data_.ref_to_hash(),
+            other.data_.ref_to_equal(),
+            std::move(other.data_.ref_to_alloc())
+        )
+    {
+        take_contents(other);
+    }
+
+    hash_table(hash_table&& other, const allocator_type& a)
+        : data_(other.data_.ref_to_hash(), other.data_.ref_to_equal(), a)
+    {
+        if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            take_contents(other);
+        }
+        else
+        {
+            initialize_move(other);
+        }
+    }
+
+    ~hash_table()
+    {
+        clear();
+        deallocate_storage();
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    hash_table& operator=(const hash_table& other)
+    {
+        assign_copy(other);
+        return *this;
+    }
+
+    hash_table& operator=(hash_table&& other)
+    {
+        assign_move(other);
+        return *this;
+    }
+
+    //
+    // ---- OBSERVERS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    allocator_type& ref_to_alloc() noexcept
+    {
+        return data_.ref_to_alloc();
+    }
+
+    SFL_NODISCARD
+    const allocator_type& ref_to_alloc() const noexcept
+    {
+        return data_.ref_to_alloc();
+    }
+
+    SFL_NODISCARD
+    const hasher& ref_to_hash() const noexcept
+    {
+        return data_.ref_to_hash();
+    }
+
+    SFL_NODISCARD
+    const key_equal& ref_to_equal() const noexcept
+    {
+        return data_.ref_to_equal();
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return iterator(data_.ctrl_, data_.slots_);
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(data_.ctrl_, data_.slots_);
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return iterator
+        (
+            data_.ctrl_ + data_.bucket_count_,
+            data_.slots_ + data_.bucket_count_
+        );
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return const_iterator
+        (
+            data_.ctrl_ + data_.bucket_count_,
+            data_.slots_ + data_.bucket_count_
+        );
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return max_size(is_static());
+    }
+
+    SFL_NODISCARD
+    size_type capacity() const noexcept
+    {
+        return is_static::value ? size_type(N) : max_load(data_.bucket_count_);
+    }
+
+    SFL_NODISCARD
+    size_type bucket_count() const noexcept
+    {
+        return data_.bucket_count_;
+    }
+
+    void reserve(size_type new_cap)
+    {
+        if (new_cap > capacity())
+        {
+            rehash_to(bucket_count_for(new_cap, data_.bucket_count_));
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        if (is_inline())
+        {
+            return;
+        }
+
+        if (data_.size_ <= max_load(inline_bucket_count))
+        {
+            rehash_to(inline_bucket_count);
+        }
+        else
+        {
+            const size_type new_bucket_count = bucket_count_for(data_.size_, 0);
+
+            if (new_bucket_count < data_.bucket_count_)
+            {
+                rehash_to(new_bucket_count);
+            }
+        }
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        if (data_.size_ != 0)
+        {
+            for (size_type i = 0; i != data_.bucket_count_; ++i)
+            {
+                if (ctrl::is_full(data_.ctrl_[i]))
+                {
+                    sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.slots_ + i);
+                }
+            }
+        }
+
+        std::memset(data_.ctrl_, ctrl::empty, data_.bucket_count_);
+
+        data_.size_    = 0;
+        data_.deleted_ = 0;
+    }
+
+    //
+    // Constructs new element from `args` if table doesn't contain element with
+    // key equal to `key`. Arguments are not used if such element exists.
+    //
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> emplace_with_key(const K& key, Args&&... args)
+    {
+        const insert_position ip = find_or_prepare_insert(key);
+
+        if (ip.found)
+        {
+            return std::make_pair(make_iterator(ip.pos), false);
+        }
+
+        sfl::dtl::construct_at_a
+        (
+            data_.ref_to_alloc(),
+            data_.slots_ + ip.pos,
+            std::forward<Args>(args)...
+        );
+
+        if (data_.ctrl_[ip.pos] == ctrl::deleted)
+        {
+            --data_.deleted_;
+        }
+
+        data_.ctrl_[ip.pos] = ip.fingerprint;
+
+        ++data_.size_;
+
+        return std::make_pair(make_iterator(ip.pos), true);
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> insert_unique(V&& value)
+    {
+        return emplace_with_key(KeyOfValue()(value), std::forward<V>(value));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace_unique(Args&&... args)
+    {
+        // Key is unknown until element is constructed.
+        value_type temp(std::forward<Args>(args)...);
+        return emplace_with_key(KeyOfValue()(temp), std::move(temp));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        const size_type i = index_of(pos);
+
+        SFL_ASSERT(i < data_.bucket_count_ && ctrl::is_full(data_.ctrl_[i]));
+
+        erase_at(i);
+
+        return make_iterator(i);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        while (first != last)
+        {
+            first = erase(first);
+        }
+
+        return make_iterator(index_of(last));
+    }
+
+    template <typename K>
+    size_type erase_key(const K& key)
+    {
+        const size_type i = find_position(key);
+
+        if (i == data_.bucket_count_)
+        {
+            return 0;
+        }
+
+        erase_at(i);
+
+        return 1;
+    }
+
+    void swap(hash_table& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        using std::swap;
+
+        SFL_ASSERT
+        (
+            allocator_traits::propagate_on_container_swap::value ||
+            this->data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        );
+
+        swap(this->data_.ref_to_hash(), other.data_.ref_to_hash());
+        swap(this->data_.ref_to_equal(), other.data_.ref_to_equal());
+
+        if (!this->is_inline() && !other.is_inline())
+        {
+            swap(this->data_.ctrl_,         other.data_.ctrl_);
+            swap(this->data_.slots_,        other.data_.slots_);
+            swap(this->data_.bucket_count_, other.data_.bucket_count_);
+            swap(this->data_.size_,         other.data_.size_);
+            swap(this->data_.deleted_,      other.data_.deleted_);
+        }
+        else
+        {
+            // Contents are exchanged through temporary table. Each allocated
+            // storage ends up with the allocator that allocated it, so
+            // allocators are swapped afterwards.
+            hash_table temp(this->data_.ref_to_hash(), this->data_.ref_to_equal(), this->data_.ref_to_alloc());
+            temp.take_contents(*this);
+            this->take_contents(other);
+            other.take_contents(temp);
+        }
+
+        if (allocator_traits::propagate_on_container_swap::value)
+        {
+            swap(this->data_.ref_to_alloc(), other.data_.ref_to_alloc());
+        }
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    template <typename K>
+    SFL_NODISCARD
+    iterator find(const K& key)
+    {
+        return make_iterator(find_position(key));
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    const_iterator find(const K& key) const
+    {
+        return make_iterator(find_position(key));
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    size_type count(const K& key) const
+    {
+        return find_position(key) != data_.bucket_count_;
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    bool contains(const K& key) const
+    {
+        return find_position(key) != data_.bucket_count_;
+    }
+
+private:
+
+    struct insert_position
+    {
+        size_type    pos;
+        std::uint8_t fingerprint;
+        bool         found;
+    };
+
+    static constexpr size_type max_load(size_type bucket_count) noexcept
+    {
+        return bucket_count - bucket_count / 8;
+    }
+
+    // Fibonacci hashing spreads weak hashes (such as identity) over all bits.
+    static std::size_t mix(std::size_t h) noexcept
+    {
+        h *= static_cast<std::size_t>(0x9E3779B97F4A7C15ull);
+        return h ^ (h >> (std::numeric_limits<std::size_t>::digits / 2));
+    }
+
+    static std::uint8_t fingerprint(std::size_t h) noexcept
+    {
+        return static_cast<std::uint8_t>(h >> (std::numeric_limits<std::size_t>::digits - 7));
+    }
+
+    template <typename K>
+    std::size_t hash_of(const K& key) const
+    {
+        return mix(data_.ref_to_hash()(key));
+    }
+
+    size_type next(size_type i) const noexcept
+    {
+        return i + 1 == data_.bucket_count_ ? 0 : i + 1;
+    }
+
+    size_type prev(size_type i) const noexcept
+    {
+        return i == 0 ? data_.bucket_count_ - 1 : i - 1;
+    }
+
+    iterator make_iterator(size_type i) noexcept
+    {
+        return iterator(data_.ctrl_ + i, data_.slots_ + i);
+    }
+
+    const_iterator make_iterator(size_type i) const noexcept
+    {
+        return const_iterator(data_.ctrl_ + i, data_.slots_ + i);
+    }
+
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        return pos.ctrl_ - data_.ctrl_;
+    }
+
+    bool is_inline() const noexcept
+    {
+        return data_.ctrl_ == data_.internal_ctrl_;
+    }
+
+    size_type max_size(std::true_type) const noexcept
+    {
+        return N;
+    }
+
+    size_type max_size(std::false_type) const noexcept
+    {
+        return max_load(max_bucket_count());
+    }
+
+    size_type max_bucket_count() const noexcept
+    {
+        return std::min<size_type>
+        (
+            allocator_traits::max_size(data_.ref_to_alloc()),
+            std::numeric_limits<difference_type>::max() / sizeof(value_type)
+        ) - 1;
+    }
+
+    // Returns position of element with given key, or `bucket_count()` if
+    // there is no such element.
+    template <typename K>
+    size_type find_position(const K& key) const
+    {
+        const size_type bucket_count = data_.bucket_count_;
+
+        if (data_.size_ == 0)
+        {
+            return bucket_count;
+        }
+
+        const std::size_t h = hash_of(key);
+        const std::uint8_t fp = fingerprint(h);
+
+        size_type i = h % bucket_count;
+
+        for (size_type n = 0; n != bucket_count; ++n)
+        {
+            const std::uint8_t c = data_.ctrl_[i];
+
+            if (c == fp && data_.ref_to_equal()(KeyOfValue()(*(data_.slots_ + i)), key))
+            {
+                return i;
+            }
+
+            if (c == ctrl::empty)
+            {
+                break;
+            }
+
+            i = next(i);
+        }
+
+        return bucket_count;
+    }
+
+    // Finds element with given key. If there is no such element, finds free
+    // slot for new element, rehashing the table if necessary.
+    template <typename K>
+    insert_position find_or_prepare_insert(const K& key)
+    {
+        const std::size_t h = hash_of(key);
+        const std::uint8_t fp = fingerprint(h);
+
+        size_type free = data_.bucket_count_;
+
+        if (data_.bucket_count_ != 0)
+        {
+            size_type i = h % data_.bucket_count_;
+
+            for (size_type n = 0; n != data_.bucket_count_; ++n)
+            {
+                const std::uint8_t c = data_.ctrl_[i];
+
+                if (c == fp && data_.ref_to_equal()(KeyOfValue()(*(data_.slots_ + i)), key))
+                {
+                    return insert_position{i, fp, true};
+                }
+
+                if (c == ctrl::deleted)
+                {
+                    if (free == data_.bucket_count_)
+                    {
+                        free = i;
+                    }
+                }
+                else if (c == ctrl::empty)
+                {
+                    if (free == data_.bucket_count_)
+                    {
+                        free = i;
+                    }
+                    break;
+                }
+
+                i = next(i);
+            }
+        }
+
+        // Reusing deleted slot doesn't increase load.
+        if
+        (
+            free == data_.bucket_count_ ||
+            (data_.ctrl_[free] == ctrl::empty && needs_rehash_for_insert())
+        )
+        {
+            rehash_for_insert();
+
+            free = h % data_.bucket_count_;
+
+            while (!ctrl::is_free(data_.ctrl_[free]))
+            {
+                free = next(free);
+            }
+        }
+
+        return insert_position{free, fp, false};
+    }
+
+    bool needs_rehash_for_insert() const noexcept
+    {
+        if (is_static::value)
+        {
+            return false;
+        }
+
+        // Inline slots are never rehashed in place, so deleted slots are
+        // counted only in allocated tables.
+        return data_.size_ + 1 > capacity() ||
+               (!is_inline() && data_.size_ + data_.deleted_ + 1 > max_load(data_.bucket_count_));
+    }
+
+    void rehash_for_insert()
+    {
+        SFL_ASSERT(!is_static::value);
+
+        const size_type n = data_.size_ + 1;
+
+        // If table would be more than half full after dropping deleted slots,
+        // it is grown, otherwise it is rebuilt with the same bucket count.
+        rehash_to
+        (
+            bucket_count_for
+            (
+                n > max_load(data_.bucket_count_) / 2 ? max_load(data_.bucket_count_) + 1 : n,
+                data_.bucket_count_
+            )
+        );
+    }
+
+    // Returns the smallest bucket count of allocated table that can hold `n`
+    // elements, starting from `start` and doubling.
+    size_type bucket_count_for(size_type n, size_type start) const
+    {
+        const size_type max_count = max_bucket_count();
+
+        if (n > max_load(max_count))
+        {
+            sfl::dtl::throw_length_error("sfl::dtl::hash_table::rehash");
+        }
+
+        size_type count = std::max(start, size_type(min_bucket_count));
+
+        while (max_load(count) < n)
+        {
+            count = count > max_count / 2 ? max_count : count * 2;
+        }
+
+        return count;
+    }
+
+    //
+    // Moves all elements into new table with given bucket count. Inline slots
+    // are used if `new_bucket_count` is equal to number of inline slots.
+    // If this function throws, the table is unchanged.
+    //
+    void rehash_to(size_type new_bucket_count)
+    {
+        SFL_ASSERT(!is_static::value);
+        SFL_ASSERT(new_bucket_count >= data_.size_);
+
+        const bool to_inline =
+            new_bucket_count == inline_bucket_count && !is_inline();
+
+        ctrl_allocator ctrl_alloc(data_.ref_to_alloc());
+
+        std::uint8_t* new_ctrl;
+        pointer new_slots;
+
+        if (to_inline)
+        {
+            new_ctrl  = data_.internal_ctrl_;
+            new_slots = data_.internal_storage();
+        }
+        else
+        {
+            new_ctrl = sfl::dtl::to_address(sfl::dtl::allocate(ctrl_alloc, new_bucket_count + 1));
+
+            SFL_TRY
+            {
+                new_slots = sfl::dtl::allocate(data_.ref_to_alloc(), new_bucket_count);
+            }
+            SFL_CATCH (...)
+            {
+                deallocate_ctrl(ctrl_alloc, new_ctrl, new_bucket_count);
+                SFL_RETHROW;
+            }
+
+            std::memset(new_ctrl, ctrl::empty, new_bucket_count);
+            new_ctrl[new_bucket_count] = ctrl::sentinel;
+        }
+
+        SFL_TRY
+        {
+            for (size_type i = 0; i != data_.bucket_count_; ++i)
+            {
+                if (ctrl::is_full(data_.ctrl_[i]))
+                {
+                    const pointer p = data_.slots_ + i;
+
+                    const std::size_t h = hash_of(KeyOfValue()(*p));
+
+                    size_type j = h % new_bucket_count;
+
+                    while (new_ctrl[j] != ctrl::empty)
+                    {
+                        j = j + 1 == new_bucket_count ? 0 : j + 1;
+                    }
+
+                    sfl::dtl::construct_at_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_slots + j,
+                        std::move_if_noexcept(*p)
+                    );
+
+                    new_ctrl[j] = fingerprint(h);
+                }
+            }
+        }
+        SFL_CATCH (...)
+        {
+            for (size_type j = 0; j != new_bucket_count; ++j)
+            {
+                if (ctrl::is_full(new_ctrl[j]))
+                {
+                    sfl::dtl::destroy_at_a(data_.ref_to_alloc(), new_slots + j);
+                }
+            }
+
+            if (to_inline)
+            {
+                std::memset(new_ctrl, ctrl::empty, new_bucket_count);
+            }
+            else
+            {
+                sfl::dtl::deallocate(data_.ref_to_alloc(), new_slots, new_bucket_count);
+                deallocate_ctrl(ctrl_alloc, new_ctrl, new_bucket_count);
+            }
+
+            SFL_RETHROW;
+        }
+
+        const size_type size = data_.size_;
+
+        clear();
+        deallocate_storage();
+
+        data_.ctrl_         = new_ctrl;
+        data_.slots_        = new_slots;
+        data_.bucket_count_ = new_bucket_count;
+        data_.size_         = size;
+        data_.deleted_      = 0;
+    }
+
+    // Removes element at position `i`. Elements never move.
+    void erase_at(size_type i) noexcept
+    {
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.slots_ + i);
+
+        --data_.size_;
+
+        if (data_.ctrl_[next(i)] == ctrl::empty)
+        {
+            // Search stops at the next empty slot anyway, so this slot and
+            // deleted slots before it can become empty.
+            data_.ctrl_[i] = ctrl::empty;
+
+            for (size_type j = prev(i); data_.ctrl_[j] == ctrl::deleted; j = prev(j))
+            {
+                data_.ctrl_[j] = ctrl::empty;
+                --data_.deleted_;
+            }
+        }
+        else
+        {
+            data_.ctrl_[i] = ctrl::deleted;
+            ++data_.deleted_;
+        }
+    }
+
+    static void deallocate_ctrl(ctrl_allocator& ctrl_alloc, std::uint8_t* p, size_type bucket_count) noexcept
+    {
+        sfl::dtl::deallocate
+        (
+            ctrl_alloc,
+            std::pointer_traits<ctrl_pointer>::pointer_to(*p),
+            bucket_count + 1
+        );
+    }
+
+    // Deallocates allocated storage and switches to inline slots. The table
+    // must be empty.
+    void deallocate_storage() noexcept
+    {
+        SFL_ASSERT(data_.size_ == 0);
+
+        if (!is_inline())
+        {
+            ctrl_allocator ctrl_alloc(data_.ref_to_alloc());
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.slots_, data_.bucket_count_);
+            deallocate_ctrl(ctrl_alloc, data_.ctrl_, data_.bucket_count_);
+
+            data_.ctrl_         = data_.internal_ctrl_;
+            data_.slots_        = data_.internal_storage();
+            data_.bucket_count_ = inline_bucket_count;
+            data_.deleted_      = 0;
+        }
+    }
+
+    // Allocates storage with the same bucket count as `other`. The table
+    // must be empty and use inline slots.
+    void allocate_storage_like(const hash_table& other)
+    {
+        SFL_ASSERT(data_.size_ == 0 && is_inline());
+
+        if (!other.is_inline())
+        {
+            const size_type bucket_count = other.data_.bucket_count_;
+
+            ctrl_allocator ctrl_alloc(data_.ref_to_alloc());
+
+            std::uint8_t* const new_ctrl =
+                sfl::dtl::to_address(sfl::dtl::allocate(ctrl_alloc, bucket_count + 1));
+
+            SFL_TRY
+            {
+                data_.slots_ = sfl::dtl::allocate(data_.ref_to_alloc(), bucket_count);
+            }
+            SFL_CATCH (...)
+            {
+                data_.slots_ = data_.internal_storage();
+                deallocate_ctrl(ctrl_alloc, new_ctrl, bucket_count);
+                SFL_RETHROW;
+            }
+
+            std::memset(new_ctrl, ctrl::empty, bucket_count);
+            new_ctrl[bucket_count] = ctrl::sentinel;
+
+            data_.ctrl_         = new_ctrl;
+            data_.bucket_count_ = bucket_count;
+        }
+    }
+
+    //
+    // Copies or moves elements of `other` into the same slots. The table must
+    // be empty and have the same bucket count as `other`. If this function
+    // throws, the table is empty.
+    //
+    template <typename Other>
+    void construct_layout(Other& other)
+    {
+        SFL_ASSERT(data_.size_ == 0 && data_.bucket_count_ == other.data_.bucket_count_);
+
+        SFL_TRY
+        {
+            for (size_type i = 0; i != data_.bucket_count_; ++i)
+            {
+                const std::uint8_t c = other.data_.ctrl_[i];
+
+                if (ctrl::is_full(c))
+                {
+                    sfl::dtl::construct_at_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.slots_ + i,
+                        element_ref(other, i)
+                    );
+
+                    ++data_.size_;
+                }
+
+                data_.ctrl_[i] = c;
+            }
+
+            data_.deleted_ = other.data_.deleted_;
+        }
+        SFL_CATCH (...)
+        {
+            // Control byte is copied after the element is constructed, so
+            // only constructed elements are destroyed.
+            clear();
+            SFL_RETHROW;
+        }
+    }
+
+    static const value_type& element_ref(const hash_table& other, size_type i) noexcept
+    {
+        return *(other.data_.slots_ + i);
+    }
+
+    static value_type&& element_ref(hash_table& other, size_type i) noexcept
+    {
+        return std::move(*(other.data_.slots_ + i));
+    }
+
+    void initialize_copy(const hash_table& other)
+    {
+        allocate_storage_like(other);
+
+        SFL_TRY
+        {
+            construct_layout(other);
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+    // Moves elements of `other` one by one. Allocators are not equal.
+    void initialize_move(hash_table& other)
+    {
+        allocate_storage_like(other);
+
+        SFL_TRY
+        {
+            construct_layout(other);
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+
+        other.clear();
+    }
+
+    //
+    // Takes elements of `other`, which is left empty. Allocated storage of
+    // `other` is taken over, so allocators must be equal (or they will be
+    // swapped by the caller). The table must be empty and use inline slots.
+    //
+    void take_contents(hash_table& other)
+    {
+        SFL_ASSERT(data_.size_ == 0 && is_inline());
+
+        if (!other.is_inline())
+        {
+            data_.ctrl_         = other.data_.ctrl_;
+            data_.slots_        = other.data_.slots_;
+            data_.bucket_count_ = other.data_.bucket_count_;
+            data_.size_         = other.data_.size_;
+            data_.deleted_      = other.data_.deleted_;
+
+            other.data_.ctrl_         = other.data_.internal_ctrl_;
+            other.data_.slots_        = other.data_.internal_storage();
+            other.data_.bucket_count_ = inline_bucket_count;
+            other.data_.size_         = 0;
+            other.data_.deleted_      = 0;
+        }
+        else
+        {
+            construct_layout(other);
+            other.clear();
+        }
+    }
+
+    void assign_copy(const hash_table& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        clear();
+
+        if
+        (
+            allocator_traits::propagate_on_container_copy_assignment::value &&
+            data_.ref_to_alloc() != other.data_.ref_to_alloc()
+        )
+        {
+            deallocate_storage();
+        }
+
+        if (allocator_traits::propagate_on_container_copy_assignment::value)
+        {
+            data_.ref_to_alloc() = other.data_.ref_to_alloc();
+        }
+
+        data_.ref_to_hash()  = other.data_.ref_to_hash();
+        data_.ref_to_equal() = other.data_.ref_to_equal();
+
+        if (data_.bucket_count_ != other.data_.bucket_count_)
+        {
+            deallocate_storage();
+            allocate_storage_like(other);
+        }
+
+        construct_layout(other);
+    }
+
+    void assign_move(hash_table& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        clear();
+
+        if
+        (
+            allocator_traits::propagate_on_container_move_assignment::value ||
+            data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        )
+        {
+            deallocate_storage();
+
+            if (allocator_traits::propagate_on_container_move_assignment::value)
+            {
+                data_.ref_to_alloc() = std::move(other.data_.ref_to_alloc());
+            }
+
+            data_.ref_to_hash()  = other.data_.ref_to_hash();
+            data_.ref_to_equal() = other.data_.ref_to_equal();
+
+            take_contents(other);
+        }
+        else
+        {
+            data_.ref_to_hash()  = other.data_.ref_to_hash();
+            data_.ref_to_equal() = other.data_.ref_to_equal();
+
+            if (data_.bucket_count_ != other.data_.bucket_count_)
+            {
+                deallocate_storage();
+                allocate_storage_like(other);
+            }
+
+            construct_layout(other);
+
+            other.clear();
+        }
+    }
+};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_HASH_TABLE_HPP_INCLUDED
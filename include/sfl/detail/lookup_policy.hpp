@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_LOOKUP_POLICY_HPP_INCLUDED
+#define SFL_DETAIL_LOOKUP_POLICY_HPP_INCLUDED
+
+#include <algorithm>    // iter_swap, rotate
+#include <iterator>     // next, prev
+
+namespace sfl
+{
+
+//
+// Lookup policies of unordered flat containers. Policy decides what happens
+// with an element found by non-const lookup. Since order of elements in
+// unordered containers is unspecified, policy may move frequently accessed
+// elements towards the front so that subsequent linear searches for them end
+// earlier.
+//
+// Policy has static member function `on_hit(first, pos)` which gets iterator
+// to the first element and iterator to the found element. It reorders
+// elements and returns iterator to the new position of the found element.
+//
+
+// Lookup policy that never reorders elements. This is the default.
+struct lookup_keep_order
+{
+    template <typename RandomIt>
+    static RandomIt on_hit(RandomIt first, RandomIt pos)
+    {
+        (void)first;
+        return pos;
+    }
+};
+
+// Lookup policy that moves found element to the front. Elements in front
+// of it move one position back.
+struct lookup_move_to_front
+{
+    template <typename RandomIt>
+    static RandomIt on_hit(RandomIt first, RandomIt pos)
+    {
+        std::rotate(first, pos, std::next(pos));
+        return first;
+    }
+};
+
+// Lookup policy that swaps found element with its predecessor.
+struct lookup_transpose
+{
+    template <typename RandomIt>
+    static RandomIt on_hit(RandomIt first, RandomIt pos)
+    {
+        if (pos != first)
+        {
+            std::iter_swap(pos, std::prev(pos));
+            --pos;
+        }
+
+        return pos;
+    }
+};
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_LOOKUP_POLICY_HPP_INCLUDED
@@ -391,8 +391,307 @@ public:
     }
 };
 
+//
+// Node allocator that carves nodes out of geometrically growing slabs
+// obtained from BaseAllocator. Deallocated nodes are kept in a free list and
+// reused by later allocations. Slabs are returned to BaseAllocator only when
+// the allocator is destroyed.
+//
+// Every node lives in storage owned by this particular allocator object, so
+// nodes are never propagated between containers (same as nodes allocated from
+// the internal pool of node_small_allocator).
+//
+template <typename T, typename BaseAllocator = std::allocator<T>>
+class node_slab_allocator : public BaseAllocator
+{
+    static_assert
+    (
+        std::is_same<typename BaseAllocator::value_type, T>::value,
+        "BaseAllocator::value_type must be same as T."
+    );
+
+    template <typename, typename>
+    friend class node_slab_allocator;
+
+private:
+
+    using base_allocator_type = BaseAllocator;
+
+    union element
+    {
+    public:
+
+        element* next_;
+
+        struct
+        {
+            element*    next_;
+            std::size_t size_;
+        } slab_;
+
+        T value_;
+
+    public:
+
+        element() noexcept
+        {}
+
+        element(const element& other) = delete;
+
+        element(element&& other) = delete;
+
+        element& operator=(const element& other) = delete;
+
+        element& operator=(element&& other) = delete;
+
+        ~element() noexcept
+        {}
+    };
+
+    using slab_allocator_type = typename sfl::dtl::allocator_traits<base_allocator_type>::template rebind_alloc<element>;
+
+    using slab_pointer = typename sfl::dtl::allocator_traits<slab_allocator_type>::pointer;
+
+    static constexpr std::size_t first_slab_size = 16;
+
+    static constexpr std::size_t max_slab_size = 65536;
+
+public:
+
+    using value_type         = T;
+    using pointer            = typename sfl::dtl::allocator_traits<base_allocator_type>::pointer;
+    using const_pointer      = typename sfl::dtl::allocator_traits<base_allocator_type>::const_pointer;
+    using void_pointer       = typename sfl::dtl::allocator_traits<base_allocator_type>::void_pointer;
+    using const_void_pointer = typename sfl::dtl::allocator_traits<base_allocator_type>::const_void_pointer;
+    using reference          = T&;
+    using const_reference    = const T&;
+    using size_type          = std::size_t;
+    using difference_type    = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = typename sfl::dtl::allocator_traits<base_allocator_type>::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = typename sfl::dtl::allocator_traits<base_allocator_type>::propagate_on_container_move_assignment;
+    using propagate_on_container_swap            = typename sfl::dtl::allocator_traits<base_allocator_type>::propagate_on_container_swap;
+    using is_always_equal                        = typename sfl::dtl::allocator_traits<base_allocator_type>::is_always_equal;
+    using is_partially_propagable                = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = node_slab_allocator
+        <
+            U,
+            typename sfl::dtl::allocator_traits<base_allocator_type>::template rebind_alloc<U>
+        >;
+    };
+
+private:
+
+    SFL_NODISCARD
+    base_allocator_type& base() noexcept
+    {
+        return *static_cast<base_allocator_type*>(this);
+    }
+
+    SFL_NODISCARD
+    const base_allocator_type& base() const noexcept
+    {
+        return *static_cast<const base_allocator_type*>(this);
+    }
+
+private:
+
+    // Singly linked list of deallocated elements.
+    element* free_ = nullptr;
+
+    // Range of never allocated elements in the most recent slab.
+    element* first_ = nullptr;
+    element* last_ = nullptr;
+
+    // Singly linked list of slabs. The first element of every slab holds
+    // the link to the next slab and the number of elements in the slab.
+    element* slabs_ = nullptr;
+
+    size_type next_slab_size_ = first_slab_size;
+
+public:
+
+    node_slab_allocator() noexcept(std::is_nothrow_default_constructible<base_allocator_type>::value)
+    {}
+
+    node_slab_allocator(const node_slab_allocator& other) noexcept
+        : base_allocator_type(other.base())
+    {}
+
+    node_slab_allocator(node_slab_allocator&& other) noexcept
+        : base_allocator_type(std::move(other.base()))
+    {}
+
+    template <typename T2, typename Allocator2>
+    node_slab_allocator(const node_slab_allocator<T2, Allocator2>& other) noexcept
+        : base_allocator_type(other.base())
+    {}
+
+    template <typename T2, typename Allocator2>
+    node_slab_allocator(node_slab_allocator<T2, Allocator2>&& other) noexcept
+        : base_allocator_type(std::move(other.base()))
+    {}
+
+    explicit node_slab_allocator(const base_allocator_type& other) noexcept
+        : base_allocator_type(other)
+    {}
+
+    explicit node_slab_allocator(base_allocator_type&& other) noexcept
+        : base_allocator_type(std::move(other))
+    {}
+
+    ~node_slab_allocator() noexcept
+    {
+        slab_allocator_type a(base());
+
+        while (slabs_ != nullptr)
+        {
+            element* slab = slabs_;
+
+            slabs_ = slab->slab_.next_;
+
+            sfl::dtl::allocator_traits<slab_allocator_type>::deallocate
+            (
+                a,
+                std::pointer_traits<slab_pointer>::pointer_to(*slab),
+                slab->slab_.size_
+            );
+        }
+    }
+
+    node_slab_allocator& operator=(const node_slab_allocator& other) noexcept
+    {
+        base_allocator_type::operator=(other.base());
+        return *this;
+    }
+
+    node_slab_allocator& operator=(node_slab_allocator&& other) noexcept
+    {
+        base_allocator_type::operator=(std::move(other.base()));
+        return *this;
+    }
+
+    template <typename T2, typename Allocator2>
+    node_slab_allocator& operator=(const node_slab_allocator<T2, Allocator2>& other) noexcept
+    {
+        base_allocator_type::operator=(other.base());
+        return *this;
+    }
+
+    template <typename T2, typename Allocator2>
+    node_slab_allocator& operator=(node_slab_allocator<T2, Allocator2>&& other) noexcept
+    {
+        base_allocator_type::operator=(std::move(other.base()));
+        return *this;
+    }
+
+    node_slab_allocator& operator=(const base_allocator_type& other) noexcept
+    {
+        base_allocator_type::operator=(other);
+        return *this;
+    }
+
+    node_slab_allocator& operator=(base_allocator_type&& other) noexcept
+    {
+        base_allocator_type::operator=(std::move(other));
+        return *this;
+    }
+
+    SFL_NODISCARD
+    pointer allocate(size_type n)
+    {
+        SFL_ASSERT(n == 1);
+
+        sfl::dtl::ignore_unused(n);
+
+        element* p;
+
+        if (free_ != nullptr)
+        {
+            p = free_;
+            free_ = p->next_;
+        }
+        else
+        {
+            if (first_ == last_)
+            {
+                grow();
+            }
+
+            p = first_++;
+        }
+
+        return std::pointer_traits<pointer>::pointer_to(p->value_);
+    }
+
+    SFL_NODISCARD
+    pointer allocate(size_type n, const void* /*hint*/)
+    {
+        return allocate(n);
+    }
+
+    void deallocate(pointer p, std::size_t n) noexcept
+    {
+        SFL_ASSERT(n == 1);
+
+        sfl::dtl::ignore_unused(n);
+
+        element* q = reinterpret_cast<element*>(sfl::dtl::to_address(p));
+
+        q->next_ = free_;
+
+        free_ = q;
+    }
+
+    SFL_NODISCARD
+    bool is_storage_unpropagable(pointer p) const noexcept
+    {
+        sfl::dtl::ignore_unused(p);
+        return true;
+    }
+
+private:
+
+    void grow()
+    {
+        slab_allocator_type a(base());
+
+        const size_type size = next_slab_size_;
+
+        element* slab = sfl::dtl::to_address
+        (
+            sfl::dtl::allocator_traits<slab_allocator_type>::allocate(a, size)
+        );
+
+        slab->slab_.next_ = slabs_;
+        slab->slab_.size_ = size;
+
+        slabs_ = slab;
+
+        first_ = slab + 1;
+        last_  = slab + size;
+
+        if (next_slab_size_ < max_slab_size)
+        {
+            next_slab_size_ *= 2;
+        }
+    }
+};
+
 } // namespace dtl
 
+//
+// Drop-in node allocator for map, set, multimap and multiset, e.g.
+//
+//     sfl::map<K, T, std::less<K>, sfl::node_slab_allocator<std::pair<const K, T>>>
+//
+template <typename T, typename BaseAllocator = std::allocator<T>>
+using node_slab_allocator = sfl::dtl::node_slab_allocator<T, BaseAllocator>;
+
 } // namespace sfl
 
 #endif // SFL_DETAIL_NODE_SMALL_ALLOCATOR_HPP_INCLUDED
@@ -23,12 +23,14 @@
 
 #include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
+#include <sfl/detail/sorted_search.hpp>
 #include <sfl/detail/to_address.hpp>
 #include <sfl/detail/type_traits.hpp>
 #include <sfl/detail/uninitialized_memory_algorithms.hpp>
 
 #include <algorithm>    // equal, lexicographical_compare
 #include <cstddef>      // size_t, ptrdiff_t
+#include <cstdint>      // uintptr_t
 #include <iterator>     // iterator_traits, xxxxx_iterator_tag, reverse_iterator
 #include <memory>       // pointer_traits
 #include <type_traits>  // is_xxxxx
@@ -51,8 +53,57 @@ enum class rb_tree_node_color
     black
 };
 
-template <typename VoidPointer>
-struct rb_tree_node_base
+//
+// Augmentation policies. Policy selects additional data kept in every node.
+//
+// rb_tree_no_augment keeps no additional data.
+//
+// rb_tree_order_statistic keeps the number of nodes in the subtree rooted at
+// the node. It is maintained by insertion, removal and rotations, and enables
+// O(log N) `nth`, `index_of`, `rank` and `count_range` queries.
+//
+struct rb_tree_no_augment {};
+
+struct rb_tree_order_statistic {};
+
+template <typename Augment>
+struct rb_tree_node_augment;
+
+template <>
+struct rb_tree_node_augment<rb_tree_no_augment>
+{
+    std::size_t subtree_size() const noexcept
+    {
+        return 0;
+    }
+
+    void set_subtree_size(std::size_t) noexcept
+    {}
+};
+
+template <>
+struct rb_tree_node_augment<rb_tree_order_statistic>
+{
+    std::size_t subtree_size_ = 0;
+
+    std::size_t subtree_size() const noexcept
+    {
+        return subtree_size_;
+    }
+
+    void set_subtree_size(std::size_t n) noexcept
+    {
+        subtree_size_ = n;
+    }
+};
+
+template <typename VoidPointer,
+          typename Augment = rb_tree_no_augment,
+          bool PackedColor = sfl::pointer_has_spare_low_bits<VoidPointer>::value>
+struct rb_tree_node_base;
+
+template <typename VoidPointer, typename Augment>
+struct rb_tree_node_base<VoidPointer, Augment, false> : rb_tree_node_augment<Augment>
 {
     using base_node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<rb_tree_node_base>;
 
@@ -60,10 +111,76 @@ struct rb_tree_node_base
     base_node_pointer parent_;
     base_node_pointer left_;
     base_node_pointer right_;
+
+    base_node_pointer parent() const noexcept
+    {
+        return parent_;
+    }
+
+    void set_parent(const base_node_pointer& p) noexcept
+    {
+        parent_ = p;
+    }
+
+    rb_tree_node_color color() const noexcept
+    {
+        return color_;
+    }
+
+    void set_color(rb_tree_node_color c) noexcept
+    {
+        color_ = c;
+    }
+};
+
+//
+// Color is stored in the least significant bit of the address of the parent.
+// Nodes are aligned at least as pointers, so this bit of the address is zero.
+//
+template <typename VoidPointer, typename Augment>
+struct rb_tree_node_base<VoidPointer, Augment, true> : rb_tree_node_augment<Augment>
+{
+    using base_node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<rb_tree_node_base>;
+
+    std::uintptr_t parent_and_color_ = 0;
+    base_node_pointer left_;
+    base_node_pointer right_;
+
+    base_node_pointer parent() const noexcept
+    {
+        const auto p = reinterpret_cast<rb_tree_node_base*>(parent_and_color_ & ~std::uintptr_t(1));
+
+        if (p == nullptr)
+        {
+            return nullptr;
+        }
+
+        return std::pointer_traits<base_node_pointer>::pointer_to(*p);
+    }
+
+    void set_parent(const base_node_pointer& p) noexcept
+    {
+        const std::uintptr_t address = (p == nullptr)
+            ? 0
+            : reinterpret_cast<std::uintptr_t>(sfl::dtl::to_address(p));
+
+        parent_and_color_ = address | (parent_and_color_ & 1);
+    }
+
+    rb_tree_node_color color() const noexcept
+    {
+        return (parent_and_color_ & 1) ? rb_tree_node_color::black : rb_tree_node_color::red;
+    }
+
+    void set_color(rb_tree_node_color c) noexcept
+    {
+        parent_and_color_ = (parent_and_color_ & ~std::uintptr_t(1))
+                          | std::uintptr_t(c == rb_tree_node_color::black);
+    }
 };
 
-template <typename Value, typename Allocator, typename VoidPointer>
-struct rb_tree_node : rb_tree_node_base<VoidPointer>
+template <typename Value, typename Allocator, typename VoidPointer, typename Augment = rb_tree_no_augment>
+struct rb_tree_node : rb_tree_node_base<VoidPointer, Augment>
 {
     static_assert
     (
@@ -71,7 +188,7 @@ struct rb_tree_node : rb_tree_node_base<VoidPointer>
         "Allocator::value_type must be Value."
     );
 
-    using typename rb_tree_node_base<VoidPointer>::base_node_pointer;
+    using typename rb_tree_node_base<VoidPointer, Augment>::base_node_pointer;
 
     using node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<rb_tree_node>;
 
@@ -100,12 +217,317 @@ struct rb_tree_node : rb_tree_node_base<VoidPointer>
     #endif
 };
 
+//
+// Node handle returned by `extract` and accepted by node `insert`.
+//
+// If the node allocator is partially propagable (nodes may live in storage
+// embedded in the container itself, as in small and static containers),
+// a node cannot outlive its container, so the handle holds the extracted
+// value instead of the node.
+//
+template <typename Key,
+          typename Value,
+          typename KeyOfValue,
+          typename Allocator,
+          typename Augment = rb_tree_no_augment,
+          bool HoldsValue = sfl::dtl::allocator_traits<Allocator>::is_partially_propagable::value>
+class rb_tree_node_handle;
+
+template <typename Key, typename Value, typename KeyOfValue, typename Allocator, typename Augment>
+class rb_tree_node_handle<Key, Value, KeyOfValue, Allocator, Augment, false>
+{
+    template <typename, typename, typename, typename, typename, typename, typename>
+    friend class rb_tree;
+
+public:
+
+    using key_type       = Key;
+    using value_type     = Value;
+    using allocator_type = Allocator;
+
+private:
+
+    using void_pointer = typename sfl::dtl::allocator_traits<allocator_type>::void_pointer;
+
+    using node_type = rb_tree_node<value_type, allocator_type, void_pointer, Augment>;
+
+    using node_allocator_type = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<node_type>;
+
+    using node_pointer = typename node_type::node_pointer;
+
+    node_pointer node_;
+
+    union
+    {
+        node_allocator_type alloc_;
+    };
+
+    rb_tree_node_handle(node_pointer p, const node_allocator_type& alloc)
+        : node_(p)
+    {
+        sfl::dtl::construct_at(std::addressof(alloc_), alloc);
+    }
+
+public:
+
+    rb_tree_node_handle() noexcept
+        : node_(nullptr)
+    {}
+
+    rb_tree_node_handle(const rb_tree_node_handle& other) = delete;
+
+    rb_tree_node_handle(rb_tree_node_handle&& other) noexcept
+        : node_(other.node_)
+    {
+        if (node_ != nullptr)
+        {
+            sfl::dtl::construct_at(std::addressof(alloc_), std::move(other.alloc_));
+            other.release();
+        }
+    }
+
+    rb_tree_node_handle& operator=(const rb_tree_node_handle& other) = delete;
+
+    rb_tree_node_handle& operator=(rb_tree_node_handle&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+
+            if (other.node_ != nullptr)
+            {
+                node_ = other.node_;
+                sfl::dtl::construct_at(std::addressof(alloc_), std::move(other.alloc_));
+                other.release();
+            }
+        }
+
+        return *this;
+    }
+
+    ~rb_tree_node_handle()
+    {
+        clear();
+    }
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return node_ == nullptr;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return node_ != nullptr;
+    }
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const
+    {
+        SFL_ASSERT(!empty());
+        return allocator_type(alloc_);
+    }
+
+    SFL_NODISCARD
+    value_type& value() const noexcept
+    {
+        SFL_ASSERT(!empty());
+        return node_->value_;
+    }
+
+    SFL_NODISCARD
+    key_type& key() const noexcept
+    {
+        return const_cast<key_type&>(KeyOfValue()(value()));
+    }
+
+    template <typename V = value_type>
+    SFL_NODISCARD
+    typename V::second_type& mapped() const noexcept
+    {
+        return value().second;
+    }
+
+    void swap(rb_tree_node_handle& other) noexcept
+    {
+        rb_tree_node_handle temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    friend void swap(rb_tree_node_handle& x, rb_tree_node_handle& y) noexcept
+    {
+        x.swap(y);
+    }
+
+private:
+
+    // Gives up ownership of the node and returns it.
+    node_pointer release() noexcept
+    {
+        node_pointer p = node_;
+        sfl::dtl::destroy_at(std::addressof(alloc_));
+        node_ = nullptr;
+        return p;
+    }
+
+    void clear() noexcept
+    {
+        if (node_ != nullptr)
+        {
+            sfl::dtl::destroy_at_a(alloc_, std::addressof(node_->value_));
+            sfl::dtl::destroy_at_a(alloc_, node_);
+            sfl::dtl::deallocate(alloc_, node_, 1);
+            sfl::dtl::destroy_at(std::addressof(alloc_));
+            node_ = nullptr;
+        }
+    }
+};
+
+template <typename Key, typename Value, typename KeyOfValue, typename Allocator, typename Augment>
+class rb_tree_node_handle<Key, Value, KeyOfValue, Allocator, Augment, true>
+{
+    template <typename, typename, typename, typename, typename, typename, typename>
+    friend class rb_tree;
+
+public:
+
+    using key_type       = Key;
+    using value_type     = Value;
+    using allocator_type = Allocator;
+
+private:
+
+    bool has_value_;
+
+    union
+    {
+        value_type value_;
+    };
+
+    explicit rb_tree_node_handle(value_type& value)
+        : has_value_(true)
+    {
+        sfl::dtl::construct_at(std::addressof(value_), std::move(value));
+    }
+
+public:
+
+    rb_tree_node_handle() noexcept
+        : has_value_(false)
+    {}
+
+    rb_tree_node_handle(const rb_tree_node_handle& other) = delete;
+
+    rb_tree_node_handle(rb_tree_node_handle&& other)
+        noexcept(std::is_nothrow_move_constructible<value_type>::value)
+        : has_value_(false)
+    {
+        if (other.has_value_)
+        {
+            sfl::dtl::construct_at(std::addressof(value_), std::move(other.value_));
+            has_value_ = true;
+            other.clear();
+        }
+    }
+
+    rb_tree_node_handle& operator=(const rb_tree_node_handle& other) = delete;
+
+    rb_tree_node_handle& operator=(rb_tree_node_handle&& other)
+        noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            if (other.has_value_)
+            {
+                sfl::dtl::construct_at(std::addressof(value_), std::move(other.value_));
+                has_value_ = true;
+                other.clear();
+            }
+        }
+
+        return *this;
+    }
+
+    ~rb_tree_node_handle()
+    {
+        clear();
+    }
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return !has_value_;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return has_value_;
+    }
+
+    SFL_NODISCARD
+    value_type& value() const noexcept
+    {
+        SFL_ASSERT(!empty());
+        return const_cast<value_type&>(value_);
+    }
+
+    SFL_NODISCARD
+    key_type& key() const noexcept
+    {
+        return const_cast<key_type&>(KeyOfValue()(value()));
+    }
+
+    template <typename V = value_type>
+    SFL_NODISCARD
+    typename V::second_type& mapped() const noexcept
+    {
+        return value().second;
+    }
+
+    void swap(rb_tree_node_handle& other)
+        noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    {
+        rb_tree_node_handle temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    friend void swap(rb_tree_node_handle& x, rb_tree_node_handle& y)
+        noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    {
+        x.swap(y);
+    }
+
+private:
+
+    void clear() noexcept
+    {
+        if (has_value_)
+        {
+            sfl::dtl::destroy_at(std::addressof(value_));
+            has_value_ = false;
+        }
+    }
+};
+
+template <typename Iterator, typename NodeHandle>
+struct rb_tree_insert_return_type
+{
+    Iterator   position;
+    bool       inserted;
+    NodeHandle node;
+};
+
 template < typename Key,
            typename Value,
            typename KeyOfValue,
            typename KeyCompare,
            typename Allocator,
-           typename UpperLevelContainer >
+           typename UpperLevelContainer,
+           typename Augment = rb_tree_no_augment >
 class rb_tree
 {
     static_assert
@@ -121,6 +543,9 @@ class rb_tree
 
     friend UpperLevelContainer;
 
+    template <typename, typename, typename, typename, typename, typename, typename>
+    friend class rb_tree;
+
 public:
 
     using allocator_type  = Allocator;
@@ -138,9 +563,9 @@ private:
 
     using void_pointer = typename sfl::dtl::allocator_traits<allocator_type>::void_pointer;
 
-    using base_node_type = rb_tree_node_base<void_pointer>;
+    using base_node_type = rb_tree_node_base<void_pointer, Augment>;
 
-    using node_type = rb_tree_node<value_type, allocator_type, void_pointer>;
+    using node_type = rb_tree_node<value_type, allocator_type, void_pointer, Augment>;
 
     using node_allocator_type = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<node_type>;
 
@@ -148,6 +573,8 @@ private:
 
     using node_pointer = typename node_type::node_pointer;
 
+    using is_order_statistic = std::is_same<Augment, rb_tree_order_statistic>;
+
 public:
 
     class iterator
@@ -357,6 +784,10 @@ public:
 
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
+    using node_handle = rb_tree_node_handle<Key, Value, KeyOfValue, Allocator, Augment>;
+
+    using insert_return_type = rb_tree_insert_return_type<iterator, node_handle>;
+
 private:
 
     class data_base
@@ -365,6 +796,10 @@ private:
 
         base_node_type header_;
 
+        base_node_pointer minimum_;
+
+        base_node_pointer maximum_;
+
         size_type size_;
 
         SFL_NODISCARD
@@ -382,15 +817,23 @@ private:
         SFL_NODISCARD
         base_node_pointer& minimum() noexcept
         {
-            return header_.parent_;
+            return minimum_;
+        }
+
+        SFL_NODISCARD
+        base_node_pointer& maximum() noexcept
+        {
+            return maximum_;
         }
 
         void reset() noexcept
         {
-            header_.color_  = rb_tree_node_color::red;
-            header_.parent_ = std::pointer_traits<base_node_pointer>::pointer_to(header_); // minimum
+            header_.set_color(rb_tree_node_color::red);
+            header_.set_parent(header()); // unused
             header_.left_   = nullptr;  // root
             header_.right_  = nullptr;  // unused
+            minimum_ = header();
+            maximum_ = header();
             size_ = 0;
         }
 
@@ -577,22 +1020,65 @@ public:
         return *this;
     }
 
-    template <typename InputIt,
-              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
-    void assign_range_equal(InputIt first, InputIt last)
+    //
+    // Inserts elements from range [first, last) if the tree doesn't already
+    // contain an element with an equivalent key.
+    //
+    // If the tree is empty, the sorted prefix of the range is built bottom-up
+    // in linear time. Remaining elements are inserted one by one.
+    //
+    template <typename InputIt, typename Sentinel>
+    void insert_range_unique(InputIt first, Sentinel last)
     {
-        make_node_with_recycling_functor make_node(*this);
+        if (data_.root() == nullptr)
+        {
+            first = initialize_sorted_prefix(first, last, std::true_type());
+        }
 
         while (first != last)
         {
-            insert_equal(*first, make_node);
+            insert_unique(*first);
             ++first;
         }
     }
 
-    template <typename InputIt,
-              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
-    void assign_range_unique(InputIt first, InputIt last)
+    //
+    // Inserts all elements from range [first, last).
+    //
+    // If the tree is empty, the sorted prefix of the range is built bottom-up
+    // in linear time. Remaining elements are inserted one by one.
+    //
+    template <typename InputIt, typename Sentinel>
+    void insert_range_equal(InputIt first, Sentinel last)
+    {
+        if (data_.root() == nullptr)
+        {
+            first = initialize_sorted_prefix(first, last, std::false_type());
+        }
+
+        while (first != last)
+        {
+            insert_equal(*first);
+            ++first;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void assign_range_equal(InputIt first, InputIt last)
+    {
+        make_node_with_recycling_functor make_node(*this);
+
+        while (first != last)
+        {
+            insert_equal(*first, make_node);
+            ++first;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void assign_range_unique(InputIt first, InputIt last)
     {
         make_node_with_recycling_functor make_node(*this);
 
@@ -765,7 +1251,7 @@ public:
         make_node_functor make_node(*this);
         node_pointer x = make_node(std::forward<Args>(args)...);
         auto res = calculate_position_for_insert_equal(key(x));
-        insert(x, res.pos, res.left, data_.root(), data_.minimum());
+        insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
         ++data_.size_;
         return iterator(x);
     }
@@ -778,7 +1264,7 @@ public:
         auto res = calculate_position_for_insert_unique(key(x));
         if (res.status)
         {
-            insert(x, res.pos, res.left, data_.root(), data_.minimum());
+            insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
             ++data_.size_;
             return std::make_pair(iterator(x), true);
         }
@@ -795,7 +1281,7 @@ public:
         make_node_functor make_node(*this);
         node_pointer x = make_node(std::forward<Args>(args)...);
         auto res = calculate_position_for_insert_hint_equal(hint, key(x));
-        insert(x, res.pos, res.left, data_.root(), data_.minimum());
+        insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
         ++data_.size_;
         return iterator(x);
     }
@@ -808,7 +1294,7 @@ public:
         auto res = calculate_position_for_insert_hint_unique(hint, key(x));
         if (res.status)
         {
-            insert(x, res.pos, res.left, data_.root(), data_.minimum());
+            insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
             ++data_.size_;
             return iterator(x);
         }
@@ -826,7 +1312,7 @@ private:
     {
         auto res = calculate_position_for_insert_equal(KeyOfValue()(value));
         node_pointer x = make_node(std::forward<V>(value));
-        insert(x, res.pos, res.left, data_.root(), data_.minimum());
+        insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
         ++data_.size_;
         return iterator(x);
     }
@@ -838,7 +1324,7 @@ private:
         if (res.status)
         {
             node_pointer x = make_node(std::forward<V>(value));
-            insert(x, res.pos, res.left, data_.root(), data_.minimum());
+            insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
             ++data_.size_;
             return std::make_pair(iterator(x), true);
         }
@@ -870,7 +1356,7 @@ public:
         auto res = calculate_position_for_insert_hint_equal(hint, KeyOfValue()(value));
         make_node_functor make_node(*this);
         node_pointer x = make_node(std::forward<V>(value));
-        insert(x, res.pos, res.left, data_.root(), data_.minimum());
+        insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
         ++data_.size_;
         return iterator(x);
     }
@@ -883,7 +1369,7 @@ public:
         {
             make_node_functor make_node(*this);
             node_pointer x = make_node(std::forward<V>(value));
-            insert(x, res.pos, res.left, data_.root(), data_.minimum());
+            insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
             ++data_.size_;
             return iterator(x);
         }
@@ -898,7 +1384,7 @@ public:
         base_node_pointer x = pos.node_;
         base_node_pointer y = next(x);
         --data_.size_;
-        remove(x, data_.root(), data_.minimum());
+        remove(x, data_.root(), data_.minimum(), data_.maximum());
         drop_node(static_cast<node_pointer>(x));
         return iterator(y);
     }
@@ -908,7 +1394,7 @@ public:
         base_node_pointer x = pos.node_;
         base_node_pointer y = next(x);
         --data_.size_;
-        remove(x, data_.root(), data_.minimum());
+        remove(x, data_.root(), data_.minimum(), data_.maximum());
         drop_node(static_cast<node_pointer>(x));
         return iterator(y);
     }
@@ -932,6 +1418,317 @@ public:
         return sz;
     }
 
+    node_handle extract(iterator pos)
+    {
+        return extract(const_iterator(pos));
+    }
+
+    node_handle extract(const_iterator pos)
+    {
+        SFL_ASSERT(pos != cend());
+        return extract(pos.node_, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
+    }
+
+    template <typename K>
+    node_handle extract(const K& k)
+    {
+        const const_iterator it = find(k);
+        return it == cend() ? node_handle() : extract(it);
+    }
+
+    insert_return_type insert_node_unique(node_handle&& nh)
+    {
+        if (nh.empty())
+        {
+            return insert_return_type{end(), false, node_handle()};
+        }
+
+        auto res = calculate_position_for_insert_unique(KeyOfValue()(nh.value()));
+        if (res.status)
+        {
+            node_pointer x = take_node(nh, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
+            insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
+            ++data_.size_;
+            return insert_return_type{iterator(x), true, node_handle()};
+        }
+        else
+        {
+            return insert_return_type{iterator(res.pos), false, std::move(nh)};
+        }
+    }
+
+    iterator insert_node_equal(node_handle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        auto res = calculate_position_for_insert_equal(KeyOfValue()(nh.value()));
+        node_pointer x = take_node(nh, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
+        insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
+        ++data_.size_;
+        return iterator(x);
+    }
+
+    iterator insert_node_hint_unique(const_iterator hint, node_handle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        auto res = calculate_position_for_insert_hint_unique(hint, KeyOfValue()(nh.value()));
+        if (res.status)
+        {
+            node_pointer x = take_node(nh, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
+            insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
+            ++data_.size_;
+            return iterator(x);
+        }
+        else
+        {
+            return iterator(res.pos);
+        }
+    }
+
+    iterator insert_node_hint_equal(const_iterator hint, node_handle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        auto res = calculate_position_for_insert_hint_equal(hint, KeyOfValue()(nh.value()));
+        node_pointer x = take_node(nh, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
+        insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
+        ++data_.size_;
+        return iterator(x);
+    }
+
+    //
+    // Moves elements from `other` into this tree. Elements whose keys are
+    // already present are left in `other`.
+    //
+    // Nodes are relinked without allocation when both node allocators compare
+    // equal and the node does not live in storage embedded in `other`.
+    // Otherwise the value is moved into a new node.
+    //
+    template <typename KeyCompare2, typename UpperLevelContainer2>
+    void merge_unique(rb_tree<Key, Value, KeyOfValue, KeyCompare2, Allocator, UpperLevelContainer2, Augment>& other)
+    {
+        if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+        {
+            return;
+        }
+
+        base_node_pointer x = other.data_.minimum();
+
+        while (x != other.data_.header())
+        {
+            base_node_pointer next_x = next(x);
+
+            auto res = calculate_position_for_insert_unique(key(x));
+            if (res.status)
+            {
+                transfer_node(other, x, res.pos, res.left);
+            }
+
+            x = next_x;
+        }
+    }
+
+    //
+    // Moves all elements from `other` into this tree.
+    //
+    template <typename KeyCompare2, typename UpperLevelContainer2>
+    void merge_equal(rb_tree<Key, Value, KeyOfValue, KeyCompare2, Allocator, UpperLevelContainer2, Augment>& other)
+    {
+        if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+        {
+            return;
+        }
+
+        base_node_pointer x = other.data_.minimum();
+
+        while (x != other.data_.header())
+        {
+            base_node_pointer next_x = next(x);
+
+            auto res = calculate_position_for_insert_equal(key(x));
+            transfer_node(other, x, res.pos, res.left);
+
+            x = next_x;
+        }
+    }
+
+    //
+    // Moves all elements from `other` into this tree. Elements whose keys are
+    // already present are left in `other`.
+    //
+    // If all keys in `other` are greater (or all are less) than keys in this
+    // tree and nodes can be relinked, trees are joined in O(log N) time
+    // without allocation. Otherwise it is equivalent to `merge_unique`.
+    //
+    void join_unique(rb_tree& other)
+    {
+        join(other, std::true_type());
+    }
+
+    //
+    // Moves all elements from `other` into this tree.
+    //
+    // If no key in `other` is less (or no key is greater) than keys in this
+    // tree and nodes can be relinked, trees are joined in O(log N) time
+    // without allocation. Otherwise it is equivalent to `merge_equal`.
+    //
+    void join_equal(rb_tree& other)
+    {
+        join(other, std::false_type());
+    }
+
+    //
+    // Moves elements with keys not less than `k` into `other`, which must be
+    // empty.
+    //
+    // If node allocators compare equal and nodes are not stored in the
+    // container itself, nodes are relinked without allocation. Complexity is
+    // O(log N) plus the number of elements in the smaller of the two resulting
+    // trees, which are counted. If tree is augmented with
+    // `rb_tree_order_statistic`, complexity is O(log N).
+    //
+    // Otherwise elements are moved one by one.
+    //
+    template <typename K>
+    void split(rb_tree& other, const K& k)
+    {
+        SFL_ASSERT(this != &other);
+        SFL_ASSERT(other.data_.root() == nullptr);
+
+        if (data_.root() == nullptr)
+        {
+            return;
+        }
+
+        if
+        (
+            sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable::value ||
+            ref_to_node_alloc() != other.ref_to_node_alloc()
+        )
+        {
+            base_node_pointer x = lower_bound(k).node_;
+
+            while (x != data_.header())
+            {
+                base_node_pointer next_x = next(x);
+
+                auto res = other.calculate_position_for_insert_hint_equal(other.end(), key(x));
+                other.transfer_node(*this, x, res.pos, res.left);
+
+                x = next_x;
+            }
+
+            return;
+        }
+
+        const base_node_pointer header = data_.header();
+        const base_node_pointer other_header = other.data_.header();
+        const size_type old_size = data_.size_;
+        const base_node_pointer old_maximum = data_.maximum();
+
+        // Find the end of the search path.
+        base_node_pointer p = header;
+
+        for (base_node_pointer x = data_.root(); x != nullptr; )
+        {
+            p = x;
+            x = ref_to_comp()(key(x), k) ? x->right_ : x->left_;
+        }
+
+        // Walk the search path bottom-up. Every node on the path together with
+        // its subtree off the path is joined to one of the resulting trees.
+        base_node_pointer l = nullptr;
+        base_node_pointer r = nullptr;
+        size_type hl = 0;
+        size_type hr = 0;
+        size_type hp = (p->color() == rb_tree_node_color::black) ? 1 : 0;
+
+        while (p != header)
+        {
+            const base_node_pointer up = p->parent();
+
+            const size_type h_up = (up != header && up->color() == rb_tree_node_color::black)
+                ? hp + 1
+                : hp;
+
+            const size_type h_child = (p->color() == rb_tree_node_color::black)
+                ? hp - 1
+                : hp;
+
+            if (ref_to_comp()(key(p), k))
+            {
+                base_node_pointer a = p->left_;
+                size_type ha = h_child;
+                make_root(a, ha);
+                hl = join(a, ha, p, l, hl, header);
+                l = header->left_;
+            }
+            else
+            {
+                base_node_pointer b = p->right_;
+                size_type hb = h_child;
+                make_root(b, hb);
+                hr = join(r, hr, p, b, hb, other_header);
+                r = other_header->left_;
+            }
+
+            p = up;
+            hp = h_up;
+        }
+
+        data_.root() = l;
+        other.data_.root() = r;
+
+        if (l == nullptr)
+        {
+            data_.minimum() = header;
+            data_.maximum() = header;
+        }
+        else
+        {
+            data_.maximum() = maximum(l);
+        }
+
+        if (r != nullptr)
+        {
+            other.data_.minimum() = minimum(r);
+            other.data_.maximum() = old_maximum;
+        }
+
+        if (is_order_statistic::value)
+        {
+            data_.size_ = subtree_size(l);
+        }
+        else
+        {
+            // Count the smaller tree.
+            base_node_pointer x = data_.minimum();
+            base_node_pointer y = other.data_.minimum();
+            size_type n = 0;
+
+            while (x != header && y != other_header)
+            {
+                x = next(x);
+                y = next(y);
+                ++n;
+            }
+
+            data_.size_ = (x == header) ? n : old_size - n;
+        }
+
+        other.data_.size_ = old_size - data_.size_;
+    }
+
     void swap(rb_tree& other)
     {
         swap(other, typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable());
@@ -1194,73 +1991,194 @@ public:
         return find(k) != end();
     }
 
-private:
+    //
+    // Batched lookups. For each key in [first, last) writes the result of
+    // `lower_bound` or `find` to `out`.
+    //
+    // Keys are processed in groups of `batch_size`. Descents of all keys in
+    // a group advance one level at a time, and the next node of each descent
+    // is prefetched while the other descents are advanced. This way cache
+    // misses of independent descents overlap instead of being serialized.
+    //
 
-    static base_node_pointer minimum(base_node_pointer x) noexcept
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out)
     {
-        SFL_ASSERT(x != nullptr);
+        return search_batch<iterator>(first, last, out, std::false_type());
+    }
 
-        while (x->left_ != nullptr)
-        {
-            x = x->left_;
-        }
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return search_batch<const_iterator>(first, last, out, std::false_type());
+    }
 
-        return x;
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return search_batch<iterator>(first, last, out, std::true_type());
     }
 
-    static base_node_pointer maximum(base_node_pointer x) noexcept
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
     {
-        SFL_ASSERT(x != nullptr);
+        return search_batch<const_iterator>(first, last, out, std::true_type());
+    }
 
-        while (x->right_ != nullptr)
-        {
-            x = x->right_;
-        }
+    //
+    // ---- ORDER STATISTICS --------------------------------------------------
+    //
+    // Available only if tree is augmented with `rb_tree_order_statistic`.
+    //
 
-        return x;
+    SFL_NODISCARD
+    iterator nth(size_type n) noexcept
+    {
+        return iterator(nth_node(n));
     }
 
-    static base_node_pointer next(base_node_pointer x) noexcept
+    SFL_NODISCARD
+    const_iterator nth(size_type n) const noexcept
     {
-        SFL_ASSERT(x != nullptr);
+        return const_iterator(nth_node(n));
+    }
 
-        if (x->right_ != nullptr)
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        static_assert(is_order_statistic::value, "Tree must be augmented with rb_tree_order_statistic.");
+
+        base_node_pointer x = pos.node_;
+
+        if (x == data_.header())
         {
-            return minimum(x->right_);
+            return data_.size_;
         }
-        else
+
+        size_type index = subtree_size(x->left_);
+
+        while (x != data_.root())
         {
-            base_node_pointer y = x->parent_;
+            base_node_pointer p = x->parent();
 
-            while (x == y->right_)
+            if (x == p->right_)
             {
-                x = y;
-                y = y->parent_;
+                index += subtree_size(p->left_) + 1;
             }
 
-            return y;
+            x = p;
         }
+
+        return index;
     }
 
-    static base_node_pointer prev(base_node_pointer x) noexcept
+    //
+    // Returns the number of elements with keys less than `k`.
+    //
+    template <typename K>
+    SFL_NODISCARD
+    size_type rank(const K& k) const noexcept
     {
-        SFL_ASSERT(x != nullptr);
+        static_assert(is_order_statistic::value, "Tree must be augmented with rb_tree_order_statistic.");
 
-        if (x->left_ != nullptr)
-        {
-            return maximum(x->left_);
-        }
-        else
-        {
-            base_node_pointer y = x->parent_;
+        base_node_pointer x = data_.root();
+        size_type result = 0;
 
-            while (x == y->left_)
+        while (x != nullptr)
+        {
+            if (ref_to_comp()(key(x), k))
             {
-                x = y;
-                y = y->parent_;
+                result += subtree_size(x->left_) + 1;
+                x = x->right_;
+            }
+            else
+            {
+                x = x->left_;
             }
-
-            return y;
+        }
+
+        return result;
+    }
+
+    //
+    // Returns the number of elements with keys in range [first, last).
+    //
+    template <typename K1, typename K2>
+    SFL_NODISCARD
+    size_type count_range(const K1& first, const K2& last) const noexcept
+    {
+        const size_type r1 = rank(first);
+        const size_type r2 = rank(last);
+        return r2 > r1 ? r2 - r1 : 0;
+    }
+
+private:
+
+    static base_node_pointer minimum(base_node_pointer x) noexcept
+    {
+        SFL_ASSERT(x != nullptr);
+
+        while (x->left_ != nullptr)
+        {
+            x = x->left_;
+        }
+
+        return x;
+    }
+
+    static base_node_pointer maximum(base_node_pointer x) noexcept
+    {
+        SFL_ASSERT(x != nullptr);
+
+        while (x->right_ != nullptr)
+        {
+            x = x->right_;
+        }
+
+        return x;
+    }
+
+    static base_node_pointer next(base_node_pointer x) noexcept
+    {
+        SFL_ASSERT(x != nullptr);
+
+        if (x->right_ != nullptr)
+        {
+            return minimum(x->right_);
+        }
+        else
+        {
+            base_node_pointer y = x->parent();
+
+            while (x == y->right_)
+            {
+                x = y;
+                y = y->parent();
+            }
+
+            return y;
+        }
+    }
+
+    static base_node_pointer prev(base_node_pointer x) noexcept
+    {
+        SFL_ASSERT(x != nullptr);
+
+        if (x->left_ != nullptr)
+        {
+            return maximum(x->left_);
+        }
+        else
+        {
+            base_node_pointer y = x->parent();
+
+            while (x == y->left_)
+            {
+                x = y;
+                y = y->parent();
+            }
+
+            return y;
         }
     }
 
@@ -1284,23 +2202,29 @@ private:
 
         if (y->left_ != nullptr)
         {
-            y->left_->parent_ = x;
+            y->left_->set_parent(x);
         }
 
-        y->parent_ = x->parent_;
+        y->set_parent(x->parent());
 
-        if (x == x->parent_->left_)
+        if (x == x->parent()->left_)
         {
-            x->parent_->left_ = y;
+            x->parent()->left_ = y;
         }
         else
         {
-            x->parent_->right_ = y;
+            x->parent()->right_ = y;
         }
 
         y->left_ = x;
 
-        x->parent_ = y;
+        x->set_parent(y);
+
+        if (is_order_statistic::value)
+        {
+            y->set_subtree_size(x->subtree_size());
+            update_subtree_size(x);
+        }
     }
 
     static void rotate_right(base_node_pointer x) noexcept
@@ -1323,39 +2247,46 @@ private:
 
         if (y->right_ != nullptr)
         {
-            y->right_->parent_ = x;
+            y->right_->set_parent(x);
         }
 
-        y->parent_ = x->parent_;
+        y->set_parent(x->parent());
 
-        if (x == x->parent_->right_)
+        if (x == x->parent()->right_)
         {
-            x->parent_->right_ = y;
+            x->parent()->right_ = y;
         }
         else
         {
-            x->parent_->left_ = y;
+            x->parent()->left_ = y;
         }
 
         y->right_ = x;
 
-        x->parent_ = y;
+        x->set_parent(y);
+
+        if (is_order_statistic::value)
+        {
+            y->set_subtree_size(x->subtree_size());
+            update_subtree_size(x);
+        }
     }
 
     static void insert(base_node_pointer x,
                        base_node_pointer parent,
                        bool insert_left,
                        base_node_pointer& root,
-                       base_node_pointer& minimum) noexcept
+                       base_node_pointer& minimum,
+                       base_node_pointer& maximum) noexcept
     {
         SFL_ASSERT(x != nullptr);
         SFL_ASSERT(parent != nullptr);
         SFL_ASSERT(x != parent);
 
-        x->parent_ = parent;
+        x->set_parent(parent);
         x->left_   = nullptr;
         x->right_  = nullptr;
-        x->color_  = rb_tree_node_color::red;
+        x->set_color(rb_tree_node_color::red);
 
         if (insert_left)
         {
@@ -1365,96 +2296,126 @@ private:
             {
                 minimum = x;
             }
+
+            if (root == x)
+            {
+                maximum = x;
+            }
         }
         else
         {
             parent->right_ = x;
+
+            if (parent == maximum)
+            {
+                maximum = x;
+            }
+        }
+
+        if (is_order_statistic::value)
+        {
+            x->set_subtree_size(1);
+
+            for (base_node_pointer p = parent; p != root->parent(); p = p->parent())
+            {
+                p->set_subtree_size(p->subtree_size() + 1);
+            }
         }
 
         insert_fixup(x, root);
     }
 
-    static void insert_fixup(base_node_pointer x, base_node_pointer& root) noexcept
+    //
+    // Returns true if black height of the tree has increased.
+    //
+    static bool insert_fixup(base_node_pointer x, base_node_pointer& root) noexcept
     {
-        while (x != root && x->parent_->color_ == rb_tree_node_color::red)
+        while (x != root && x->parent()->color() == rb_tree_node_color::red)
         {
-            if (x->parent_ == x->parent_->parent_->left_) // is z's parent a left child?
+            if (x->parent() == x->parent()->parent()->left_) // is z's parent a left child?
             {
-                base_node_pointer y = x->parent_->parent_->right_; // y is z's uncle
+                base_node_pointer y = x->parent()->parent()->right_; // y is z's uncle
 
-                if (y != nullptr && y->color_ == rb_tree_node_color::red) // are z's parent and uncle both red?
+                if (y != nullptr && y->color() == rb_tree_node_color::red) // are z's parent and uncle both red?
                 {
                     // Case 1
-                    x->parent_->color_ = rb_tree_node_color::black;
-                    y->color_ = rb_tree_node_color::black;
-                    x->parent_->parent_->color_ = rb_tree_node_color::red;
-                    x = x->parent_->parent_;
+                    x->parent()->set_color(rb_tree_node_color::black);
+                    y->set_color(rb_tree_node_color::black);
+                    x->parent()->parent()->set_color(rb_tree_node_color::red);
+                    x = x->parent()->parent();
                 }
                 else
                 {
-                    if (x == x->parent_->right_)
+                    if (x == x->parent()->right_)
                     {
                         // Case 2
-                        x = x->parent_;
+                        x = x->parent();
                         rotate_left(x);
                     }
 
                     // Case 3
-                    x->parent_->color_ = rb_tree_node_color::black;
-                    x->parent_->parent_->color_ = rb_tree_node_color::red;
-                    rotate_right(x->parent_->parent_);
+                    x->parent()->set_color(rb_tree_node_color::black);
+                    x->parent()->parent()->set_color(rb_tree_node_color::red);
+                    rotate_right(x->parent()->parent());
                 }
             }
             else // same as block above, but with "right" and "left" exchanged
             {
-                base_node_pointer y = x->parent_->parent_->left_;
+                base_node_pointer y = x->parent()->parent()->left_;
 
-                if (y != nullptr && y->color_ == rb_tree_node_color::red)
+                if (y != nullptr && y->color() == rb_tree_node_color::red)
                 {
-                    x->parent_->color_ = rb_tree_node_color::black;
-                    y->color_ = rb_tree_node_color::black;
-                    x->parent_->parent_->color_ = rb_tree_node_color::red;
-                    x = x->parent_->parent_;
+                    x->parent()->set_color(rb_tree_node_color::black);
+                    y->set_color(rb_tree_node_color::black);
+                    x->parent()->parent()->set_color(rb_tree_node_color::red);
+                    x = x->parent()->parent();
                 }
                 else
                 {
-                    if (x == x->parent_->left_)
+                    if (x == x->parent()->left_)
                     {
-                        x = x->parent_;
+                        x = x->parent();
                         rotate_right(x);
                     }
 
-                    x->parent_->color_ = rb_tree_node_color::black;
-                    x->parent_->parent_->color_ = rb_tree_node_color::red;
-                    rotate_left(x->parent_->parent_);
+                    x->parent()->set_color(rb_tree_node_color::black);
+                    x->parent()->parent()->set_color(rb_tree_node_color::red);
+                    rotate_left(x->parent()->parent());
                 }
             }
         }
 
-        root->color_ = rb_tree_node_color::black;
+        const bool grown = root->color() == rb_tree_node_color::red;
+
+        root->set_color(rb_tree_node_color::black);
+
+        return grown;
     }
 
     static void transplant(base_node_pointer x, base_node_pointer y)
     {
         SFL_ASSERT(x != nullptr);
-        SFL_ASSERT(x->parent_ != nullptr);
+        SFL_ASSERT(x->parent() != nullptr);
 
-        if (x == x->parent_->left_)
+        if (x == x->parent()->left_)
         {
-            x->parent_->left_ = y;
+            x->parent()->left_ = y;
         }
         else
         {
-            x->parent_->right_ = y;
+            x->parent()->right_ = y;
         }
 
         if (y != nullptr)
         {
-            y->parent_ = x->parent_;
+            y->set_parent(x->parent());
         }
     }
 
-    static void remove(base_node_pointer z, base_node_pointer& root, base_node_pointer& minimum)
+    static void remove(base_node_pointer z,
+                       base_node_pointer& root,
+                       base_node_pointer& minimum,
+                       base_node_pointer& maximum)
     {
         SFL_ASSERT(z != nullptr);
 
@@ -1463,35 +2424,54 @@ private:
             minimum = next(z);
         }
 
+        if (z == maximum)
+        {
+            maximum = prev(z);
+        }
+
+        if (is_order_statistic::value)
+        {
+            // Node that is unlinked from its position: z itself, or its
+            // successor if z has two children.
+            base_node_pointer u = (z->left_ != nullptr && z->right_ != nullptr)
+                ? rb_tree::minimum(z->right_)
+                : z;
+
+            for (base_node_pointer p = u->parent(); p != root->parent(); p = p->parent())
+            {
+                p->set_subtree_size(p->subtree_size() - 1);
+            }
+        }
+
         base_node_pointer x;
         base_node_pointer x_parent;
         base_node_pointer y = z;
-        rb_tree_node_color y_original_color = y->color_;
+        rb_tree_node_color y_original_color = y->color();
 
         if (z->left_ == nullptr) // if z has at most one child
         {
             x = z->right_; // z->right_ could be null pointer
             transplant(z, z->right_);
-            x_parent = z->parent_;
+            x_parent = z->parent();
         }
         else if (z->right_ == nullptr) // if z has exactly one child
         {
             x = z->left_; // z->left_ is not null pointer
             transplant(z, z->left_);
-            x_parent = z->parent_;
+            x_parent = z->parent();
         }
         else // if z has two children
         {
             y = rb_tree::minimum(z->right_);
-            y_original_color = y->color_;
+            y_original_color = y->color();
             x = y->right_; // y->right_ could be null pointer
 
             if (y != z->right_) // if y is farther down the tree
             {
                 transplant(y, y->right_); // replace y by its right child
-                x_parent = y->parent_;
+                x_parent = y->parent();
                 y->right_ = z->right_; // z's right child becomes y's right child
-                y->right_->parent_ = y;
+                y->right_->set_parent(y);
             }
             else
             {
@@ -1500,8 +2480,9 @@ private:
 
             transplant(z, y); // replace z by its successor y
             y->left_ = z->left_; // give z's left child to y, which had not left child
-            y->left_->parent_ = y;
-            y->color_ = z->color_;
+            y->left_->set_parent(y);
+            y->set_color(z->color());
+            y->set_subtree_size(z->subtree_size());
         }
 
         if (y_original_color == rb_tree_node_color::black)
@@ -1512,49 +2493,49 @@ private:
 
     static void remove_fixup(base_node_pointer x, base_node_pointer x_parent, base_node_pointer& root)
     {
-        while (x != root && (x == nullptr || x->color_ == rb_tree_node_color::black))
+        while (x != root && (x == nullptr || x->color() == rb_tree_node_color::black))
         {
             if (x == x_parent->left_) // is x a left child?
             {
                 base_node_pointer w = x_parent->right_; // w is x's sibling
 
-                if (w->color_ == rb_tree_node_color::red)
+                if (w->color() == rb_tree_node_color::red)
                 {
                     // Case 1
-                    w->color_ = rb_tree_node_color::black;
-                    x_parent->color_ = rb_tree_node_color::red;
+                    w->set_color(rb_tree_node_color::black);
+                    x_parent->set_color(rb_tree_node_color::red);
                     rotate_left(x_parent);
                     w = x_parent->right_;
                 }
 
                 if
                 (
-                    (w->left_  == nullptr || w->left_->color_  == rb_tree_node_color::black) &&
-                    (w->right_ == nullptr || w->right_->color_ == rb_tree_node_color::black)
+                    (w->left_  == nullptr || w->left_->color()  == rb_tree_node_color::black) &&
+                    (w->right_ == nullptr || w->right_->color() == rb_tree_node_color::black)
                 )
                 {
                     // Case 2
-                    w->color_ = rb_tree_node_color::red;
+                    w->set_color(rb_tree_node_color::red);
                     x = x_parent;
-                    x_parent = x_parent->parent_;
+                    x_parent = x_parent->parent();
                 }
                 else
                 {
-                    if (w->right_ == nullptr || w->right_->color_ == rb_tree_node_color::black)
+                    if (w->right_ == nullptr || w->right_->color() == rb_tree_node_color::black)
                     {
                         // Case 3
-                        w->left_->color_ = rb_tree_node_color::black;
-                        w->color_ = rb_tree_node_color::red;
+                        w->left_->set_color(rb_tree_node_color::black);
+                        w->set_color(rb_tree_node_color::red);
                         rotate_right(w);
                         w = x_parent->right_;
                     }
 
                     // Case 4
-                    w->color_ = x_parent->color_;
-                    x_parent->color_ = rb_tree_node_color::black;
+                    w->set_color(x_parent->color());
+                    x_parent->set_color(rb_tree_node_color::black);
                     if (w->right_ != nullptr)
                     {
-                        w->right_->color_ = rb_tree_node_color::black;
+                        w->right_->set_color(rb_tree_node_color::black);
                     }
                     rotate_left(x_parent);
                     break;
@@ -1564,39 +2545,39 @@ private:
             {
                 base_node_pointer w = x_parent->left_;
 
-                if (w->color_ == rb_tree_node_color::red)
+                if (w->color() == rb_tree_node_color::red)
                 {
-                    w->color_ = rb_tree_node_color::black;
-                    x_parent->color_ = rb_tree_node_color::red;
+                    w->set_color(rb_tree_node_color::black);
+                    x_parent->set_color(rb_tree_node_color::red);
                     rotate_right(x_parent);
                     w = x_parent->left_;
                 }
 
                 if
                 (
-                    (w->right_ == nullptr || w->right_->color_ == rb_tree_node_color::black) &&
-                    (w->left_  == nullptr || w->left_->color_  == rb_tree_node_color::black)
+                    (w->right_ == nullptr || w->right_->color() == rb_tree_node_color::black) &&
+                    (w->left_  == nullptr || w->left_->color()  == rb_tree_node_color::black)
                 )
                 {
-                    w->color_ = rb_tree_node_color::red;
+                    w->set_color(rb_tree_node_color::red);
                     x = x_parent;
-                    x_parent = x_parent->parent_;
+                    x_parent = x_parent->parent();
                 }
                 else
                 {
-                    if (w->left_ == nullptr || w->left_->color_ == rb_tree_node_color::black)
+                    if (w->left_ == nullptr || w->left_->color() == rb_tree_node_color::black)
                     {
-                        w->right_->color_ = rb_tree_node_color::black;
-                        w->color_ = rb_tree_node_color::red;
+                        w->right_->set_color(rb_tree_node_color::black);
+                        w->set_color(rb_tree_node_color::red);
                         rotate_left(w);
                         w = x_parent->left_;
                     }
 
-                    w->color_ = x_parent->color_;
-                    x_parent->color_ = rb_tree_node_color::black;
+                    w->set_color(x_parent->color());
+                    x_parent->set_color(rb_tree_node_color::black);
                     if (w->left_)
                     {
-                        w->left_->color_ = rb_tree_node_color::black;
+                        w->left_->set_color(rb_tree_node_color::black);
                     }
                     rotate_right(x_parent);
                     break;
@@ -1604,179 +2585,766 @@ private:
             }
         }
 
-        if (x != nullptr)
+        if (x != nullptr)
+        {
+            x->set_color(rb_tree_node_color::black);
+        }
+    }
+
+    static constexpr int batch_size = 8;
+
+    template <typename Iterator, typename ForwardIt, typename OutputIt, bool Find>
+    OutputIt search_batch(ForwardIt first, ForwardIt last, OutputIt out, std::integral_constant<bool, Find>) const
+    {
+        const base_node_pointer header = data_.header();
+
+        ForwardIt keys[batch_size];
+        base_node_pointer x[batch_size];
+        base_node_pointer y[batch_size];
+
+        while (first != last)
+        {
+            int n = 0;
+
+            for (; n < batch_size && first != last; ++n, ++first)
+            {
+                keys[n] = first;
+                x[n] = data_.root();
+                y[n] = header;
+            }
+
+            bool active = true;
+
+            while (active)
+            {
+                active = false;
+
+                for (int i = 0; i < n; ++i)
+                {
+                    if (x[i] != nullptr)
+                    {
+                        if (!ref_to_comp()(key(x[i]), *keys[i]))
+                        {
+                            y[i] = x[i];
+                            x[i] = x[i]->left_;
+                        }
+                        else
+                        {
+                            x[i] = x[i]->right_;
+                        }
+
+                        if (x[i] != nullptr)
+                        {
+                            sfl::dtl::prefetch(x[i]);
+                            active = true;
+                        }
+                    }
+                }
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                if (Find && y[i] != header && ref_to_comp()(*keys[i], key(y[i])))
+                {
+                    y[i] = header;
+                }
+
+                *out = Iterator(y[i]);
+                ++out;
+            }
+        }
+
+        return out;
+    }
+
+    base_node_pointer nth_node(size_type n) const noexcept
+    {
+        static_assert(is_order_statistic::value, "Tree must be augmented with rb_tree_order_statistic.");
+
+        SFL_ASSERT(n <= size());
+
+        if (n >= data_.size_)
+        {
+            return data_.header();
+        }
+
+        base_node_pointer x = data_.root();
+
+        while (true)
+        {
+            const size_type left_size = subtree_size(x->left_);
+
+            if (n < left_size)
+            {
+                x = x->left_;
+            }
+            else if (n == left_size)
+            {
+                return x;
+            }
+            else
+            {
+                n -= left_size + 1;
+                x = x->right_;
+            }
+        }
+    }
+
+    static std::size_t subtree_size(base_node_pointer x) noexcept
+    {
+        return x == nullptr ? 0 : x->subtree_size();
+    }
+
+    static void update_subtree_size(base_node_pointer x) noexcept
+    {
+        x->set_subtree_size(1 + subtree_size(x->left_) + subtree_size(x->right_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    static const Key& key(node_pointer x) noexcept
+    {
+        return KeyOfValue()(x->value_);
+    }
+
+    static const Key& key(base_node_pointer x) noexcept
+    {
+        return KeyOfValue()(static_cast<node_pointer>(x)->value_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    node_pointer allocate_node()
+    {
+        return sfl::dtl::allocate(ref_to_node_alloc(), 1);
+    }
+
+    void deallocate_node(node_pointer p) noexcept
+    {
+        sfl::dtl::deallocate(ref_to_node_alloc(), p, 1);
+    }
+
+    template <typename... Args>
+    void construct_node(node_pointer p, Args&&... args)
+    {
+        sfl::dtl::construct_at_a(ref_to_node_alloc(), p);
+
+        SFL_TRY
+        {
+            sfl::dtl::construct_at_a
+            (
+                ref_to_node_alloc(),
+                std::addressof(p->value_),
+                std::forward<Args>(args)...
+            );
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at_a(ref_to_node_alloc(), p);
+            SFL_RETHROW;
+        }
+    }
+
+    void destroy_node(node_pointer p) noexcept
+    {
+        sfl::dtl::destroy_at_a(ref_to_node_alloc(), std::addressof(p->value_));
+        sfl::dtl::destroy_at_a(ref_to_node_alloc(), p);
+    }
+
+    class make_node_functor
+    {
+    private:
+
+        rb_tree& tree_;
+
+    public:
+
+        make_node_functor(rb_tree& tree)
+            : tree_(tree)
+        {}
+
+        template <typename... Args>
+        node_pointer operator()(Args&&... args)
+        {
+            node_pointer p = tree_.allocate_node();
+
+            SFL_TRY
+            {
+                tree_.construct_node(p, std::forward<Args>(args)...);
+            }
+            SFL_CATCH (...)
+            {
+                tree_.deallocate_node(p);
+                SFL_RETHROW;
+            }
+
+            return p;
+        }
+    };
+
+    class make_node_with_recycling_functor
+    {
+    private:
+
+        rb_tree& tree_;
+
+        base_node_pointer root_;
+
+    public:
+
+        make_node_with_recycling_functor(rb_tree& tree)
+            : tree_(tree)
+            , root_(tree.data_.root())
+        {
+            tree.data_.reset();
+        }
+
+        ~make_node_with_recycling_functor()
+        {
+            if (root_ != nullptr)
+            {
+                tree_.clear(root_);
+            }
+        }
+
+        template <typename... Args>
+        node_pointer operator()(Args&&... args)
+        {
+            node_pointer p = this->allocate_node();
+
+            SFL_TRY
+            {
+                tree_.construct_node(p, std::forward<Args>(args)...);
+            }
+            SFL_CATCH (...)
+            {
+                tree_.deallocate_node(p);
+                SFL_RETHROW;
+            }
+
+            return p;
+        }
+
+    private:
+
+        node_pointer allocate_node()
+        {
+            if (root_ == nullptr)
+            {
+                return tree_.allocate_node();
+            }
+            else
+            {
+                base_node_pointer node = tree_.minimum(root_);
+
+                if (node != root_)
+                {
+                    node->parent()->left_ = node->right_;
+
+                    if (node->right_ != nullptr)
+                    {
+                        node->right_->set_parent(node->parent());
+                    }
+                }
+                else
+                {
+                    root_ = node->right_;
+
+                    if (node->right_ != nullptr)
+                    {
+                        node->right_->set_parent(nullptr);
+                    }
+                }
+
+                tree_.destroy_node(static_cast<node_pointer>(node));
+
+                return static_cast<node_pointer>(node);
+            }
+        }
+    };
+
+    void drop_node(node_pointer p) noexcept
+    {
+        destroy_node(p);
+        deallocate_node(p);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    //
+    // Constructs nodes from range [first, last) while the range is sorted
+    // and builds a balanced tree from them in linear time. Tree must be empty.
+    //
+    // Nodes are first collected into a list linked through `right_`. If
+    // `Unique` is true, elements equivalent to the previous one are dropped.
+    // The first element that is out of order is inserted as usual and the
+    // function returns iterator following it.
+    //
+    template <typename InputIt, typename Sentinel, bool Unique>
+    InputIt initialize_sorted_prefix(InputIt first, Sentinel last, std::integral_constant<bool, Unique>)
+    {
+        SFL_ASSERT(data_.root() == nullptr);
+
+        make_node_functor make_node(*this);
+
+        base_node_pointer head = nullptr;
+        base_node_pointer tail = nullptr;
+        node_pointer out_of_order = nullptr;
+        size_type n = 0;
+
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                node_pointer x = make_node(*first);
+
+                x->right_ = nullptr;
+
+                if (tail == nullptr)
+                {
+                    head = x;
+                }
+                else
+                {
+                    tail->right_ = x;
+                }
+
+                base_node_pointer prev = tail;
+                tail = x;
+
+                ++first;
+
+                if (prev != nullptr)
+                {
+                    if (ref_to_comp()(key(x), key(prev)))
+                    {
+                        prev->right_ = nullptr;
+                        tail = prev;
+                        out_of_order = x;
+                        break;
+                    }
+
+                    if (Unique && !ref_to_comp()(key(prev), key(x)))
+                    {
+                        prev->right_ = nullptr;
+                        tail = prev;
+                        drop_node(x);
+                        continue;
+                    }
+                }
+
+                ++n;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            while (head != nullptr)
+            {
+                base_node_pointer next_head = head->right_;
+                drop_node(static_cast<node_pointer>(head));
+                head = next_head;
+            }
+
+            SFL_RETHROW;
+        }
+
+        if (n != 0)
+        {
+            // Nodes below the last complete level are red, all others are
+            // black, so every path from the root has the same black count.
+            size_type red_depth = 0;
+            for (size_type m = n + 1; m > 1; m /= 2)
+            {
+                ++red_depth;
+            }
+
+            data_.minimum() = head;
+            data_.maximum() = tail;
+            data_.root() = build_balanced(head, n, 0, red_depth);
+            data_.root()->set_parent(data_.header());
+            data_.size_ = n;
+        }
+
+        if (out_of_order != nullptr)
+        {
+            link_node(out_of_order, std::integral_constant<bool, Unique>());
+        }
+
+        return first;
+    }
+
+    // Links node into the tree, or drops it if tree already contains an
+    // element with an equivalent key.
+    void link_node(node_pointer x, std::true_type)
+    {
+        auto res = calculate_position_for_insert_unique(key(x));
+        if (res.status)
+        {
+            insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
+            ++data_.size_;
+        }
+        else
+        {
+            drop_node(x);
+        }
+    }
+
+    // Links node into the tree.
+    void link_node(node_pointer x, std::false_type)
+    {
+        auto res = calculate_position_for_insert_equal(key(x));
+        insert(x, res.pos, res.left, data_.root(), data_.minimum(), data_.maximum());
+        ++data_.size_;
+    }
+
+    //
+    // Builds balanced subtree from the first `n` nodes of the list `head`
+    // (linked through `right_`) and advances `head` past them. Returns the
+    // root of the subtree.
+    //
+    static base_node_pointer build_balanced(base_node_pointer& head,
+                                            size_type n,
+                                            size_type depth,
+                                            size_type red_depth) noexcept
+    {
+        if (n == 0)
+        {
+            return nullptr;
+        }
+
+        const size_type n_left = (n - 1) / 2;
+
+        base_node_pointer left = build_balanced(head, n_left, depth + 1, red_depth);
+
+        base_node_pointer x = head;
+        head = head->right_;
+
+        base_node_pointer right = build_balanced(head, n - 1 - n_left, depth + 1, red_depth);
+
+        x->left_ = left;
+        x->right_ = right;
+
+        if (left != nullptr)
+        {
+            left->set_parent(x);
+        }
+
+        if (right != nullptr)
+        {
+            right->set_parent(x);
+        }
+
+        x->set_color(depth == red_depth ? rb_tree_node_color::red : rb_tree_node_color::black);
+        x->set_subtree_size(n);
+
+        return x;
+    }
+
+    template <bool Unique>
+    void join(rb_tree& other, std::integral_constant<bool, Unique>)
+    {
+        if (this == &other || other.data_.root() == nullptr)
+        {
+            return;
+        }
+
+        const bool relinkable =
+            !sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable::value &&
+            ref_to_node_alloc() == other.ref_to_node_alloc();
+
+        if (relinkable && data_.root() == nullptr)
         {
-            x->color_ = rb_tree_node_color::black;
+            take_nodes(other);
+            return;
         }
-    }
 
-    ///////////////////////////////////////////////////////////////////////////
+        if (relinkable)
+        {
+            const base_node_pointer this_min = data_.minimum();
+            const base_node_pointer this_max = data_.maximum();
+            const base_node_pointer other_min = other.data_.minimum();
+            const base_node_pointer other_max = other.data_.maximum();
 
-    static const Key& key(node_pointer x) noexcept
-    {
-        return KeyOfValue()(x->value_);
-    }
+            // Keys in `other` follow keys in this tree.
+            if
+            (
+                Unique
+                    ? ref_to_comp()(key(this_max), key(other_min))
+                    : !ref_to_comp()(key(other_min), key(this_max))
+            )
+            {
+                --other.data_.size_;
+                remove(other_min, other.data_.root(), other.data_.minimum(), other.data_.maximum());
 
-    static const Key& key(base_node_pointer x) noexcept
-    {
-        return KeyOfValue()(static_cast<node_pointer>(x)->value_);
-    }
+                if (other.data_.root() == nullptr)
+                {
+                    insert(other_min, this_max, false, data_.root(), data_.minimum(), data_.maximum());
+                    ++data_.size_;
+                    return;
+                }
 
-    ///////////////////////////////////////////////////////////////////////////
+                const base_node_pointer r = other.data_.root();
+                const size_type n = other.data_.size_;
+                other.data_.reset();
 
-    node_pointer allocate_node()
-    {
-        return sfl::dtl::allocate(ref_to_node_alloc(), 1);
-    }
+                join(data_.root(), black_height(data_.root()), other_min, r, black_height(r), data_.header());
+                data_.maximum() = other_max;
+                data_.size_ += n + 1;
+                return;
+            }
 
-    void deallocate_node(node_pointer p) noexcept
-    {
-        sfl::dtl::deallocate(ref_to_node_alloc(), p, 1);
-    }
+            // Keys in `other` precede keys in this tree.
+            if
+            (
+                Unique
+                    ? ref_to_comp()(key(other_max), key(this_min))
+                    : !ref_to_comp()(key(this_min), key(other_max))
+            )
+            {
+                --other.data_.size_;
+                remove(other_max, other.data_.root(), other.data_.minimum(), other.data_.maximum());
 
-    template <typename... Args>
-    void construct_node(node_pointer p, Args&&... args)
-    {
-        sfl::dtl::construct_at_a(ref_to_node_alloc(), p);
+                if (other.data_.root() == nullptr)
+                {
+                    insert(other_max, this_min, true, data_.root(), data_.minimum(), data_.maximum());
+                    ++data_.size_;
+                    return;
+                }
 
-        SFL_TRY
+                const base_node_pointer l = other.data_.root();
+                const base_node_pointer l_min = other.data_.minimum();
+                const size_type n = other.data_.size_;
+                other.data_.reset();
+
+                join(l, black_height(l), other_max, data_.root(), black_height(data_.root()), data_.header());
+                data_.minimum() = l_min;
+                data_.size_ += n + 1;
+                return;
+            }
+        }
+
+        if (Unique)
         {
-            sfl::dtl::construct_at_a
-            (
-                ref_to_node_alloc(),
-                std::addressof(p->value_),
-                std::forward<Args>(args)...
-            );
+            merge_unique(other);
         }
-        SFL_CATCH (...)
+        else
         {
-            sfl::dtl::destroy_at_a(ref_to_node_alloc(), p);
-            SFL_RETHROW;
+            merge_equal(other);
         }
     }
 
-    void destroy_node(node_pointer p) noexcept
-    {
-        sfl::dtl::destroy_at_a(ref_to_node_alloc(), std::addressof(p->value_));
-        sfl::dtl::destroy_at_a(ref_to_node_alloc(), p);
-    }
-
-    class make_node_functor
+    //
+    // Joins trees `l` and `r` using node `k` as the middle element and links
+    // the result as the root under `header`. Keys in `l` must not be greater
+    // and keys in `r` must not be less than key of `k`. Roots of `l` and `r`
+    // must be black (or null); `hl` and `hr` are their black heights.
+    // Returns black height of the resulting tree.
+    //
+    // The node `k` is linked into the right spine of `l` (or left spine of
+    // `r`) at the black node whose black height equals the height of the
+    // other tree, so complexity is O(|hl - hr| + 1).
+    //
+    static size_type join(base_node_pointer l,
+                          size_type hl,
+                          base_node_pointer k,
+                          base_node_pointer r,
+                          size_type hr,
+                          base_node_pointer header) noexcept
     {
-    private:
-
-        rb_tree& tree_;
+        base_node_pointer& root = header->left_;
 
-    public:
-
-        make_node_functor(rb_tree& tree)
-            : tree_(tree)
-        {}
-
-        template <typename... Args>
-        node_pointer operator()(Args&&... args)
+        if (hl == hr)
         {
-            node_pointer p = tree_.allocate_node();
+            k->left_ = l;
+            k->right_ = r;
 
-            SFL_TRY
+            if (l != nullptr)
             {
-                tree_.construct_node(p, std::forward<Args>(args)...);
+                l->set_parent(k);
             }
-            SFL_CATCH (...)
+
+            if (r != nullptr)
             {
-                tree_.deallocate_node(p);
-                SFL_RETHROW;
+                r->set_parent(k);
             }
 
-            return p;
+            k->set_parent(header);
+            k->set_color(rb_tree_node_color::black);
+            update_subtree_size(k);
+            root = k;
+
+            return hl + 1;
         }
-    };
 
-    class make_node_with_recycling_functor
-    {
-    private:
+        base_node_pointer parent = header;
+        base_node_pointer x;
 
-        rb_tree& tree_;
+        if (hl > hr)
+        {
+            root = l;
+            l->set_parent(header);
 
-        base_node_pointer root_;
+            x = l;
+            size_type h = hl;
 
-    public:
+            while (x != nullptr && !(x->color() == rb_tree_node_color::black && h == hr))
+            {
+                if (x->color() == rb_tree_node_color::black)
+                {
+                    --h;
+                }
 
-        make_node_with_recycling_functor(rb_tree& tree)
-            : tree_(tree)
-            , root_(tree.data_.root())
-        {
-            tree.data_.reset();
-        }
+                parent = x;
+                x = x->right_;
+            }
 
-        ~make_node_with_recycling_functor()
-        {
-            if (root_ != nullptr)
+            parent->right_ = k;
+            k->left_ = x;
+            k->right_ = r;
+
+            if (r != nullptr)
             {
-                tree_.clear(root_);
+                r->set_parent(k);
             }
         }
-
-        template <typename... Args>
-        node_pointer operator()(Args&&... args)
+        else
         {
-            node_pointer p = this->allocate_node();
+            root = r;
+            r->set_parent(header);
 
-            SFL_TRY
+            x = r;
+            size_type h = hr;
+
+            while (x != nullptr && !(x->color() == rb_tree_node_color::black && h == hl))
             {
-                tree_.construct_node(p, std::forward<Args>(args)...);
+                if (x->color() == rb_tree_node_color::black)
+                {
+                    --h;
+                }
+
+                parent = x;
+                x = x->left_;
             }
-            SFL_CATCH (...)
+
+            parent->left_ = k;
+            k->left_ = l;
+            k->right_ = x;
+
+            if (l != nullptr)
             {
-                tree_.deallocate_node(p);
-                SFL_RETHROW;
+                l->set_parent(k);
             }
+        }
 
-            return p;
+        if (x != nullptr)
+        {
+            x->set_parent(k);
         }
 
-    private:
+        k->set_parent(parent);
+        k->set_color(rb_tree_node_color::red);
 
-        node_pointer allocate_node()
+        if (is_order_statistic::value)
         {
-            if (root_ == nullptr)
+            for (base_node_pointer y = k; y != header; y = y->parent())
             {
-                return tree_.allocate_node();
+                update_subtree_size(y);
             }
-            else
-            {
-                base_node_pointer node = tree_.minimum(root_);
+        }
 
-                if (node != root_)
-                {
-                    node->parent_->left_ = node->right_;
+        const size_type h = (hl > hr) ? hl : hr;
 
-                    if (node->right_ != nullptr)
-                    {
-                        node->right_->parent_ = node->parent_;
-                    }
-                }
-                else
-                {
-                    root_ = node->right_;
+        return insert_fixup(k, root) ? h + 1 : h;
+    }
 
-                    if (node->right_ != nullptr)
-                    {
-                        node->right_->parent_ = nullptr;
-                    }
-                }
+    // Makes subtree `x` standalone tree with black root.
+    static void make_root(base_node_pointer x, size_type& h) noexcept
+    {
+        if (x != nullptr && x->color() == rb_tree_node_color::red)
+        {
+            x->set_color(rb_tree_node_color::black);
+            ++h;
+        }
+    }
 
-                tree_.destroy_node(static_cast<node_pointer>(node));
+    static size_type black_height(base_node_pointer x) noexcept
+    {
+        size_type h = 0;
 
-                return static_cast<node_pointer>(node);
+        while (x != nullptr)
+        {
+            if (x->color() == rb_tree_node_color::black)
+            {
+                ++h;
             }
+
+            x = x->left_;
         }
-    };
 
-    void drop_node(node_pointer p) noexcept
+        return h;
+    }
+
+    // Node handle takes over the node.
+    node_handle extract(base_node_pointer x, std::false_type)
     {
-        destroy_node(p);
-        deallocate_node(p);
+        node_handle nh(static_cast<node_pointer>(x), ref_to_node_alloc());
+        --data_.size_;
+        remove(x, data_.root(), data_.minimum(), data_.maximum());
+        return nh;
+    }
+
+    // Node handle takes over the value, node is dropped.
+    node_handle extract(base_node_pointer x, std::true_type)
+    {
+        node_handle nh(static_cast<node_pointer>(x)->value_);
+        --data_.size_;
+        remove(x, data_.root(), data_.minimum(), data_.maximum());
+        drop_node(static_cast<node_pointer>(x));
+        return nh;
+    }
+
+    node_pointer take_node(node_handle& nh, std::false_type)
+    {
+        SFL_ASSERT(nh.alloc_ == ref_to_node_alloc());
+        return nh.release();
+    }
+
+    node_pointer take_node(node_handle& nh, std::true_type)
+    {
+        make_node_functor make_node(*this);
+        node_pointer x = make_node(std::move(nh.value_));
+        nh.clear();
+        return x;
+    }
+
+    template <typename Tree2>
+    void transfer_node(Tree2& other, base_node_pointer x, base_node_pointer pos, bool left)
+    {
+        if
+        (
+            ref_to_node_alloc() == other.ref_to_node_alloc() &&
+            !sfl::dtl::allocator_traits<node_allocator_type>::is_storage_unpropagable
+            (
+                other.ref_to_node_alloc(),
+                static_cast<node_pointer>(x)
+            )
+        )
+        {
+            --other.data_.size_;
+            remove(x, other.data_.root(), other.data_.minimum(), other.data_.maximum());
+            insert(x, pos, left, data_.root(), data_.minimum(), data_.maximum());
+            ++data_.size_;
+        }
+        else
+        {
+            make_node_functor make_node(*this);
+            node_pointer y = make_node(std::move(static_cast<node_pointer>(x)->value_));
+            insert(y, pos, left, data_.root(), data_.minimum(), data_.maximum());
+            ++data_.size_;
+            --other.data_.size_;
+            remove(x, other.data_.root(), other.data_.minimum(), other.data_.maximum());
+            other.drop_node(static_cast<node_pointer>(x));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1797,6 +3365,13 @@ private:
     template <typename K>
     position_for_insert_equal calculate_position_for_insert_equal(const K& k)
     {
+        // Keys that arrive in increasing order are appended after the
+        // maximum without descending from the root.
+        if (data_.root() != nullptr && !ref_to_comp()(k, key(data_.maximum())))
+        {
+            return position_for_insert_equal{data_.maximum(), false};
+        }
+
         base_node_pointer x = data_.root();
         base_node_pointer y = data_.header();
 
@@ -1824,6 +3399,13 @@ private:
     template <typename K>
     position_for_insert_unique calculate_position_for_insert_unique(const K& k)
     {
+        // Keys that arrive in increasing order are appended after the
+        // maximum without descending from the root.
+        if (data_.root() != nullptr && ref_to_comp()(key(data_.maximum()), k))
+        {
+            return position_for_insert_unique{data_.maximum(), false, true};
+        }
+
         base_node_pointer x = data_.root();
         base_node_pointer y = data_.header();
 
@@ -1865,23 +3447,8 @@ private:
     {
         if (hint == cend())
         {
-            if (empty())
-            {
-                return calculate_position_for_insert_equal(k);
-            }
-            else
-            {
-                const_iterator maximum = std::prev(hint);
-
-                if (!ref_to_comp()(k, key(maximum.node_))) // k >= maximum
-                {
-                    return position_for_insert_equal{maximum.node_, false};
-                }
-                else
-                {
-                    return calculate_position_for_insert_equal(k);
-                }
-            }
+            // Appending after the maximum is checked first.
+            return calculate_position_for_insert_equal(k);
         }
         else if (!ref_to_comp()(key(hint.node_), k)) // k <= hint
         {
@@ -1912,7 +3479,7 @@ private:
         }
         else // hint < k
         {
-            if (hint == std::prev(cend())) // hint == maximum
+            if (hint.node_ == data_.maximum())
             {
                 return position_for_insert_equal{hint.node_, false};
             }
@@ -1944,23 +3511,8 @@ private:
     {
         if (hint == cend())
         {
-            if (empty())
-            {
-                return calculate_position_for_insert_unique(k);
-            }
-            else
-            {
-                const_iterator maximum = std::prev(hint);
-
-                if (ref_to_comp()(key(maximum.node_), k)) // maximum < k
-                {
-                    return position_for_insert_unique{maximum.node_, false, true};
-                }
-                else
-                {
-                    return calculate_position_for_insert_unique(k);
-                }
-            }
+            // Appending after the maximum is checked first.
+            return calculate_position_for_insert_unique(k);
         }
         else if (ref_to_comp()(k, key(hint.node_))) // k < hint
         {
@@ -1991,7 +3543,7 @@ private:
         }
         else if (ref_to_comp()(key(hint.node_), k)) // hint < k
         {
-            if (hint == std::prev(cend())) // hint == maximum
+            if (hint.node_ == data_.maximum())
             {
                 return position_for_insert_unique{hint.node_, false, true};
             }
@@ -2031,7 +3583,8 @@ private:
 
         base_node_pointer y = make_node(static_cast<node_pointer>(x)->value_);
 
-        y->color_ = x->color_;
+        y->set_color(x->color());
+        y->set_subtree_size(x->subtree_size());
         y->left_  = nullptr;
         y->right_ = nullptr;
 
@@ -2040,13 +3593,13 @@ private:
             if (x->left_ != nullptr)
             {
                 y->left_ = copy(x->left_, make_node);
-                y->left_->parent_ = y;
+                y->left_->set_parent(y);
             }
 
             if (x->right_ != nullptr)
             {
                 y->right_ = copy(x->right_, make_node);
-                y->right_->parent_ = y;
+                y->right_->set_parent(y);
             }
         }
         SFL_CATCH (...)
@@ -2065,7 +3618,8 @@ private:
 
         base_node_pointer y = make_node(std::move(static_cast<node_pointer>(x)->value_));
 
-        y->color_ = x->color_;
+        y->set_color(x->color());
+        y->set_subtree_size(x->subtree_size());
         y->left_  = nullptr;
         y->right_ = nullptr;
 
@@ -2074,13 +3628,13 @@ private:
             if (x->left_ != nullptr)
             {
                 y->left_ = move(x->left_, make_node);
-                y->left_->parent_ = y;
+                y->left_->set_parent(y);
             }
 
             if (x->right_ != nullptr)
             {
                 y->right_ = move(x->right_, make_node);
-                y->right_->parent_ = y;
+                y->right_->set_parent(y);
             }
         }
         SFL_CATCH (...)
@@ -2117,7 +3671,9 @@ private:
         {
             make_node_functor make_node(*this);
             data_.root() = copy(other.data_.root(), make_node);
+            data_.root()->set_parent(data_.header());
             data_.minimum() = minimum(data_.root());
+            data_.maximum() = maximum(data_.root());
             data_.size_ = other.data_.size_;
         }
     }
@@ -2133,7 +3689,9 @@ private:
         {
             make_node_functor make_node(*this);
             data_.root() = move(other.data_.root(), make_node);
+            data_.root()->set_parent(data_.header());
             data_.minimum() = minimum(data_.root());
+            data_.maximum() = maximum(data_.root());
             data_.size_ = other.data_.size_;
         }
     }
@@ -2143,12 +3701,28 @@ private:
         initialize_move(other, std::false_type(), typename sfl::dtl::allocator_traits<node_allocator_type>::is_always_equal());
     }
 
+    //
+    // Takes over all nodes of `other`, which must be empty after the call.
+    // This tree must be empty. Root is relinked to the header of this tree.
+    //
+    void take_nodes(rb_tree& other) noexcept
+    {
+        SFL_ASSERT(data_.root() == nullptr);
+
+        if (other.data_.root() != nullptr)
+        {
+            data_.root() = other.data_.root();
+            data_.root()->set_parent(data_.header());
+            data_.minimum() = other.data_.minimum();
+            data_.maximum() = other.data_.maximum();
+            data_.size_ = other.data_.size_;
+            other.data_.reset();
+        }
+    }
+
     void initialize_move(rb_tree& other, std::false_type, std::true_type)
     {
-        data_.root() = other.data_.root();
-        data_.minimum() = other.data_.minimum();
-        data_.size_ = other.data_.size_;
-        other.data_.reset();
+        take_nodes(other);
     }
 
     void initialize_move(rb_tree& other, std::false_type, std::false_type)
@@ -2184,7 +3758,9 @@ private:
             if (other.data_.root() != nullptr)
             {
                 data_.root() = copy(other.data_.root(), make_node);
+                data_.root()->set_parent(data_.header());
                 data_.minimum() = minimum(data_.root());
+                data_.maximum() = maximum(data_.root());
                 data_.size_ = other.data_.size_;
             }
         }
@@ -2214,7 +3790,9 @@ private:
         if (other.data_.root() != nullptr)
         {
             data_.root() = move(other.data_.root(), make_node);
+            data_.root()->set_parent(data_.header());
             data_.minimum() = minimum(data_.root());
+            data_.maximum() = maximum(data_.root());
             data_.size_ = other.data_.size_;
         }
     }
@@ -2235,11 +3813,7 @@ private:
 
         clear();
 
-        data_.root() = other.data_.root();
-        data_.minimum() = other.data_.minimum();
-        data_.size_ = other.data_.size_;
-
-        other.data_.reset();
+        take_nodes(other);
     }
 
     void assign_move(rb_tree& other, std::false_type, std::false_type)
@@ -2266,11 +3840,11 @@ private:
 
         if (old_this != nullptr)
         {
-            old_this->parent_ = nullptr;
+            old_this->set_parent(nullptr);
         }
         if (old_other != nullptr)
         {
-            old_other->parent_ = nullptr;
+            old_other->set_parent(nullptr);
         }
 
         this->data_.reset();
@@ -2309,7 +3883,7 @@ private:
                     SFL_ASSERT(x->left_ == nullptr);
                     SFL_ASSERT(x->right_ == nullptr);
 
-                    base_node_pointer parent = x->parent_;
+                    base_node_pointer parent = x->parent();
 
                     if (parent != nullptr)
                     {
@@ -2369,7 +3943,7 @@ private:
 
                         base_node_pointer p_this_parent = help::detach(p_this);
 
-                        insert(p_this, res.pos, res.left, other.data_.root(), other.data_.minimum());
+                        insert(p_this, res.pos, res.left, other.data_.root(), other.data_.minimum(), other.data_.maximum());
 
                         ++other.data_.size_;
 
@@ -2412,7 +3986,7 @@ private:
 
                         base_node_pointer p_other_parent = help::detach(p_other);
 
-                        insert(p_other, res.pos, res.left, this->data_.root(), this->data_.minimum());
+                        insert(p_other, res.pos, res.left, this->data_.root(), this->data_.minimum(), this->data_.maximum());
 
                         ++this->data_.size_;
 
@@ -2454,7 +4028,7 @@ private:
                     SFL_ASSERT(x->left_ == nullptr);
                     SFL_ASSERT(x->right_ == nullptr);
 
-                    base_node_pointer parent = x->parent_;
+                    base_node_pointer parent = x->parent();
 
                     if (parent != nullptr)
                     {
@@ -2559,9 +4133,23 @@ private:
 
         swap(ref_to_comp(), other.ref_to_comp());
 
-        swap(data_.root(), other.data_.root());
-        swap(data_.minimum(), other.data_.minimum());
-        swap(data_.size_, other.data_.size_);
+        const base_node_pointer old_root = data_.root();
+        const base_node_pointer old_minimum = data_.minimum();
+        const base_node_pointer old_maximum = data_.maximum();
+        const size_type old_size = data_.size_;
+
+        data_.reset();
+
+        take_nodes(other);
+
+        if (old_root != nullptr)
+        {
+            other.data_.root() = old_root;
+            other.data_.root()->set_parent(other.data_.header());
+            other.data_.minimum() = old_minimum;
+            other.data_.maximum() = old_maximum;
+            other.data_.size_ = old_size;
+        }
     }
 
     void swap(rb_tree& other, std::false_type, std::false_type)
@@ -2589,7 +4177,7 @@ private:
 
         while (true)
         {
-            if (x->color_ == rb_tree_node_color::black)
+            if (x->color() == rb_tree_node_color::black)
             {
                 ++count;
             }
@@ -2599,7 +4187,7 @@ private:
                 break;
             }
 
-            x = x->parent_;
+            x = x->parent();
         }
 
         return count;
@@ -2611,7 +4199,8 @@ private:
         {
             return data_.size_ == 0
                 && begin() == end()
-                && data_.header_.parent_ == std::pointer_traits<base_node_pointer>::pointer_to(data_.header_)
+                && data_.minimum_ == std::pointer_traits<base_node_pointer>::pointer_to(data_.header_)
+                && data_.maximum_ == std::pointer_traits<base_node_pointer>::pointer_to(data_.header_)
                 && data_.header_.left_ == nullptr;
         }
 
@@ -2623,12 +4212,12 @@ private:
             node_pointer l = static_cast<node_pointer>(x->left_);
             node_pointer r = static_cast<node_pointer>(x->right_);
 
-            if (x->color_ == rb_tree_node_color::red)
+            if (x->color() == rb_tree_node_color::red)
             {
                 if
                 (
-                    (l != nullptr && l->color_ == rb_tree_node_color::red) ||
-                    (r != nullptr && r->color_ == rb_tree_node_color::red)
+                    (l != nullptr && l->color() == rb_tree_node_color::red) ||
+                    (r != nullptr && r->color() == rb_tree_node_color::red)
                 )
                 {
                     return false;
@@ -2645,17 +4234,32 @@ private:
                 return false;
             }
 
-            if (l == nullptr && r == nullptr && verify_black_count(x, data_.root()) != len)
+            if ((l == nullptr || r == nullptr) && verify_black_count(x, data_.root()) != len)
+            {
+                return false;
+            }
+
+            if (is_order_statistic::value && x->subtree_size() != 1 + subtree_size(l) + subtree_size(r))
             {
                 return false;
             }
         }
 
+        if (is_order_statistic::value && subtree_size(data_.root()) != data_.size_)
+        {
+            return false;
+        }
+
         if (data_.minimum() != minimum(data_.root()))
         {
             return false;
         }
 
+        if (data_.maximum() != maximum(data_.root()))
+        {
+            return false;
+        }
+
         return true;
     }
 };
@@ -2669,12 +4273,13 @@ template < typename Key,
            typename KeyOfValue,
            typename KeyCompare,
            typename Allocator,
-           typename UpperLevelContainer >
+           typename UpperLevelContainer,
+           typename Augment >
 SFL_NODISCARD
 bool operator==
 (
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& x,
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
@@ -2685,12 +4290,13 @@ template < typename Key,
            typename KeyOfValue,
            typename KeyCompare,
            typename Allocator,
-           typename UpperLevelContainer >
+           typename UpperLevelContainer,
+           typename Augment >
 SFL_NODISCARD
 bool operator!=
 (
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& x,
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& y
 )
 {
     return !(x == y);
@@ -2701,12 +4307,13 @@ template < typename Key,
            typename KeyOfValue,
            typename KeyCompare,
            typename Allocator,
-           typename UpperLevelContainer >
+           typename UpperLevelContainer,
+           typename Augment >
 SFL_NODISCARD
 bool operator<
 (
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& x,
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
@@ -2717,12 +4324,13 @@ template < typename Key,
            typename KeyOfValue,
            typename KeyCompare,
            typename Allocator,
-           typename UpperLevelContainer >
+           typename UpperLevelContainer,
+           typename Augment >
 SFL_NODISCARD
 bool operator>
 (
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& x,
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& y
 )
 {
     return y < x;
@@ -2733,12 +4341,13 @@ template < typename Key,
            typename KeyOfValue,
            typename KeyCompare,
            typename Allocator,
-           typename UpperLevelContainer >
+           typename UpperLevelContainer,
+           typename Augment >
 SFL_NODISCARD
 bool operator<=
 (
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& x,
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& y
 )
 {
     return !(y < x);
@@ -2749,12 +4358,13 @@ template < typename Key,
            typename KeyOfValue,
            typename KeyCompare,
            typename Allocator,
-           typename UpperLevelContainer >
+           typename UpperLevelContainer,
+           typename Augment >
 SFL_NODISCARD
 bool operator>=
 (
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
-    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& x,
+    const rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& y
 )
 {
     return !(x < y);
@@ -2765,11 +4375,12 @@ template < typename Key,
            typename KeyOfValue,
            typename KeyCompare,
            typename Allocator,
-           typename UpperLevelContainer >
+           typename UpperLevelContainer,
+           typename Augment >
 void swap
 (
-    rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& x,
-    rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer>& y
+    rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& x,
+    rb_tree<Key, Value, KeyOfValue, KeyCompare, Allocator, UpperLevelContainer, Augment>& y
 )
 {
     x.swap(y);
@@ -0,0 +1,327 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_SIMD_FIND_HPP_INCLUDED
+#define SFL_DETAIL_SIMD_FIND_HPP_INCLUDED
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <cstring>      // memcpy
+#include <functional>   // equal_to
+#include <type_traits>  // integral_constant, is_integral, is_pointer, is_same
+
+#ifndef SFL_NO_SIMD
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define SFL_DTL_SIMD_SSE2
+        #include <emmintrin.h>
+    #endif
+    #if defined(__AVX2__)
+        #define SFL_DTL_SIMD_AVX2
+        #include <immintrin.h>
+    #endif
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#endif
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Checks if unsorted range of keys of type `Key` compared by `KeyEqual` can be
+// searched by comparing several keys at once. That is the case for integral
+// and pointer keys compared by `std::equal_to`, where two keys are equal
+// if and only if their object representations are equal.
+//
+template <typename Key, typename KeyEqual>
+struct is_simd_searchable : std::integral_constant
+<
+    bool,
+    (std::is_integral<Key>::value || std::is_pointer<Key>::value) &&
+    (sizeof(Key) == 1 || sizeof(Key) == 2 || sizeof(Key) == 4 || sizeof(Key) == 8) &&
+    (
+        std::is_same<KeyEqual, std::equal_to<Key>>::value ||
+        std::is_same<KeyEqual, std::equal_to<void>>::value
+    )
+> {};
+
+#if defined(SFL_DTL_SIMD_SSE2) || defined(SFL_DTL_SIMD_AVX2)
+
+template <std::size_t Size>
+struct simd_lane;
+
+template <>
+struct simd_lane<1>
+{
+    using type = std::uint8_t;
+};
+
+template <>
+struct simd_lane<2>
+{
+    using type = std::uint16_t;
+};
+
+template <>
+struct simd_lane<4>
+{
+    using type = std::uint32_t;
+};
+
+template <>
+struct simd_lane<8>
+{
+    using type = std::uint64_t;
+};
+
+inline unsigned simd_count_trailing_zeros(unsigned mask) noexcept
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return unsigned(index);
+    #else
+    return unsigned(__builtin_ctz(mask));
+    #endif
+}
+
+#endif
+
+#ifdef SFL_DTL_SIMD_SSE2
+
+//
+// Compares 16 bytes with broadcasted key. Returns mask that has set the lowest
+// bit of each byte group which holds key equal to the searched one.
+//
+template <std::size_t Size>
+struct sse2_find;
+
+template <>
+struct sse2_find<1>
+{
+    static __m128i broadcast(std::uint8_t x) noexcept
+    {
+        return _mm_set1_epi8(static_cast<char>(x));
+    }
+
+    static unsigned match(__m128i v, __m128i needle) noexcept
+    {
+        return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+    }
+};
+
+template <>
+struct sse2_find<2>
+{
+    static __m128i broadcast(std::uint16_t x) noexcept
+    {
+        return _mm_set1_epi16(static_cast<short>(x));
+    }
+
+    static unsigned match(__m128i v, __m128i needle) noexcept
+    {
+        return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi16(v, needle))) & 0x5555u;
+    }
+};
+
+template <>
+struct sse2_find<4>
+{
+    static __m128i broadcast(std::uint32_t x) noexcept
+    {
+        return _mm_set1_epi32(static_cast<int>(x));
+    }
+
+    static unsigned match(__m128i v, __m128i needle) noexcept
+    {
+        return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi32(v, needle))) & 0x1111u;
+    }
+};
+
+template <>
+struct sse2_find<8>
+{
+    static __m128i broadcast(std::uint64_t x) noexcept
+    {
+        return _mm_set1_epi64x(static_cast<long long>(x));
+    }
+
+    static unsigned match(__m128i v, __m128i needle) noexcept
+    {
+        // SSE2 has no 64-bit compare. Both 32-bit halves must be equal.
+        const unsigned m = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi32(v, needle)));
+        return m & (m >> 4) & 0x0101u;
+    }
+};
+
+#endif // SFL_DTL_SIMD_SSE2
+
+#ifdef SFL_DTL_SIMD_AVX2
+
+//
+// Same as `sse2_find`, but compares 32 bytes at once.
+//
+template <std::size_t Size>
+struct avx2_find;
+
+template <>
+struct avx2_find<1>
+{
+    static __m256i broadcast(std::uint8_t x) noexcept
+    {
+        return _mm256_set1_epi8(static_cast<char>(x));
+    }
+
+    static unsigned match(__m256i v, __m256i needle) noexcept
+    {
+        return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+    }
+};
+
+template <>
+struct avx2_find<2>
+{
+    static __m256i broadcast(std::uint16_t x) noexcept
+    {
+        return _mm256_set1_epi16(static_cast<short>(x));
+    }
+
+    static unsigned match(__m256i v, __m256i needle) noexcept
+    {
+        return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi16(v, needle))) & 0x55555555u;
+    }
+};
+
+template <>
+struct avx2_find<4>
+{
+    static __m256i broadcast(std::uint32_t x) noexcept
+    {
+        return _mm256_set1_epi32(static_cast<int>(x));
+    }
+
+    static unsigned match(__m256i v, __m256i needle) noexcept
+    {
+        return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi32(v, needle))) & 0x11111111u;
+    }
+};
+
+template <>
+struct avx2_find<8>
+{
+    static __m256i broadcast(std::uint64_t x) noexcept
+    {
+        return _mm256_set1_epi64x(static_cast<long long>(x));
+    }
+
+    static unsigned match(__m256i v, __m256i needle) noexcept
+    {
+        return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi64(v, needle))) & 0x01010101u;
+    }
+};
+
+#endif // SFL_DTL_SIMD_AVX2
+
+//
+// Returns pointer to the first key in [first, last) equal to `key`, or `last`
+// if there is no such key. Keys are compared by object representation, so
+// this function may be used only if `is_simd_searchable` is true.
+//
+// Uses AVX2 or SSE2 compare instructions if they are enabled at compile time
+// (unless SFL_NO_SIMD is defined) and falls back to scalar loop otherwise.
+// The tail that doesn't fill a whole vector register is always compared by
+// scalar loop.
+//
+template <typename Key>
+const Key* simd_find(const Key* first, const Key* last, const Key& key) noexcept
+{
+    #if defined(SFL_DTL_SIMD_SSE2) || defined(SFL_DTL_SIMD_AVX2)
+
+    constexpr std::size_t size = sizeof(Key);
+
+    typename sfl::dtl::simd_lane<size>::type bits;
+    std::memcpy(&bits, &key, size);
+
+    #endif
+
+    #ifdef SFL_DTL_SIMD_AVX2
+
+    {
+        constexpr std::ptrdiff_t step = 32 / size;
+
+        const __m256i needle = sfl::dtl::avx2_find<size>::broadcast(bits);
+
+        while (last - first >= step)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+
+            const unsigned mask = sfl::dtl::avx2_find<size>::match(v, needle);
+
+            if (mask != 0)
+            {
+                return first + sfl::dtl::simd_count_trailing_zeros(mask) / size;
+            }
+
+            first += step;
+        }
+    }
+
+    #endif // SFL_DTL_SIMD_AVX2
+
+    #ifdef SFL_DTL_SIMD_SSE2
+
+    {
+        constexpr std::ptrdiff_t step = 16 / size;
+
+        const __m128i needle = sfl::dtl::sse2_find<size>::broadcast(bits);
+
+        while (last - first >= step)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+
+            const unsigned mask = sfl::dtl::sse2_find<size>::match(v, needle);
+
+            if (mask != 0)
+            {
+                return first + sfl::dtl::simd_count_trailing_zeros(mask) / size;
+            }
+
+            first += step;
+        }
+    }
+
+    #endif // SFL_DTL_SIMD_SSE2
+
+    while (first != last && !(*first == key))
+    {
+        ++first;
+    }
+
+    return first;
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_SIMD_FIND_HPP_INCLUDED
@@ -0,0 +1,257 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_SOA_ITERATOR_HPP_INCLUDED
+#define SFL_DETAIL_SOA_ITERATOR_HPP_INCLUDED
+
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/type_traits.hpp>
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Result of `operator->` of iterators that return proxy reference.
+// It holds the proxy reference and returns pointer to it.
+//
+template <typename Reference>
+class arrow_proxy
+{
+private:
+
+    Reference ref_;
+
+public:
+
+    explicit arrow_proxy(const Reference& ref) noexcept
+        : ref_(ref)
+    {}
+
+    SFL_NODISCARD
+    Reference* operator->() noexcept
+    {
+        return std::addressof(ref_);
+    }
+};
+
+//
+// Random access iterator over two parallel arrays (struct of arrays).
+// It holds pointer into array of keys and pointer into array of mapped values.
+// Dereferencing returns `std::pair` of references to key and mapped value.
+//
+template <typename KeyPointer, typename MappedPointer, typename Container>
+class soa_iterator
+{
+    template <typename, typename, typename>
+    friend class soa_iterator;
+
+    friend Container;
+
+private:
+
+    KeyPointer    key_;
+    MappedPointer mapped_;
+
+    using key_reference    = typename std::iterator_traits<KeyPointer>::reference;
+    using mapped_reference = typename std::iterator_traits<MappedPointer>::reference;
+
+public:
+
+    using difference_type   = typename std::iterator_traits<KeyPointer>::difference_type;
+    using value_type        = std::pair
+                              <
+                                  typename std::iterator_traits<KeyPointer>::value_type,
+                                  typename std::iterator_traits<MappedPointer>::value_type
+                              >;
+    using reference         = std::pair<key_reference, mapped_reference>;
+    using pointer           = sfl::dtl::arrow_proxy<reference>;
+    using iterator_category = std::random_access_iterator_tag;
+
+private:
+
+    soa_iterator(const KeyPointer& key, const MappedPointer& mapped) noexcept
+        : key_(key)
+        , mapped_(mapped)
+    {}
+
+public:
+
+    // Default constructor
+    soa_iterator() noexcept
+        : key_()
+        , mapped_()
+    {}
+
+    // Copy constructor
+    soa_iterator(const soa_iterator& other) noexcept
+        : key_(other.key_)
+        , mapped_(other.mapped_)
+    {}
+
+    // Converting constructor (from iterator to const_iterator)
+    template <typename OtherMappedPointer,
+              sfl::dtl::enable_if_t<std::is_convertible<OtherMappedPointer, MappedPointer>::value>* = nullptr>
+    soa_iterator(const soa_iterator<KeyPointer, OtherMappedPointer, Container>& other) noexcept
+        : key_(other.key_)
+        , mapped_(other.mapped_)
+    {}
+
+    // Copy assignment operator
+    soa_iterator& operator=(const soa_iterator& other) noexcept
+    {
+        key_    = other.key_;
+        mapped_ = other.mapped_;
+        return *this;
+    }
+
+    SFL_NODISCARD
+    reference operator*() const noexcept
+    {
+        return reference(*key_, *mapped_);
+    }
+
+    SFL_NODISCARD
+    pointer operator->() const noexcept
+    {
+        return pointer(**this);
+    }
+
+    soa_iterator& operator++() noexcept
+    {
+        ++key_;
+        ++mapped_;
+        return *this;
+    }
+
+    soa_iterator operator++(int) noexcept
+    {
+        auto temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    soa_iterator& operator--() noexcept
+    {
+        --key_;
+        --mapped_;
+        return *this;
+    }
+
+    soa_iterator operator--(int) noexcept
+    {
+        auto temp = *this;
+        --*this;
+        return temp;
+    }
+
+    soa_iterator& operator+=(difference_type n) noexcept
+    {
+        key_    += n;
+        mapped_ += n;
+        return *this;
+    }
+
+    soa_iterator& operator-=(difference_type n) noexcept
+    {
+        key_    -= n;
+        mapped_ -= n;
+        return *this;
+    }
+
+    SFL_NODISCARD
+    soa_iterator operator+(difference_type n) const noexcept
+    {
+        return soa_iterator(key_ + n, mapped_ + n);
+    }
+
+    SFL_NODISCARD
+    soa_iterator operator-(difference_type n) const noexcept
+    {
+        return soa_iterator(key_ - n, mapped_ - n);
+    }
+
+    SFL_NODISCARD
+    reference operator[](difference_type n) const noexcept
+    {
+        return reference(key_[n], mapped_[n]);
+    }
+
+    SFL_NODISCARD
+    friend soa_iterator operator+(difference_type n, const soa_iterator& it) noexcept
+    {
+        return it + n;
+    }
+
+    SFL_NODISCARD
+    friend difference_type operator-(const soa_iterator& x, const soa_iterator& y) noexcept
+    {
+        return x.key_ - y.key_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator==(const soa_iterator& x, const soa_iterator& y) noexcept
+    {
+        return x.key_ == y.key_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator!=(const soa_iterator& x, const soa_iterator& y) noexcept
+    {
+        return !(x == y);
+    }
+
+    SFL_NODISCARD
+    friend bool operator<(const soa_iterator& x, const soa_iterator& y) noexcept
+    {
+        return x.key_ < y.key_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator>(const soa_iterator& x, const soa_iterator& y) noexcept
+    {
+        return y < x;
+    }
+
+    SFL_NODISCARD
+    friend bool operator<=(const soa_iterator& x, const soa_iterator& y) noexcept
+    {
+        return !(y < x);
+    }
+
+    SFL_NODISCARD
+    friend bool operator>=(const soa_iterator& x, const soa_iterator& y) noexcept
+    {
+        return !(x < y);
+    }
+};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_SOA_ITERATOR_HPP_INCLUDED
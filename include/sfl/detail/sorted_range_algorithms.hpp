@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_SORTED_RANGE_ALGORITHMS_HPP_INCLUDED
+#define SFL_DETAIL_SORTED_RANGE_ALGORITHMS_HPP_INCLUDED
+
+#include <algorithm>
+#include <iterator>
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Checks if range [first, last) is sorted and contains no equivalent elements.
+//
+template <typename ForwardIt, typename Compare>
+bool is_sorted_unique(ForwardIt first, ForwardIt last, Compare comp)
+{
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+
+    return std::adjacent_find
+    (
+        first,
+        last,
+        [&comp](const value_type& x, const value_type& y)
+        {
+            return !comp(x, y);
+        }
+    ) == last;
+}
+
+//
+// Sorts elements in range [mid, last) and removes equivalent elements. Returns
+// iterator to the new end of range. Elements in range [new_last, last) are in
+// moved-from state.
+//
+// Kept elements are the same elements that would be kept if elements from
+// range [mid, last) were inserted one by one into unique sorted range.
+//
+template <typename RandomIt, typename Compare>
+RandomIt sort_unique_tail(RandomIt mid, RandomIt last, Compare comp)
+{
+    std::stable_sort(mid, last, comp);
+
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    // Sorted range, so `x` and `y` are equivalent if `x` is not less than `y`.
+    return std::unique
+    (
+        mid,
+        last,
+        [&comp](const value_type& x, const value_type& y)
+        {
+            return !comp(x, y);
+        }
+    );
+}
+
+//
+// Removes elements from sorted range [mid, last) that are equivalent to any
+// element in sorted range [first, mid). Returns iterator to the new end of
+// range [mid, last). Elements in range [new_last, last) are in moved-from
+// state.
+//
+template <typename RandomIt, typename Compare>
+RandomIt remove_equivalent_tail(RandomIt first, RandomIt mid, RandomIt last, Compare comp)
+{
+    if (first == mid || mid == last || comp(*std::prev(mid), *mid))
+    {
+        return last;
+    }
+
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    return std::remove_if
+    (
+        mid,
+        last,
+        [&comp, first, mid](const value_type& x)
+        {
+            return std::binary_search(first, mid, x, comp);
+        }
+    );
+}
+
+//
+// Sorts elements in range [mid, last). Equivalent elements end up in the same
+// order as if elements were inserted one by one, each one before elements
+// equivalent to it (i.e. at lower bound).
+//
+template <typename RandomIt, typename Compare>
+void sort_equal_tail(RandomIt mid, RandomIt last, Compare comp)
+{
+    std::reverse(mid, last);
+    std::stable_sort(mid, last, comp);
+}
+
+//
+// Merges sorted ranges [first, mid) and [mid, last). Elements from range
+// [mid, last) precede equivalent elements from range [first, mid).
+//
+template <typename RandomIt, typename Compare>
+void merge_tail(RandomIt first, RandomIt mid, RandomIt last, Compare comp)
+{
+    if (first == mid || mid == last || comp(*std::prev(mid), *mid))
+    {
+        return;
+    }
+
+    // Elements in range [first, pos) are less than all elements in range
+    // [mid, last) so they are already at the right place.
+    const RandomIt pos = std::lower_bound(first, mid, *mid, comp);
+    const RandomIt new_mid = pos + std::distance(mid, last);
+
+    std::rotate(pos, mid, last);
+    std::inplace_merge(pos, new_mid, last, comp);
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_SORTED_RANGE_ALGORITHMS_HPP_INCLUDED
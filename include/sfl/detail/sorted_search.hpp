@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_SORTED_SEARCH_HPP_INCLUDED
+#define SFL_DETAIL_SORTED_SEARCH_HPP_INCLUDED
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Checks if sorted range of keys of type `Key` ordered by `Compare` should be
+// searched by branchless binary search. That is the case for arithmetic keys
+// compared by `std::less`, where comparison is cheap and the result of
+// comparison can be turned into conditional move instead of branch.
+//
+template <typename Key, typename Compare>
+struct is_branchless_searchable : std::integral_constant
+<
+    bool,
+    std::is_arithmetic<Key>::value &&
+    (
+        std::is_same<Compare, std::less<Key>>::value ||
+        std::is_same<Compare, std::less<void>>::value
+    )
+> {};
+
+//
+// Hints the processor to load the cache line that contains element pointed
+// by `it` into cache. Does nothing if compiler doesn't support this.
+//
+template <typename RandomIt>
+void prefetch(const RandomIt& it) noexcept
+{
+    #if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(std::addressof(*it));
+    #else
+    (void)it;
+    #endif
+}
+
+//
+// Branchless binary search. Returns the first element in sorted range
+// [first, last) such that `pred(element)` is false. Range must be partitioned
+// with respect to `pred`.
+//
+// The number of iterations depends only on the size of range, and the next
+// middle element is selected without branching. Both candidates for the next
+// middle element are prefetched while the current one is compared.
+//
+template <typename RandomIt, typename Predicate>
+RandomIt branchless_partition_point(RandomIt first, RandomIt last, Predicate pred)
+{
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+    difference_type n = std::distance(first, last);
+
+    if (n == 0)
+    {
+        return first;
+    }
+
+    while (n > 1)
+    {
+        const difference_type half = n / 2;
+
+        sfl::dtl::prefetch(first + half / 2);
+        sfl::dtl::prefetch(first + half + half / 2);
+
+        first = pred(first[half]) ? first + half : first;
+        n -= half;
+    }
+
+    return first + difference_type(pred(*first));
+}
+
+template <typename RandomIt, typename T, typename Compare>
+RandomIt sorted_lower_bound(RandomIt first, RandomIt last, const T& x, Compare comp, std::false_type)
+{
+    return std::lower_bound(first, last, x, comp);
+}
+
+template <typename RandomIt, typename T, typename Compare>
+RandomIt sorted_lower_bound(RandomIt first, RandomIt last, const T& x, Compare comp, std::true_type)
+{
+    using reference = typename std::iterator_traits<RandomIt>::reference;
+
+    return sfl::dtl::branchless_partition_point
+    (
+        first,
+        last,
+        [&](reference elem)
+        {
+            return comp(elem, x);
+        }
+    );
+}
+
+template <typename RandomIt, typename T, typename Compare>
+RandomIt sorted_upper_bound(RandomIt first, RandomIt last, const T& x, Compare comp, std::false_type)
+{
+    return std::upper_bound(first, last, x, comp);
+}
+
+template <typename RandomIt, typename T, typename Compare>
+RandomIt sorted_upper_bound(RandomIt first, RandomIt last, const T& x, Compare comp, std::true_type)
+{
+    using reference = typename std::iterator_traits<RandomIt>::reference;
+
+    return sfl::dtl::branchless_partition_point
+    (
+        first,
+        last,
+        [&](reference elem)
+        {
+            return !comp(x, elem);
+        }
+    );
+}
+
+template <typename RandomIt, typename T, typename Compare>
+std::pair<RandomIt, RandomIt> sorted_equal_range(RandomIt first, RandomIt last, const T& x, Compare comp, std::false_type)
+{
+    return std::equal_range(first, last, x, comp);
+}
+
+template <typename RandomIt, typename T, typename Compare>
+std::pair<RandomIt, RandomIt> sorted_equal_range(RandomIt first, RandomIt last, const T& x, Compare comp, std::true_type)
+{
+    const RandomIt lower = sfl::dtl::sorted_lower_bound(first, last, x, comp, std::true_type());
+    const RandomIt upper = sfl::dtl::sorted_upper_bound(lower, last, x, comp, std::true_type());
+    return std::make_pair(lower, upper);
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_SORTED_SEARCH_HPP_INCLUDED
@@ -30,6 +30,13 @@ struct default_init_t { };
 // Type used to tag that container is constructed from range.
 struct from_range_t { };
 
+// Type used to tag that the input range is sorted and contains no equivalent
+// elements.
+struct sorted_unique_t { };
+
+// Type used to tag that the input range is sorted.
+struct sorted_equivalent_t { };
+
 } // namespace sfl
 
 #endif // SFL_DETAIL_TAGS_HPP_INCLUDED
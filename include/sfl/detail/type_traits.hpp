@@ -27,6 +27,39 @@
 namespace sfl
 {
 
+//
+// Checks if `T` is trivially relocatable, i.e. if moving an object of type `T`
+// to a new location and destroying the original object is equivalent to
+// copying bytes of the original object by `memcpy`.
+//
+// By default only trivially copyable types are trivially relocatable. Users can
+// specialize this template for their own types (for example types that hold
+// a pointer to heap allocated memory, such as `std::unique_ptr`).
+//
+// Note: Containers relocate such elements without calling `construct` and
+// `destroy` members of the allocator.
+//
+template <typename T>
+struct is_trivially_relocatable
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 5
+    : std::integral_constant<bool, __has_trivial_copy(T) && __has_trivial_destructor(T)> {};
+#else
+    : std::is_trivially_copyable<T> {};
+#endif
+
+//
+// Checks if pointer type `Pointer` can be converted to raw pointer and back
+// (by `std::pointer_traits<Pointer>::pointer_to`) without losing information.
+// Red-black tree nodes that use such pointers store the node color in the least
+// significant bit of the address of the parent node, which makes nodes smaller.
+//
+// By default only raw pointers have this property. Users can specialize this
+// template for fancy pointers that just wrap raw pointers. Pointers whose value
+// depends on their own address (such as offset pointers) must not be marked.
+//
+template <typename Pointer>
+struct pointer_has_spare_low_bits : std::is_pointer<Pointer> {};
+
 namespace dtl
 {
 
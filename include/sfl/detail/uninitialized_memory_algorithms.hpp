@@ -21,13 +21,17 @@
 #ifndef SFL_DETAIL_UNINITIALIZED_MEMORY_ALGORITHMS_HPP_INCLUDED
 #define SFL_DETAIL_UNINITIALIZED_MEMORY_ALGORITHMS_HPP_INCLUDED
 
+#include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
+#include <sfl/detail/ignore_unused.hpp>
 #include <sfl/detail/to_address.hpp>
 #include <sfl/detail/type_traits.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace sfl
@@ -55,6 +59,34 @@ void deallocate(Allocator& a, Pointer p, Size n) noexcept
     }
 }
 
+//
+// Tries to resize storage in place. See `sfl::dtl::allocator_traits`.
+//
+template <typename Allocator, typename Pointer, typename Size>
+bool try_expand(Allocator& a, Pointer p, Size n, Size new_n)
+{
+    if (p != nullptr)
+    {
+        return sfl::dtl::allocator_traits<Allocator>::try_expand(a, p, n, new_n);
+    }
+    return false;
+}
+
+//
+// Tries to resize storage of trivially relocatable elements (the storage can
+// be moved). Returns null pointer if operation is not supported.
+// See `sfl::dtl::allocator_traits`.
+//
+template <typename Allocator, typename Pointer, typename Size>
+Pointer try_reallocate(Allocator& a, Pointer p, Size n, Size new_n)
+{
+    if (p != nullptr && new_n != 0)
+    {
+        return sfl::dtl::allocator_traits<Allocator>::try_reallocate(a, p, n, new_n);
+    }
+    return nullptr;
+}
+
 template <typename Allocator, typename Pointer, typename... Args>
 void construct_at_a(Allocator& a, Pointer p, Args&&... args)
 {
@@ -1007,6 +1039,110 @@ ForwardIt uninitialized_move_if_noexcept_a(Allocator& a, InputIt first, InputIt
     }
 }
 
+//
+// Relocation of elements is done in two steps:
+//
+//   1. `uninitialized_relocate_a` constructs elements at new location.
+//   2. `destroy_relocated_a` ends the lifetime of elements at old location.
+//
+// The second step must be done after all operations that may throw.
+//
+// If `T` is trivially relocatable then the first step is a single `memcpy`
+// and the second step does nothing. Otherwise, the first step is the same as
+// `uninitialized_move_if_noexcept_a` and the second step is the same as
+// `destroy_a`.
+//
+
+template <typename Pointer>
+Pointer trivially_relocate(Pointer first, Pointer last, Pointer d_first) noexcept
+{
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    const auto n = std::distance(first, last);
+
+    if (n > 0)
+    {
+        // Ranges may overlap.
+        std::memmove
+        (
+            static_cast<void*>(sfl::dtl::to_address(d_first)),
+            static_cast<const void*>(sfl::dtl::to_address(first)),
+            n * sizeof(value_type)
+        );
+    }
+
+    return d_first + n;
+}
+
+//
+// Trivially relocates the last element in range [first, last) to position
+// `first` and all other elements one position to the right.
+//
+template <typename Pointer>
+void trivially_rotate_right_by_one(Pointer first, Pointer last) noexcept
+{
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    SFL_ASSERT(first != last);
+
+    alignas(value_type) unsigned char tmp[sizeof(value_type)];
+
+    std::memcpy
+    (
+        static_cast<void*>(tmp),
+        static_cast<const void*>(sfl::dtl::to_address(last - 1)),
+        sizeof(value_type)
+    );
+
+    sfl::dtl::trivially_relocate(first, last - 1, first + 1);
+
+    std::memcpy
+    (
+        static_cast<void*>(sfl::dtl::to_address(first)),
+        static_cast<const void*>(tmp),
+        sizeof(value_type)
+    );
+}
+
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a(Allocator& a, Pointer first, Pointer last, Pointer d_first, std::true_type) noexcept
+{
+    sfl::dtl::ignore_unused(a);
+    return sfl::dtl::trivially_relocate(first, last, d_first);
+}
+
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a(Allocator& a, Pointer first, Pointer last, Pointer d_first, std::false_type)
+{
+    return sfl::dtl::uninitialized_move_if_noexcept_a(a, first, last, d_first);
+}
+
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a(Allocator& a, Pointer first, Pointer last, Pointer d_first)
+{
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    return sfl::dtl::uninitialized_relocate_a
+    (
+        a,
+        first,
+        last,
+        d_first,
+        typename sfl::is_trivially_relocatable<value_type>::type()
+    );
+}
+
+template <typename Allocator, typename Pointer>
+void destroy_relocated_a(Allocator& a, Pointer first, Pointer last) noexcept
+{
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    if (!sfl::is_trivially_relocatable<value_type>::value)
+    {
+        sfl::dtl::destroy_a(a, first, last);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_UNORDERED_RANGE_ALGORITHMS_HPP_INCLUDED
+#define SFL_DETAIL_UNORDERED_RANGE_ALGORITHMS_HPP_INCLUDED
+
+#include <sfl/detail/scope_guard.hpp>
+#include <sfl/detail/to_address.hpp>
+#include <sfl/detail/type_traits.hpp>
+#include <sfl/detail/uninitialized_memory_algorithms.hpp>
+
+#include <algorithm>    // binary_search, sort
+#include <functional>   // equal_to, less
+#include <iterator>     // distance
+#include <memory>       // allocator_traits
+#include <type_traits>  // integral_constant, is_xxxxx
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Checks if keys of type `Key` compared by `KeyEqual` can be deduplicated by
+// sorting them with `std::less<Key>`. That is the case for integral, enum
+// and pointer keys compared by `std::equal_to`, where `std::less` is a strict
+// total order consistent with equality.
+//
+template <typename Key, typename KeyEqual>
+struct is_batch_sortable : std::integral_constant
+<
+    bool,
+    (std::is_integral<Key>::value || std::is_enum<Key>::value || std::is_pointer<Key>::value) &&
+    (
+        std::is_same<KeyEqual, std::equal_to<Key>>::value ||
+        std::is_same<KeyEqual, std::equal_to<void>>::value
+    )
+> {};
+
+//
+// Removes elements from range [mid, last) whose key is equal to the key of
+// any element in range [first, mid) or to the key of any preceding element in
+// range [mid, last). Kept elements preserve their relative order. Returns
+// iterator to the new end of range. Elements in range [new_last, last) are in
+// moved-from state.
+//
+// Kept elements are the same elements that would be kept if elements from
+// range [mid, last) were inserted one by one into unique unsorted range.
+//
+// Keys are sorted in temporary arrays allocated by `alloc`, so the complexity
+// is O(n log n + m log m) instead of O(n m) comparisons. Keys must satisfy
+// `is_batch_sortable`.
+//
+template <typename Allocator, typename RandomIt, typename KeyOf>
+RandomIt remove_duplicate_keys_tail(Allocator& alloc, RandomIt first, RandomIt mid, RandomIt last, KeyOf key_of)
+{
+    using key_type  = sfl::dtl::remove_cvref_t<decltype(key_of(*first))>;
+    using size_type = typename std::allocator_traits<Allocator>::size_type;
+
+    using key_allocator  = typename std::allocator_traits<Allocator>::template rebind_alloc<key_type>;
+    using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<size_type>;
+
+    const size_type n = std::distance(first, mid);
+    const size_type m = std::distance(mid, last);
+
+    if (m == 0)
+    {
+        return last;
+    }
+
+    const std::less<key_type> less;
+
+    key_allocator  key_alloc(alloc);
+    slot_allocator slot_alloc(alloc);
+
+    const auto keys = sfl::dtl::allocate(key_alloc, n);
+
+    const auto sg1 = sfl::dtl::make_scope_guard([&](){
+        sfl::dtl::deallocate(key_alloc, keys, n);
+    });
+
+    const auto slots = sfl::dtl::allocate(slot_alloc, m);
+
+    const auto sg2 = sfl::dtl::make_scope_guard([&](){
+        sfl::dtl::deallocate(slot_alloc, slots, m);
+    });
+
+    // Keys of existing elements, sorted.
+    key_type* const k = sfl::dtl::to_address(keys);
+
+    for (size_type i = 0; i < n; ++i)
+    {
+        sfl::dtl::construct_at_a(key_alloc, keys + i, key_of(first[i]));
+    }
+
+    std::sort(k, k + n, less);
+
+    // Positions of new elements, sorted by key and then by position.
+    size_type* const s = sfl::dtl::to_address(slots);
+
+    for (size_type i = 0; i < m; ++i)
+    {
+        sfl::dtl::construct_at_a(slot_alloc, slots + i, i);
+    }
+
+    std::sort
+    (
+        s,
+        s + m,
+        [&](size_type x, size_type y)
+        {
+            const key_type& kx = key_of(mid[x]);
+            const key_type& ky = key_of(mid[y]);
+            return less(kx, ky) || (!less(ky, kx) && x < y);
+        }
+    );
+
+    // Keep the first position of each key that is not found among existing
+    // elements. Kept positions are stored at the beginning of the array.
+    size_type count = 0;
+
+    for (size_type i = 0; i < m; ++i)
+    {
+        const size_type pos = s[i];
+
+        const key_type& key = key_of(mid[pos]);
+
+        // Sorted by key, so `key` is a duplicate if it is not greater than
+        // the key of previous position.
+        if (i != 0 && !less(key_of(mid[s[i - 1]]), key))
+        {
+            continue;
+        }
+
+        if (!std::binary_search(k, k + n, key, less))
+        {
+            // count <= i, so s[i - 1] still holds its own position.
+            s[count++] = pos;
+        }
+    }
+
+    std::sort(s, s + count);
+
+    RandomIt out = mid;
+
+    for (size_type i = 0; i < count; ++i)
+    {
+        const RandomIt p = mid + s[i];
+
+        if (p != out)
+        {
+            *out = std::move(*p);
+        }
+
+        ++out;
+    }
+
+    return out;
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_UNORDERED_RANGE_ALGORITHMS_HPP_INCLUDED
@@ -43,6 +43,17 @@
 #include <tuple>            // tuple
 #include <utility>          // forward, move, pair
 
+//
+// When `emplace_front` or `emplace_back` runs out of space at one end of the
+// storage, devector recenters elements inside the existing storage (instead
+// of allocating new storage) if the free space left after insertion is at
+// least this percentage of `size()`. Greater value means fewer element moves
+// and more unused memory.
+//
+#ifndef SFL_DEVECTOR_RECENTER_THRESHOLD
+#define SFL_DEVECTOR_RECENTER_THRESHOLD 100
+#endif
+
 #ifdef SFL_TEST_DEVECTOR
 template <int>
 void test_devector();
@@ -513,7 +524,7 @@ public:
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -533,7 +544,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -578,7 +589,7 @@ public:
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -598,7 +609,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -632,7 +643,7 @@ public:
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -652,7 +663,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -943,7 +954,28 @@ public:
         const pointer p1 = data_.first_ + std::distance(cbegin(), pos);
         const pointer p2 = p1 + 1;
 
-        if (dist_to_begin < dist_to_end)
+        if (sfl::is_trivially_relocatable<value_type>::value)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), p1);
+
+            if (dist_to_begin < dist_to_end)
+            {
+                const pointer new_first = data_.first_ + 1;
+
+                sfl::dtl::trivially_relocate(data_.first_, p1, new_first);
+
+                data_.first_ = new_first;
+
+                return iterator(p2);
+            }
+            else
+            {
+                data_.last_ = sfl::dtl::trivially_relocate(p2, data_.last_, p1);
+
+                return iterator(p1);
+            }
+        }
+        else if (dist_to_begin < dist_to_end)
         {
             const pointer old_first = data_.first_;
 
@@ -980,11 +1012,24 @@ public:
             const pointer p1 = data_.first_ + std::distance(cbegin(), first);
             const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
-            const pointer new_first = sfl::dtl::move_backward(data_.first_, p1, p2);
+            if (sfl::is_trivially_relocatable<value_type>::value)
+            {
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), p1, p2);
 
-            sfl::dtl::destroy_a(data_.ref_to_alloc(), data_.first_, new_first);
+                const pointer new_first = data_.first_ + std::distance(p1, p2);
 
-            data_.first_ = new_first;
+                sfl::dtl::trivially_relocate(data_.first_, p1, new_first);
+
+                data_.first_ = new_first;
+            }
+            else
+            {
+                const pointer new_first = sfl::dtl::move_backward(data_.first_, p1, p2);
+
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), data_.first_, new_first);
+
+                data_.first_ = new_first;
+            }
 
             return iterator(p2);
         }
@@ -993,11 +1038,20 @@ public:
             const pointer p1 = data_.first_ + std::distance(cbegin(), first);
             const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
-            const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
+            if (sfl::is_trivially_relocatable<value_type>::value)
+            {
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), p1, p2);
+
+                data_.last_ = sfl::dtl::trivially_relocate(p2, data_.last_, p1);
+            }
+            else
+            {
+                const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
 
-            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
 
-            data_.last_ = new_last;
+                data_.last_ = new_last;
+            }
 
             return iterator(p1);
         }
@@ -1512,6 +1566,27 @@ private:
         }
     }
 
+    //
+    // Returns true if there is enough free space to insert `n` elements by
+    // recentering existing elements. See SFL_DEVECTOR_RECENTER_THRESHOLD.
+    //
+    bool should_recenter(size_type n) const noexcept
+    {
+        const size_type size      = this->size();
+        const size_type available = available_front() + available_back();
+
+        if (available < n)
+        {
+            return false;
+        }
+
+        const size_type threshold =
+            size / 100 * SFL_DEVECTOR_RECENTER_THRESHOLD +
+            size % 100 * SFL_DEVECTOR_RECENTER_THRESHOLD / 100;
+
+        return available - n >= threshold;
+    }
+
     void reset(size_type new_cap = 0)
     {
         sfl::dtl::destroy_a
@@ -1564,7 +1639,7 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1584,7 +1659,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -1623,7 +1698,7 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1643,7 +1718,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -2229,14 +2304,17 @@ private:
 
             emplace_proxy<value_type&&> proxy(std::move(tmp));
 
-            const size_type additional_capacity = calculate_additional_capacity_for_grow_storage_front(1);
-
-            if (available_back() > additional_capacity)
+            if (should_recenter(1))
             {
-                return insert_aux_shift_to_back(additional_capacity, cbegin(), 1, proxy);
+                // Split free space evenly between front and back.
+                const size_type available = available_back() - 1;
+
+                return insert_aux_shift_to_back(available_back() - available / 2, cbegin(), 1, proxy);
             }
             else
             {
+                const size_type additional_capacity = calculate_additional_capacity_for_grow_storage_front(1);
+
                 return insert_aux_grow_storage_front(additional_capacity, cbegin(), 1, proxy);
             }
         }
@@ -2266,14 +2344,17 @@ private:
 
             emplace_proxy<value_type&&> proxy(std::move(tmp));
 
-            const size_type additional_capacity = calculate_additional_capacity_for_grow_storage_back(1);
-
-            if (available_front() > additional_capacity)
+            if (should_recenter(1))
             {
-                return insert_aux_shift_to_front(additional_capacity, cend(), 1, proxy);
+                // Split free space evenly between front and back.
+                const size_type available = available_front() - 1;
+
+                return insert_aux_shift_to_front(available_front() - available / 2, cend(), 1, proxy);
             }
             else
             {
+                const size_type additional_capacity = calculate_additional_capacity_for_grow_storage_back(1);
+
                 return insert_aux_grow_storage_back(additional_capacity, cend(), 1, proxy);
             }
         }
@@ -4051,22 +4132,29 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_a
+            // Elements are relocated after all new elements are
+            // constructed. Relocation cannot be undone.
+
+            proxy.uninitialized_insert_n
             (
                 data_.ref_to_alloc(),
-                data_.first_,
-                data_.first_ + offset,
-                new_first
+                p,
+                insert_size
             );
 
-            new_last = proxy.uninitialized_insert_n
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
-                new_last,
-                insert_size
+                data_.first_,
+                data_.first_ + offset,
+                new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_a
+            new_last += insert_size;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_ + offset,
@@ -4076,12 +4164,24 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_n_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    insert_size
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -4093,7 +4193,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -4146,22 +4246,29 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_a
+            // Elements are relocated after all new elements are
+            // constructed. Relocation cannot be undone.
+
+            proxy.uninitialized_insert_n
             (
                 data_.ref_to_alloc(),
-                data_.first_,
-                data_.first_ + offset,
-                new_first
+                p,
+                insert_size
             );
 
-            new_last = proxy.uninitialized_insert_n
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
-                new_last,
-                insert_size
+                data_.first_,
+                data_.first_ + offset,
+                new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_a
+            new_last += insert_size;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_ + offset,
@@ -4171,12 +4278,24 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_n_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    insert_size
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -4188,7 +4307,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
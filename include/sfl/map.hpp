@@ -26,6 +26,7 @@
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/exceptions.hpp>
 #include <sfl/detail/functional.hpp>
+#include <sfl/detail/node_small_allocator.hpp>
 #include <sfl/detail/rb_tree.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/type_traits.hpp>
@@ -40,6 +41,9 @@
 namespace sfl
 {
 
+template <typename Key, typename T, typename Compare, typename Allocator>
+class multimap;
+
 template < typename Key,
            typename T,
            typename Compare = std::less<Key>,
@@ -52,6 +56,12 @@ class map
         "Allocator::value_type must be std::pair<const Key, T>."
     );
 
+    template <typename, typename, typename, typename>
+    friend class map;
+
+    template <typename, typename, typename, typename>
+    friend class multimap;
+
 public:
 
     using allocator_type = Allocator;
@@ -103,6 +113,8 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::reverse_iterator;
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = typename tree_type::node_handle;
+    using insert_return_type     = sfl::dtl::rb_tree_insert_return_type<iterator, node_type>;
 
 public:
 
@@ -488,6 +500,16 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    insert_return_type insert(node_type&& nh)
+    {
+        return tree_.insert_node_unique(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_hint_unique(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -636,6 +658,72 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.extract(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.extract(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.extract(x);
+    }
+
+    template <typename Compare2>
+    void merge(map<Key, T, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(map<Key, T, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multimap<Key, T, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multimap<Key, T, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    void join(map&& other)
+    {
+        tree_.join_unique(other.tree_);
+    }
+
+    map split(const Key& key)
+    {
+        map result(key_comp(), get_allocator());
+        tree_.split(result.tree_, key);
+        return result;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    map split(const K& x)
+    {
+        map result(key_comp(), get_allocator());
+        tree_.split(result.tree_, x);
+        return result;
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -780,6 +868,30 @@ public:
         return tree_.contains(x);
     }
 
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return tree_.lower_bound_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return tree_.lower_bound_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return tree_.find_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return tree_.find_batch(first, last, out);
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
@@ -865,11 +977,7 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_unique(first, last);
     }
 
     template <typename K, typename M>
@@ -885,7 +993,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<M>(obj))
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return std::make_pair(iterator(x), true);
         }
@@ -910,7 +1018,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<M>(obj))
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return iterator(x);
         }
@@ -935,7 +1043,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return std::make_pair(iterator(x), true);
         }
@@ -958,7 +1066,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return iterator(x);
         }
@@ -25,6 +25,7 @@
 #include <sfl/detail/container_compatible_range.hpp>
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/functional.hpp>
+#include <sfl/detail/node_small_allocator.hpp>
 #include <sfl/detail/rb_tree.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/type_traits.hpp>
@@ -39,6 +40,9 @@
 namespace sfl
 {
 
+template <typename Key, typename T, typename Compare, typename Allocator>
+class map;
+
 template < typename Key,
            typename T,
            typename Compare = std::less<Key>,
@@ -51,6 +55,12 @@ class multimap
         "Allocator::value_type must be std::pair<const Key, T>."
     );
 
+    template <typename, typename, typename, typename>
+    friend class multimap;
+
+    template <typename, typename, typename, typename>
+    friend class map;
+
 public:
 
     using allocator_type = Allocator;
@@ -102,6 +112,7 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::reverse_iterator;
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = typename tree_type::node_handle;
 
 public:
 
@@ -487,6 +498,16 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    iterator insert(node_type&& nh)
+    {
+        return tree_.insert_node_equal(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_hint_equal(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -539,6 +560,72 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.extract(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.extract(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.extract(x);
+    }
+
+    template <typename Compare2>
+    void merge(multimap<Key, T, Compare2, Allocator>& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multimap<Key, T, Compare2, Allocator>&& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(map<Key, T, Compare2, Allocator>& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(map<Key, T, Compare2, Allocator>&& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    void join(multimap&& other)
+    {
+        tree_.join_equal(other.tree_);
+    }
+
+    multimap split(const Key& key)
+    {
+        multimap result(key_comp(), get_allocator());
+        tree_.split(result.tree_, key);
+        return result;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    multimap split(const K& x)
+    {
+        multimap result(key_comp(), get_allocator());
+        tree_.split(result.tree_, x);
+        return result;
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -683,16 +770,36 @@ public:
         return tree_.contains(x);
     }
 
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return tree_.lower_bound_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return tree_.lower_bound_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return tree_.find_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return tree_.find_batch(first, last, out);
+    }
+
 private:
 
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_equal(first, last);
     }
 };
 
@@ -26,10 +26,12 @@
 #include <sfl/detail/exceptions.hpp>
 #include <sfl/detail/initialized_memory_algorithms.hpp>
 #include <sfl/detail/normal_iterator.hpp>
+#include <sfl/detail/sorted_range_algorithms.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/to_address.hpp>
 #include <sfl/detail/type_traits.hpp>
 #include <sfl/detail/uninitialized_memory_algorithms.hpp>
+#include <sfl/small_vector.hpp>
 
 #include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
 #include <cstddef>          // size_t
@@ -79,6 +81,7 @@ public:
     using const_iterator         = sfl::dtl::normal_iterator<const_pointer, small_flat_map>;
     using reverse_iterator       = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using container_type         = sfl::small_vector<value_type, N, Allocator>;
 
     class value_compare : protected key_compare
     {
@@ -372,6 +375,58 @@ public:
         : small_flat_map(ilist.begin(), ilist.end(), comp, alloc)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp,
+                   const Allocator& alloc)
+        : data_(comp, alloc)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                   const Compare& comp)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                   const Allocator& alloc)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                   const Compare& comp, const Allocator& alloc)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
     small_flat_map(const small_flat_map& other)
         : data_
         (
@@ -963,6 +1018,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_range_aux(sfl::sorted_unique_t(), first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_aux(sfl::sorted_unique_t(), ilist.begin(), ilist.end());
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -971,6 +1038,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        insert_range_aux(sfl::sorted_unique_t(), std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -981,6 +1054,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_aux(sfl::sorted_unique_t(), begin(range), end(range));
+    }
+
 #endif // before C++20
 
     template <typename M,
@@ -1310,6 +1391,85 @@ public:
         }
     }
 
+    //
+    // Moves out the underlying storage. Container is empty after the call.
+    // Dynamically allocated storage is transferred without moving elements.
+    //
+    container_type extract() &&
+    {
+        container_type c(data_.ref_to_alloc());
+
+        auto& c_data = sfl::dtl::small_vector_storage_access::storage(c);
+
+        if (data_.first_ == data_.internal_storage())
+        {
+            c_data.last_ = sfl::dtl::uninitialized_move_a
+            (
+                c_data.ref_to_alloc(),
+                data_.first_,
+                data_.last_,
+                c_data.first_
+            );
+
+            clear();
+        }
+        else
+        {
+            c_data.first_ = data_.first_;
+            c_data.last_  = data_.last_;
+            c_data.eos_   = data_.eos_;
+
+            data_.first_ = data_.internal_storage();
+            data_.last_  = data_.first_;
+            data_.eos_   = data_.first_ + N;
+        }
+
+        return c;
+    }
+
+    //
+    // Replaces the underlying storage with `other`. Elements of `other` must be
+    // sorted and must not contain equivalent elements. Dynamically allocated storage is transferred
+    // without moving elements if allocators compare equal.
+    //
+    void replace(container_type&& other)
+    {
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(other.begin(), other.end(), data_.ref_to_comp()));
+
+        auto& other_data = sfl::dtl::small_vector_storage_access::storage(other);
+
+        if
+        (
+            other_data.first_ == other_data.internal_storage() ||
+            data_.ref_to_alloc() != other_data.ref_to_alloc()
+        )
+        {
+            reset(other.size());
+
+            data_.last_ = sfl::dtl::uninitialized_move_a
+            (
+                data_.ref_to_alloc(),
+                other_data.first_,
+                other_data.last_,
+                data_.first_
+            );
+
+            other.clear();
+        }
+        else
+        {
+            reset();
+
+            data_.first_ = other_data.first_;
+            data_.last_  = other_data.last_;
+            data_.eos_   = other_data.eos_;
+
+            other_data.first_ = other_data.internal_storage();
+            other_data.last_  = other_data.first_;
+            other_data.eos_   = other_data.first_ + N;
+        }
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -1647,11 +1807,37 @@ private:
     {
         SFL_TRY
         {
-            while (first != last)
+            insert_range_aux(std::move(first), std::move(last));
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.last_
+            );
+
+            if (data_.first_ != data_.internal_storage())
             {
-                insert(*first);
-                ++first;
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first_,
+                    std::distance(data_.first_, data_.eos_)
+                );
             }
+
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void initialize_range(sfl::sorted_unique_t, InputIt first, Sentinel last)
+    {
+        SFL_TRY
+        {
+            insert_range_aux(sfl::sorted_unique_t(), std::move(first), std::move(last));
         }
         SFL_CATCH (...)
         {
@@ -1942,10 +2128,202 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
+        // New elements are appended at the end and then sorted and merged with
+        // old elements. That is much faster than inserting elements one by one.
+
+        const size_type old_size = size();
+
+        append_range(std::move(first), std::move(last));
+
+        sort_and_merge_tail(old_size);
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(sfl::sorted_unique_t, InputIt first, Sentinel last)
+    {
+        const size_type old_size = size();
+
+        append_range(std::move(first), std::move(last));
+
+        SFL_ASSERT
+        (
+            sfl::dtl::is_sorted_unique
+            (
+                data_.first_ + old_size,
+                data_.last_,
+                data_.ref_to_comp()
+            )
+        );
+
+        merge_sorted_tail(old_size);
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void append_range(InputIt first, Sentinel last)
+    {
+        using tag = typename std::conditional
+        <
+            sfl::dtl::is_forward_iterator<InputIt>::value &&
+            std::is_same<InputIt, Sentinel>::value,
+            std::forward_iterator_tag,
+            std::input_iterator_tag
+        >::type;
+
+        append_range(std::move(first), std::move(last), tag());
+    }
+
+    //
+    // Appends elements from range [first, last) at the end. If exception is
+    // thrown, appended elements are destroyed.
+    //
+    template <typename InputIt, typename Sentinel>
+    void append_range(InputIt first, Sentinel last, std::input_iterator_tag)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                insert_exactly_at(cend(), *first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            const pointer mid = data_.first_ + old_size;
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                mid,
+                data_.last_
+            );
+
+            data_.last_ = mid;
+
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename ForwardIt>
+    void append_range(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+    {
+        const size_type n = std::distance(first, last);
+
+        if (n > available())
         {
-            insert(*first);
-            ++first;
+            reserve(calculate_new_capacity(n, "sfl::small_flat_map::insert"));
+        }
+
+        data_.last_ = sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            first,
+            last,
+            data_.last_
+        );
+    }
+
+    //
+    // Sorts elements in range [first_ + old_size, last_) and merges them with
+    // elements in range [first_, first_ + old_size). Duplicates are removed.
+    //
+    void sort_and_merge_tail(size_type old_size)
+    {
+        SFL_TRY
+        {
+            const pointer new_last = sfl::dtl::sort_unique_tail
+            (
+                data_.first_ + old_size,
+                data_.last_,
+                data_.ref_to_comp()
+            );
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                new_last,
+                data_.last_
+            );
+
+            data_.last_ = new_last;
+        }
+        SFL_CATCH (...)
+        {
+            const pointer mid = data_.first_ + old_size;
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                mid,
+                data_.last_
+            );
+
+            data_.last_ = mid;
+
+            SFL_RETHROW;
+        }
+
+        merge_sorted_tail(old_size);
+    }
+
+    //
+    // Merges sorted elements in range [first_ + old_size, last_) with elements
+    // in range [first_, first_ + old_size). Duplicates are removed.
+    //
+    void merge_sorted_tail(size_type old_size)
+    {
+        SFL_TRY
+        {
+            const pointer new_last = sfl::dtl::remove_equivalent_tail
+            (
+                data_.first_,
+                data_.first_ + old_size,
+                data_.last_,
+                data_.ref_to_comp()
+            );
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                new_last,
+                data_.last_
+            );
+
+            data_.last_ = new_last;
+        }
+        SFL_CATCH (...)
+        {
+            const pointer mid = data_.first_ + old_size;
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                mid,
+                data_.last_
+            );
+
+            data_.last_ = mid;
+
+            SFL_RETHROW;
+        }
+
+        SFL_TRY
+        {
+            sfl::dtl::merge_tail
+            (
+                data_.first_,
+                data_.first_ + old_size,
+                data_.last_,
+                data_.ref_to_comp()
+            );
+        }
+        SFL_CATCH (...)
+        {
+            // Order of elements is unspecified now.
+            clear();
+            SFL_RETHROW;
         }
     }
 
@@ -2297,21 +2675,12 @@ template <typename K, typename T, std::size_t N, typename C, typename A,
 typename small_flat_map<K, T, N, C, A>::size_type
     erase_if(small_flat_map<K, T, N, C, A>& c, Predicate pred)
 {
-    auto old_size = c.size();
-
-    for (auto it = c.begin(); it != c.end(); )
-    {
-        if (pred(*it))
-        {
-            it = c.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
-    }
-
-    return old_size - c.size();
+    auto first = c.data();
+    auto last = first + c.size();
+    auto it = std::remove_if(first, last, pred);
+    auto r = std::distance(it, last);
+    c.erase(c.begin() + std::distance(first, it), c.end());
+    return r;
 }
 
 } // namespace sfl
@@ -41,6 +41,9 @@
 namespace sfl
 {
 
+template <typename Key, typename T, std::size_t N, typename Compare, typename Allocator>
+class small_multimap;
+
 template < typename Key,
            typename T,
            std::size_t N,
@@ -54,6 +57,12 @@ class small_map
         "Allocator::value_type must be std::pair<const Key, T>."
     );
 
+    template <typename, typename, std::size_t, typename, typename>
+    friend class small_map;
+
+    template <typename, typename, std::size_t, typename, typename>
+    friend class small_multimap;
+
 public:
 
     using allocator_type = Allocator;
@@ -110,6 +119,8 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::reverse_iterator;
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = typename tree_type::node_handle;
+    using insert_return_type     = sfl::dtl::rb_tree_insert_return_type<iterator, node_type>;
 
 public:
 
@@ -499,6 +510,16 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    insert_return_type insert(node_type&& nh)
+    {
+        return tree_.insert_node_unique(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_hint_unique(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -647,6 +668,51 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.extract(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.extract(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.extract(x);
+    }
+
+    template <typename Compare2>
+    void merge(small_map<Key, T, N, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_map<Key, T, N, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_multimap<Key, T, N, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_multimap<Key, T, N, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -876,11 +942,7 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_unique(first, last);
     }
 
     template <typename K, typename M>
@@ -896,7 +958,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<M>(obj))
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return std::make_pair(iterator(x), true);
         }
@@ -921,7 +983,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<M>(obj))
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return iterator(x);
         }
@@ -946,7 +1008,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return std::make_pair(iterator(x), true);
         }
@@ -969,7 +1031,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return iterator(x);
         }
@@ -40,6 +40,9 @@
 namespace sfl
 {
 
+template <typename Key, typename T, std::size_t N, typename Compare, typename Allocator>
+class small_map;
+
 template < typename Key,
            typename T,
            std::size_t N,
@@ -53,6 +56,12 @@ class small_multimap
         "Allocator::value_type must be std::pair<const Key, T>."
     );
 
+    template <typename, typename, std::size_t, typename, typename>
+    friend class small_multimap;
+
+    template <typename, typename, std::size_t, typename, typename>
+    friend class small_map;
+
 public:
 
     using allocator_type = Allocator;
@@ -109,6 +118,7 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::reverse_iterator;
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = typename tree_type::node_handle;
 
 public:
 
@@ -498,6 +508,16 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    iterator insert(node_type&& nh)
+    {
+        return tree_.insert_node_equal(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_hint_equal(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -550,6 +570,51 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.extract(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.extract(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.extract(x);
+    }
+
+    template <typename Compare2>
+    void merge(small_multimap<Key, T, N, Compare2, Allocator>& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_multimap<Key, T, N, Compare2, Allocator>&& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_map<Key, T, N, Compare2, Allocator>& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_map<Key, T, N, Compare2, Allocator>&& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -699,11 +764,7 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_equal(first, last);
     }
 };
 
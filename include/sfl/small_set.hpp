@@ -40,6 +40,9 @@
 namespace sfl
 {
 
+template <typename Key, std::size_t N, typename Compare, typename Allocator>
+class small_multiset;
+
 template < typename Key,
            std::size_t N,
            typename Compare = std::less<Key>,
@@ -52,6 +55,12 @@ class small_set
         "Allocator::value_type must be Key."
     );
 
+    template <typename, std::size_t, typename, typename>
+    friend class small_set;
+
+    template <typename, std::size_t, typename, typename>
+    friend class small_multiset;
+
 public:
 
     using allocator_type = Allocator;
@@ -91,6 +100,8 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::const_reverse_iterator; // MUST BE const
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = typename tree_type::node_handle;
+    using insert_return_type     = sfl::dtl::rb_tree_insert_return_type<iterator, node_type>;
 
 public:
 
@@ -466,6 +477,17 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    insert_return_type insert(node_type&& nh)
+    {
+        auto res = tree_.insert_node_unique(std::move(nh));
+        return insert_return_type{res.position, res.inserted, std::move(res.node)};
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_hint_unique(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -513,6 +535,51 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.extract(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.extract(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.extract(x);
+    }
+
+    template <typename Compare2>
+    void merge(small_set<Key, N, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_set<Key, N, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_multiset<Key, N, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(small_multiset<Key, N, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -662,11 +729,7 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_unique(first, last);
     }
 };
 
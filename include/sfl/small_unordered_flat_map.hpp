@@ -24,13 +24,16 @@
 #include <sfl/detail/container_compatible_range.hpp>
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/hash_slot_index.hpp>
 #include <sfl/detail/ignore_unused.hpp>
 #include <sfl/detail/initialized_memory_algorithms.hpp>
+#include <sfl/detail/lookup_policy.hpp>
 #include <sfl/detail/normal_iterator.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/to_address.hpp>
 #include <sfl/detail/type_traits.hpp>
 #include <sfl/detail/uninitialized_memory_algorithms.hpp>
+#include <sfl/detail/unordered_range_algorithms.hpp>
 
 #include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
 #include <cstddef>          // size_t
@@ -54,7 +57,9 @@ template < typename Key,
            typename T,
            std::size_t N,
            typename KeyEqual = std::equal_to<Key>,
-           typename Allocator = std::allocator<std::pair<Key, T>> >
+           typename Allocator = std::allocator<std::pair<Key, T>>,
+           typename Hash = void,
+           typename LookupPolicy = sfl::lookup_keep_order >
 class small_unordered_flat_map
 {
     #ifdef SFL_TEST_SMALL_UNORDERED_FLAT_MAP
@@ -72,6 +77,8 @@ public:
     using size_type        = typename allocator_traits::size_type;
     using difference_type  = typename allocator_traits::difference_type;
     using key_equal        = KeyEqual;
+    using hasher           = Hash;
+    using lookup_policy    = LookupPolicy;
     using reference        = value_type&;
     using const_reference  = const value_type&;
     using pointer          = typename allocator_traits::pointer;
@@ -143,6 +150,39 @@ private:
         }
     };
 
+    // Returns key of element at given position. Used by hash index.
+    // For internal use only.
+    class key_getter
+    {
+    private:
+
+        pointer first_;
+
+    public:
+
+        explicit key_getter(pointer first) noexcept
+            : first_(first)
+        {}
+
+        const Key& operator()(size_type i) const noexcept
+        {
+            return (*(first_ + i)).first;
+        }
+    };
+
+    // Hash index can be used to find key of type `K` only if `Hash` can
+    // hash `K` consistently with `Key`.
+    template <typename K>
+    using is_index_usable = std::integral_constant
+    <
+        bool,
+        !std::is_void<Hash>::value &&
+        (
+            std::is_same<K, Key>::value ||
+            sfl::dtl::has_is_transparent<Hash, K>::value
+        )
+    >;
+
     template <bool WithInternalStorage = true, typename = void>
     class data_base
     {
@@ -200,7 +240,9 @@ private:
         }
     };
 
-    class data : public data_base<(N > 0)>, public allocator_type, public ultra_equal
+    using index_type = sfl::dtl::hash_slot_index<Hash, allocator_type>;
+
+    class data : public data_base<(N > 0)>, public allocator_type, public ultra_equal, public index_type
     {
     public:
 
@@ -277,10 +319,23 @@ private:
         {
             return *this;
         }
+
+        index_type& ref_to_index() noexcept
+        {
+            return *this;
+        }
+
+        const index_type& ref_to_index() const noexcept
+        {
+            return *this;
+        }
     };
 
     data data_;
 
+    // Ranges shorter than this are inserted one element at a time.
+    static constexpr size_type bulk_insert_threshold = 16;
+
 public:
 
     //
@@ -485,6 +540,8 @@ public:
 
     ~small_unordered_flat_map()
     {
+        data_.ref_to_index().release(data_.ref_to_alloc());
+
         sfl::dtl::destroy_a
         (
             data_.ref_to_alloc(),
@@ -869,6 +926,8 @@ public:
         );
 
         data_.last_ = data_.first_;
+
+        data_.ref_to_index().clear();
     }
 
     template <typename... Args>
@@ -1068,6 +1127,14 @@ public:
 
         const pointer p = data_.first_ + offset;
 
+        data_.ref_to_index().erase_slot
+        (
+            data_.ref_to_alloc(),
+            offset,
+            size() - 1,
+            key_at()
+        );
+
         if (p < data_.last_ - 1)
         {
             *p = std::move(*(data_.last_ - 1));
@@ -1119,12 +1186,14 @@ public:
             data_.last_ = new_last;
         }
 
+        data_.ref_to_index().refill(data_.ref_to_alloc(), size(), key_at());
+
         return iterator(p1);
     }
 
     size_type erase(const Key& key)
     {
-        auto it = find(key);
+        auto it = iterator(find_aux(key));
 
         if (it == cend())
         {
@@ -1139,7 +1208,7 @@ public:
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
     size_type erase(K&& x)
     {
-        auto it = find(x);
+        auto it = iterator(find_aux(x));
 
         if (it == cend())
         {
@@ -1177,6 +1246,9 @@ public:
 
         swap(this->data_.ref_to_equal(), other.data_.ref_to_equal());
 
+        // Elements keep their positions, so tables can simply be exchanged.
+        this->data_.ref_to_index().swap(other.data_.ref_to_index());
+
         if
         (
             this->data_.first_ == this->data_.internal_storage() &&
@@ -1319,29 +1391,13 @@ public:
     SFL_NODISCARD
     iterator find(const Key& key)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return find_on_access(key);
     }
 
     SFL_NODISCARD
     const_iterator find(const Key& key) const
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return const_iterator(find_aux(key));
     }
 
     template <typename K,
@@ -1349,15 +1405,7 @@ public:
     SFL_NODISCARD
     iterator find(const K& x)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, x))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return find_on_access(x);
     }
 
     template <typename K,
@@ -1365,15 +1413,7 @@ public:
     SFL_NODISCARD
     const_iterator find(const K& x) const
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, x))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return const_iterator(find_aux(x));
     }
 
     SFL_NODISCARD
@@ -1532,6 +1572,9 @@ private:
 
     void reset(size_type new_cap = N)
     {
+        data_.ref_to_index().release(data_.ref_to_alloc());
+        data_.ref_to_index().clear();
+
         sfl::dtl::destroy_a
         (
             data_.ref_to_alloc(),
@@ -1633,6 +1676,8 @@ private:
 
         SFL_TRY
         {
+            data_.ref_to_index().assign(data_.ref_to_alloc(), other.data_.ref_to_index());
+
             data_.last_ = sfl::dtl::uninitialized_copy_a
             (
                 data_.ref_to_alloc(),
@@ -1643,6 +1688,8 @@ private:
         }
         SFL_CATCH (...)
         {
+            data_.ref_to_index().release(data_.ref_to_alloc());
+
             if (n > N)
             {
                 sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
@@ -1656,16 +1703,28 @@ private:
     {
         if (other.data_.first_ == other.data_.internal_storage())
         {
-            data_.last_ = sfl::dtl::uninitialized_move_a
-            (
-                data_.ref_to_alloc(),
-                other.data_.first_,
-                other.data_.last_,
-                data_.first_
-            );
+            SFL_TRY
+            {
+                transfer_index(other);
+
+                data_.last_ = sfl::dtl::uninitialized_move_a
+                (
+                    data_.ref_to_alloc(),
+                    other.data_.first_,
+                    other.data_.last_,
+                    data_.first_
+                );
+            }
+            SFL_CATCH (...)
+            {
+                data_.ref_to_index().release(data_.ref_to_alloc());
+                SFL_RETHROW;
+            }
         }
         else if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
         {
+            data_.ref_to_index().steal(data_.ref_to_alloc(), other.data_.ref_to_index());
+
             data_.first_ = other.data_.first_;
             data_.last_  = other.data_.last_;
             data_.eos_   = other.data_.eos_;
@@ -1689,6 +1748,8 @@ private:
 
             SFL_TRY
             {
+                data_.ref_to_index().assign(data_.ref_to_alloc(), other.data_.ref_to_index());
+
                 data_.last_ = sfl::dtl::uninitialized_move_a
                 (
                     data_.ref_to_alloc(),
@@ -1699,6 +1760,8 @@ private:
             }
             SFL_CATCH (...)
             {
+                data_.ref_to_index().release(data_.ref_to_alloc());
+
                 if (n > N)
                 {
                     sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
@@ -1788,7 +1851,17 @@ private:
 
             data_.ref_to_equal() = other.data_.ref_to_equal();
 
-            assign_range(other.data_.first_, other.data_.last_);
+            SFL_TRY
+            {
+                assign_range(other.data_.first_, other.data_.last_);
+            }
+            SFL_CATCH (...)
+            {
+                data_.ref_to_index().release(data_.ref_to_alloc());
+                SFL_RETHROW;
+            }
+
+            data_.ref_to_index().assign(data_.ref_to_alloc(), other.data_.ref_to_index());
         }
     }
 
@@ -1806,18 +1879,16 @@ private:
 
         data_.ref_to_equal() = other.data_.ref_to_equal();
 
-        if (other.data_.first_ == other.data_.internal_storage())
-        {
-            assign_range
-            (
-                std::make_move_iterator(other.data_.first_),
-                std::make_move_iterator(other.data_.last_)
-            );
-        }
-        else if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        if
+        (
+            other.data_.first_ != other.data_.internal_storage() &&
+            data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        )
         {
             reset();
 
+            data_.ref_to_index().steal(data_.ref_to_alloc(), other.data_.ref_to_index());
+
             data_.first_ = other.data_.first_;
             data_.last_  = other.data_.last_;
             data_.eos_   = other.data_.eos_;
@@ -1828,28 +1899,151 @@ private:
         }
         else
         {
-            assign_range
-            (
-                std::make_move_iterator(other.data_.first_),
-                std::make_move_iterator(other.data_.last_)
-            );
+            SFL_TRY
+            {
+                assign_range
+                (
+                    std::make_move_iterator(other.data_.first_),
+                    std::make_move_iterator(other.data_.last_)
+                );
+            }
+            SFL_CATCH (...)
+            {
+                data_.ref_to_index().release(data_.ref_to_alloc());
+                SFL_RETHROW;
+            }
+
+            transfer_index(other);
+        }
+    }
+
+    // Elements of `other` have been copied or moved into this container in
+    // the same order, so the table of `other` is valid for this container.
+    void transfer_index(small_unordered_flat_map& other)
+    {
+        if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            data_.ref_to_index().steal(data_.ref_to_alloc(), other.data_.ref_to_index());
+        }
+        else
+        {
+            data_.ref_to_index().assign(data_.ref_to_alloc(), other.data_.ref_to_index());
+        }
+    }
+
+    key_getter key_at() const noexcept
+    {
+        return key_getter(data_.first_);
+    }
+
+    template <typename K>
+    pointer find_aux(const K& x) const
+    {
+        return find_aux(x, is_index_usable<K>());
+    }
+
+    template <typename K>
+    pointer find_aux(const K& x, std::true_type) const
+    {
+        if (data_.ref_to_index().usable())
+        {
+            return find_hashed(x, data_.ref_to_index().hash_of(x), size());
         }
+
+        return find_aux(x, std::false_type());
+    }
+
+    template <typename K>
+    pointer find_aux(const K& x, std::false_type) const
+    {
+        for (pointer p = data_.first_; p != data_.last_; ++p)
+        {
+            if (data_.ref_to_equal()(*p, x))
+            {
+                return p;
+            }
+        }
+
+        return data_.last_;
+    }
+
+    // Non-const lookup. Elements are not reordered while hash index
+    // refers to their positions.
+    template <typename K>
+    iterator find_on_access(const K& x)
+    {
+        const auto it = iterator(find_aux(x));
+
+        if (it == end() || data_.ref_to_index().usable())
+        {
+            return it;
+        }
+
+        return LookupPolicy::on_hit(begin(), it);
+    }
+
+    // Searches first `n` elements using hash index.
+    template <typename K>
+    pointer find_hashed(const K& x, size_type hash, size_type n) const
+    {
+        const pointer first = data_.first_;
+        const ultra_equal& equal = data_.ref_to_equal();
+
+        return first + data_.ref_to_index().find
+        (
+            hash,
+            n,
+            [&](size_type i) { return equal(*(first + i), x); }
+        );
     }
 
     template <typename... Args>
     std::pair<iterator, bool> emplace_aux(Args&&... args)
     {
+        data_.ref_to_index().reserve(data_.ref_to_alloc(), size() + 1, size(), key_at());
+
         const auto it1 = emplace_back(std::forward<Args>(args)...);
-        const auto it2 = find(it1->first);
 
-        const bool is_unique = it1 == it2;
+        if (!data_.ref_to_index().usable())
+        {
+            const auto it2 = iterator(find_aux(it1->first, std::false_type()));
+
+            const bool is_unique = it1 == it2;
+
+            if (!is_unique)
+            {
+                pop_back();
+            }
+
+            return std::make_pair(it2, is_unique);
+        }
+
+        // New element is not indexed yet. It is unique if it is not found
+        // among the other elements.
 
-        if (!is_unique)
+        size_type hash = 0;
+        pointer p = nullptr;
+
+        SFL_TRY
+        {
+            hash = data_.ref_to_index().hash_of(it1->first);
+            p = find_hashed(it1->first, hash, size() - 1);
+        }
+        SFL_CATCH (...)
         {
             pop_back();
+            SFL_RETHROW;
         }
 
-        return std::make_pair(it2, is_unique);
+        if (p != data_.last_ - 1)
+        {
+            pop_back();
+            return std::make_pair(iterator(p), false);
+        }
+
+        data_.ref_to_index().insert_slot(hash, size() - 1);
+
+        return std::make_pair(it1, true);
     }
 
     template <typename... Args>
@@ -1866,7 +2060,7 @@ private:
 
         if (it == end())
         {
-            return std::make_pair(emplace_back(std::forward<Value>(value)), true);
+            return std::make_pair(emplace_back_indexed(std::forward<Value>(value)), true);
         }
 
         return std::make_pair(it, false);
@@ -1881,6 +2075,103 @@ private:
 
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
+    {
+        using tag = typename std::conditional
+        <
+            sfl::dtl::is_forward_iterator<InputIt>::value &&
+            std::is_same<InputIt, Sentinel>::value,
+            std::forward_iterator_tag,
+            std::input_iterator_tag
+        >::type;
+
+        insert_range_aux(std::move(first), std::move(last), tag());
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(InputIt first, Sentinel last, std::input_iterator_tag)
+    {
+        while (first != last)
+        {
+            insert(*first);
+            ++first;
+        }
+    }
+
+    template <typename ForwardIt>
+    void insert_range_aux(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+    {
+        // Storage and index are reserved once for the whole range.
+
+        const size_type n = std::distance(first, last);
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::small_unordered_flat_map::insert"));
+        }
+
+        data_.ref_to_index().reserve(data_.ref_to_alloc(), size() + n, size(), key_at());
+
+        if (data_.ref_to_index().usable() || n < bulk_insert_threshold)
+        {
+            // Each insertion is constant time if index is usable.
+            while (first != last)
+            {
+                insert(*first);
+                ++first;
+            }
+        }
+        else
+        {
+            append_unique_range(first, last, sfl::dtl::is_batch_sortable<Key, KeyEqual>());
+        }
+    }
+
+    //
+    // Appends elements from range [first, last) at the end and then removes
+    // elements whose keys are duplicates. Keys are deduplicated by sorting
+    // temporary arrays, which is much faster than searching for each key.
+    // Capacity must be already reserved.
+    //
+    template <typename ForwardIt>
+    void append_unique_range(ForwardIt first, ForwardIt last, std::true_type)
+    {
+        const pointer mid = data_.last_;
+
+        data_.last_ = sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            first,
+            last,
+            data_.last_
+        );
+
+        SFL_TRY
+        {
+            const pointer new_last = sfl::dtl::remove_duplicate_keys_tail
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                mid,
+                data_.last_,
+                [](const value_type& x) -> const Key& { return x.first; }
+            );
+
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+
+            data_.last_ = new_last;
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), mid, data_.last_);
+
+            data_.last_ = mid;
+
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename ForwardIt>
+    void append_unique_range(ForwardIt first, ForwardIt last, std::false_type)
     {
         while (first != last)
         {
@@ -1898,7 +2189,7 @@ private:
         {
             return std::make_pair
             (
-                emplace_back
+                emplace_back_indexed
                 (
                     std::piecewise_construct,
                     std::forward_as_tuple(std::forward<K>(key)),
@@ -1928,7 +2219,7 @@ private:
         {
             return std::make_pair
             (
-                emplace_back
+                emplace_back_indexed
                 (
                     std::piecewise_construct,
                     std::forward_as_tuple(std::forward<K>(key)),
@@ -1948,6 +2239,34 @@ private:
         return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
     }
 
+    // Appends element which is known to be unique and adds it to the index.
+    template <typename... Args>
+    iterator emplace_back_indexed(Args&&... args)
+    {
+        data_.ref_to_index().reserve(data_.ref_to_alloc(), size() + 1, size(), key_at());
+
+        const auto it = emplace_back(std::forward<Args>(args)...);
+
+        if (data_.ref_to_index().usable())
+        {
+            SFL_TRY
+            {
+                data_.ref_to_index().insert_slot
+                (
+                    data_.ref_to_index().hash_of(it->first),
+                    size() - 1
+                );
+            }
+            SFL_CATCH (...)
+            {
+                pop_back();
+                SFL_RETHROW;
+            }
+        }
+
+        return it;
+    }
+
     template <typename... Args>
     iterator emplace_back(Args&&... args)
     {
@@ -2078,58 +2397,64 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, typename T, std::size_t N, typename E, typename A>
+template <typename K, typename T, std::size_t N, typename E, typename A, typename H, typename P>
 SFL_NODISCARD
 bool operator==
 (
-    const small_unordered_flat_map<K, T, N, E, A>& x,
-    const small_unordered_flat_map<K, T, N, E, A>& y
+    const small_unordered_flat_map<K, T, N, E, A, H, P>& x,
+    const small_unordered_flat_map<K, T, N, E, A, H, P>& y
 )
 {
     return x.size() == y.size() && std::is_permutation(x.begin(), x.end(), y.begin());
 }
 
-template <typename K, typename T, std::size_t N, typename E, typename A>
+template <typename K, typename T, std::size_t N, typename E, typename A, typename H, typename P>
 SFL_NODISCARD
 bool operator!=
 (
-    const small_unordered_flat_map<K, T, N, E, A>& x,
-    const small_unordered_flat_map<K, T, N, E, A>& y
+    const small_unordered_flat_map<K, T, N, E, A, H, P>& x,
+    const small_unordered_flat_map<K, T, N, E, A, H, P>& y
 )
 {
     return !(x == y);
 }
 
-template <typename K, typename T, std::size_t N, typename E, typename A>
+template <typename K, typename T, std::size_t N, typename E, typename A, typename H, typename P>
 void swap
 (
-    small_unordered_flat_map<K, T, N, E, A>& x,
-    small_unordered_flat_map<K, T, N, E, A>& y
+    small_unordered_flat_map<K, T, N, E, A, H, P>& x,
+    small_unordered_flat_map<K, T, N, E, A, H, P>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, typename T, std::size_t N, typename E, typename A,
+template <typename K, typename T, std::size_t N, typename E, typename A, typename H, typename P,
           typename Predicate>
-typename small_unordered_flat_map<K, T, N, E, A>::size_type
-    erase_if(small_unordered_flat_map<K, T, N, E, A>& c, Predicate pred)
+typename small_unordered_flat_map<K, T, N, E, A, H, P>::size_type
+    erase_if(small_unordered_flat_map<K, T, N, E, A, H, P>& c, Predicate pred)
 {
-    auto old_size = c.size();
-
-    for (auto it = c.begin(); it != c.end(); )
+    auto first = c.data();
+    auto last = first + c.size();
+    auto it = first;
+    while (it != last)
     {
         if (pred(*it))
         {
-            it = c.erase(it);
+            --last;
+            if (it != last)
+            {
+                *it = std::move(*last);
+            }
         }
         else
         {
             ++it;
         }
     }
-
-    return old_size - c.size();
+    auto r = std::distance(last, first + c.size());
+    c.erase(c.begin() + std::distance(first, last), c.end());
+    return r;
 }
 
 } // namespace sfl
@@ -1697,6 +1697,20 @@ private:
 
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
+    {
+        using tag = typename std::conditional
+        <
+            sfl::dtl::is_forward_iterator<InputIt>::value &&
+            std::is_same<InputIt, Sentinel>::value,
+            std::forward_iterator_tag,
+            std::input_iterator_tag
+        >::type;
+
+        insert_range_aux(std::move(first), std::move(last), tag());
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(InputIt first, Sentinel last, std::input_iterator_tag)
     {
         while (first != last)
         {
@@ -1705,6 +1719,27 @@ private:
         }
     }
 
+    template <typename ForwardIt>
+    void insert_range_aux(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+    {
+        // Keys are not unique, so elements are simply appended at the end.
+
+        const size_type n = std::distance(first, last);
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::small_unordered_flat_multimap::insert"));
+        }
+
+        data_.last_ = sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            first,
+            last,
+            data_.last_
+        );
+    }
+
     template <typename... Args>
     iterator emplace_back(Args&&... args)
     {
@@ -1863,21 +1898,27 @@ template <typename K, typename T, std::size_t N, typename E, typename A,
 typename small_unordered_flat_multimap<K, T, N, E, A>::size_type
     erase_if(small_unordered_flat_multimap<K, T, N, E, A>& c, Predicate pred)
 {
-    auto old_size = c.size();
-
-    for (auto it = c.begin(); it != c.end(); )
+    auto first = c.data();
+    auto last = first + c.size();
+    auto it = first;
+    while (it != last)
     {
         if (pred(*it))
         {
-            it = c.erase(it);
+            --last;
+            if (it != last)
+            {
+                *it = std::move(*last);
+            }
         }
         else
         {
             ++it;
         }
     }
-
-    return old_size - c.size();
+    auto r = std::distance(last, first + c.size());
+    c.erase(c.begin() + std::distance(first, last), c.end());
+    return r;
 }
 
 } // namespace sfl
@@ -27,6 +27,7 @@
 #include <sfl/detail/ignore_unused.hpp>
 #include <sfl/detail/initialized_memory_algorithms.hpp>
 #include <sfl/detail/normal_iterator.hpp>
+#include <sfl/detail/simd_find.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/to_address.hpp>
 #include <sfl/detail/type_traits.hpp>
@@ -227,6 +228,8 @@ private:
 
     data data_;
 
+    using simd_search = sfl::dtl::is_simd_searchable<Key, KeyEqual>;
+
 public:
 
     //
@@ -1148,29 +1151,13 @@ public:
     SFL_NODISCARD
     iterator find(const Key& key)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return begin() + find_index(key);
     }
 
     SFL_NODISCARD
     const_iterator find(const Key& key) const
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return begin() + find_index(key);
     }
 
     template <typename K,
@@ -1208,17 +1195,7 @@ public:
     SFL_NODISCARD
     size_type count(const Key& key) const
     {
-        size_type n = 0;
-
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                ++n;
-            }
-        }
-
-        return n;
+        return count_aux(key, simd_search());
     }
 
     template <typename K,
@@ -1271,6 +1248,64 @@ public:
 
 private:
 
+    size_type find_index(const Key& key) const
+    {
+        return find_index(key, simd_search());
+    }
+
+    size_type find_index(const Key& key, std::true_type) const
+    {
+        const value_type* const first = data();
+        return sfl::dtl::simd_find(first, first + size(), key) - first;
+    }
+
+    size_type find_index(const Key& key, std::false_type) const
+    {
+        for (auto it = begin(); it != end(); ++it)
+        {
+            if (data_.ref_to_equal()(*it, key))
+            {
+                return std::distance(begin(), it);
+            }
+        }
+
+        return size();
+    }
+
+    size_type count_aux(const Key& key, std::true_type) const
+    {
+        const value_type* const last = data() + size();
+
+        size_type n = 0;
+
+        for
+        (
+            const value_type* p = sfl::dtl::simd_find(data(), last, key);
+            p != last;
+            p = sfl::dtl::simd_find(p + 1, last, key)
+        )
+        {
+            ++n;
+        }
+
+        return n;
+    }
+
+    size_type count_aux(const Key& key, std::false_type) const
+    {
+        size_type n = 0;
+
+        for (auto it = begin(); it != end(); ++it)
+        {
+            if (data_.ref_to_equal()(*it, key))
+            {
+                ++n;
+            }
+        }
+
+        return n;
+    }
+
     void check_size(size_type n, const char* msg)
     {
         if (n > max_size())
@@ -1611,6 +1646,20 @@ private:
 
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
+    {
+        using tag = typename std::conditional
+        <
+            sfl::dtl::is_forward_iterator<InputIt>::value &&
+            std::is_same<InputIt, Sentinel>::value,
+            std::forward_iterator_tag,
+            std::input_iterator_tag
+        >::type;
+
+        insert_range_aux(std::move(first), std::move(last), tag());
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(InputIt first, Sentinel last, std::input_iterator_tag)
     {
         while (first != last)
         {
@@ -1619,6 +1668,27 @@ private:
         }
     }
 
+    template <typename ForwardIt>
+    void insert_range_aux(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+    {
+        // Keys are not unique, so elements are simply appended at the end.
+
+        const size_type n = std::distance(first, last);
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::small_unordered_flat_multiset::insert"));
+        }
+
+        data_.last_ = sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            first,
+            last,
+            data_.last_
+        );
+    }
+
     template <typename... Args>
     iterator emplace_back(Args&&... args)
     {
@@ -1777,21 +1847,27 @@ template <typename K, std::size_t N, typename E, typename A,
 typename small_unordered_flat_multiset<K, N, E, A>::size_type
     erase_if(small_unordered_flat_multiset<K, N, E, A>& c, Predicate pred)
 {
-    auto old_size = c.size();
-
-    for (auto it = c.begin(); it != c.end(); )
+    auto first = c.data();
+    auto last = first + c.size();
+    auto it = first;
+    while (it != last)
     {
         if (pred(*it))
         {
-            it = c.erase(it);
+            --last;
+            if (it != last)
+            {
+                *it = std::move(*last);
+            }
         }
         else
         {
             ++it;
         }
     }
-
-    return old_size - c.size();
+    auto r = std::distance(last, first + c.size());
+    c.erase(c.begin() + std::distance(first, last), c.end());
+    return r;
 }
 
 } // namespace sfl
@@ -27,10 +27,12 @@
 #include <sfl/detail/ignore_unused.hpp>
 #include <sfl/detail/initialized_memory_algorithms.hpp>
 #include <sfl/detail/normal_iterator.hpp>
+#include <sfl/detail/simd_find.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/to_address.hpp>
 #include <sfl/detail/type_traits.hpp>
 #include <sfl/detail/uninitialized_memory_algorithms.hpp>
+#include <sfl/detail/unordered_range_algorithms.hpp>
 
 #include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
 #include <cstddef>          // size_t
@@ -227,6 +229,11 @@ private:
 
     data data_;
 
+    using simd_search = sfl::dtl::is_simd_searchable<Key, KeyEqual>;
+
+    // Ranges shorter than this are inserted one element at a time.
+    static constexpr size_type bulk_insert_threshold = 16;
+
 public:
 
     //
@@ -1148,29 +1155,13 @@ public:
     SFL_NODISCARD
     iterator find(const Key& key)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return begin() + find_index(key);
     }
 
     SFL_NODISCARD
     const_iterator find(const Key& key) const
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return begin() + find_index(key);
     }
 
     template <typename K,
@@ -1251,6 +1242,30 @@ public:
 
 private:
 
+    size_type find_index(const Key& key) const
+    {
+        return find_index(key, simd_search());
+    }
+
+    size_type find_index(const Key& key, std::true_type) const
+    {
+        const value_type* const first = data();
+        return sfl::dtl::simd_find(first, first + size(), key) - first;
+    }
+
+    size_type find_index(const Key& key, std::false_type) const
+    {
+        for (auto it = begin(); it != end(); ++it)
+        {
+            if (data_.ref_to_equal()(*it, key))
+            {
+                return std::distance(begin(), it);
+            }
+        }
+
+        return size();
+    }
+
     void check_size(size_type n, const char* msg)
     {
         if (n > max_size())
@@ -1654,6 +1669,100 @@ private:
 
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
+    {
+        using tag = typename std::conditional
+        <
+            sfl::dtl::is_forward_iterator<InputIt>::value &&
+            std::is_same<InputIt, Sentinel>::value,
+            std::forward_iterator_tag,
+            std::input_iterator_tag
+        >::type;
+
+        insert_range_aux(std::move(first), std::move(last), tag());
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(InputIt first, Sentinel last, std::input_iterator_tag)
+    {
+        while (first != last)
+        {
+            insert(*first);
+            ++first;
+        }
+    }
+
+    template <typename ForwardIt>
+    void insert_range_aux(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+    {
+        // Storage is reserved once for the whole range.
+
+        const size_type n = std::distance(first, last);
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::small_unordered_flat_set::insert"));
+        }
+
+        if (n < bulk_insert_threshold)
+        {
+            while (first != last)
+            {
+                insert(*first);
+                ++first;
+            }
+        }
+        else
+        {
+            append_unique_range(first, last, sfl::dtl::is_batch_sortable<Key, KeyEqual>());
+        }
+    }
+
+    //
+    // Appends elements from range [first, last) at the end and then removes
+    // elements whose keys are duplicates. Keys are deduplicated by sorting
+    // temporary arrays, which is much faster than searching for each key.
+    // Capacity must be already reserved.
+    //
+    template <typename ForwardIt>
+    void append_unique_range(ForwardIt first, ForwardIt last, std::true_type)
+    {
+        const pointer mid = data_.last_;
+
+        data_.last_ = sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            first,
+            last,
+            data_.last_
+        );
+
+        SFL_TRY
+        {
+            const pointer new_last = sfl::dtl::remove_duplicate_keys_tail
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                mid,
+                data_.last_,
+                [](const value_type& x) -> const Key& { return x; }
+            );
+
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+
+            data_.last_ = new_last;
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), mid, data_.last_);
+
+            data_.last_ = mid;
+
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename ForwardIt>
+    void append_unique_range(ForwardIt first, ForwardIt last, std::false_type)
     {
         while (first != last)
         {
@@ -1829,21 +1938,27 @@ template <typename K, std::size_t N, typename E, typename A,
 typename small_unordered_flat_set<K, N, E, A>::size_type
     erase_if(small_unordered_flat_set<K, N, E, A>& c, Predicate pred)
 {
-    auto old_size = c.size();
-
-    for (auto it = c.begin(); it != c.end(); )
+    auto first = c.data();
+    auto last = first + c.size();
+    auto it = first;
+    while (it != last)
     {
         if (pred(*it))
         {
-            it = c.erase(it);
+            --last;
+            if (it != last)
+            {
+                *it = std::move(*last);
+            }
         }
         else
         {
             ++it;
         }
     }
-
-    return old_size - c.size();
+    auto r = std::distance(last, first + c.size());
+    c.erase(c.begin() + std::distance(first, last), c.end());
+    return r;
 }
 
 } // namespace sfl
@@ -43,11 +43,20 @@
 namespace sfl
 {
 
+namespace dtl
+{
+
+struct small_vector_storage_access;
+
+} // namespace dtl
+
 template < typename T,
            std::size_t N,
            typename Allocator = std::allocator<T> >
 class small_vector
 {
+    friend struct sfl::dtl::small_vector_storage_access;
+
 public:
 
     using allocator_type         = Allocator;
@@ -541,7 +550,7 @@ public:
                     pointer new_last  = new_first;
                     pointer new_eos   = new_first + N;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -549,7 +558,7 @@ public:
                         new_first
                     );
 
-                    sfl::dtl::destroy_a
+                    sfl::dtl::destroy_relocated_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -576,7 +585,7 @@ public:
 
                 SFL_TRY
                 {
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -596,7 +605,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -641,7 +650,7 @@ public:
                     pointer new_last  = new_first;
                     pointer new_eos   = new_first + N;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -649,7 +658,7 @@ public:
                         new_first
                     );
 
-                    sfl::dtl::destroy_a
+                    sfl::dtl::destroy_relocated_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -676,7 +685,7 @@ public:
 
                 SFL_TRY
                 {
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -696,7 +705,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -836,6 +845,21 @@ public:
 
                 ++data_.last_;
             }
+            else if (sfl::is_trivially_relocatable<value_type>::value)
+            {
+                // Construct new element at the end and relocate it
+                // to its position.
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.last_,
+                    std::forward<Args>(args)...
+                );
+
+                ++data_.last_;
+
+                sfl::dtl::trivially_rotate_right_by_one(p1, data_.last_);
+            }
             else
             {
                 // This container can contain duplicates so we must
@@ -906,7 +930,7 @@ public:
 
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -916,7 +940,7 @@ public:
 
                 ++new_last;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -957,7 +981,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1096,7 +1120,7 @@ public:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1134,7 +1158,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1202,9 +1226,18 @@ public:
 
         const pointer p = data_.first_ + std::distance(cbegin(), pos);
 
-        data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
+        if (sfl::is_trivially_relocatable<value_type>::value)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), p);
 
-        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+            data_.last_ = sfl::dtl::trivially_relocate(p + 1, data_.last_, p);
+        }
+        else
+        {
+            data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
+
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+        }
 
         return iterator(p);
     }
@@ -1221,11 +1254,20 @@ public:
         const pointer p1 = data_.first_ + std::distance(cbegin(), first);
         const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
-        const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
+        if (sfl::is_trivially_relocatable<value_type>::value)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), p1, p2);
 
-        sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+            data_.last_ = sfl::dtl::trivially_relocate(p2, data_.last_, p1);
+        }
+        else
+        {
+            const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
 
-        data_.last_ = new_last;
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+
+            data_.last_ = new_last;
+        }
 
         return iterator(p1);
     }
@@ -1283,7 +1325,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1327,7 +1369,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1414,7 +1456,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1458,7 +1500,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -2211,7 +2253,31 @@ private:
             const pointer p1 = data_.first_ + std::distance(cbegin(), pos);
             const pointer p2 = p1 + n;
 
-            if (p2 <= data_.last_)
+            if (sfl::is_trivially_relocatable<value_type>::value)
+            {
+                const pointer old_last = data_.last_;
+
+                sfl::dtl::trivially_relocate(p1, old_last, p2);
+
+                SFL_TRY
+                {
+                    sfl::dtl::uninitialized_fill_a
+                    (
+                        data_.ref_to_alloc(),
+                        p1,
+                        p2,
+                        tmp
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::trivially_relocate(p2, old_last + n, p1);
+                    SFL_RETHROW;
+                }
+
+                data_.last_ = old_last + n;
+            }
+            else if (p2 <= data_.last_)
             {
                 const pointer p3 = data_.last_ - n;
 
@@ -2315,7 +2381,7 @@ private:
 
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -2325,7 +2391,7 @@ private:
 
                 new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -2367,7 +2433,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -2428,7 +2494,31 @@ private:
             const pointer p1 = data_.first_ + std::distance(cbegin(), pos);
             const pointer p2 = p1 + n;
 
-            if (p2 <= data_.last_)
+            if (sfl::is_trivially_relocatable<value_type>::value)
+            {
+                const pointer old_last = data_.last_;
+
+                sfl::dtl::trivially_relocate(p1, old_last, p2);
+
+                SFL_TRY
+                {
+                    sfl::dtl::uninitialized_copy_a
+                    (
+                        data_.ref_to_alloc(),
+                        first,
+                        last,
+                        p1
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::trivially_relocate(p2, old_last + n, p1);
+                    SFL_RETHROW;
+                }
+
+                data_.last_ = old_last + n;
+            }
+            else if (p2 <= data_.last_)
             {
                 const pointer p3 = data_.last_ - n;
 
@@ -2516,9 +2606,22 @@ private:
 
             SFL_TRY
             {
+                // Elements are relocated after all new elements are
+                // constructed. Relocation cannot be undone.
+
+                sfl::dtl::uninitialized_copy_a
+                (
+                    data_.ref_to_alloc(),
+                    first,
+                    last,
+                    p
+                );
+
+                new_last = nullptr;
+
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -2526,15 +2629,9 @@ private:
                     new_first
                 );
 
-                new_last = sfl::dtl::uninitialized_copy_a
-                (
-                    data_.ref_to_alloc(),
-                    first,
-                    last,
-                    new_last
-                );
+                new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -2544,12 +2641,24 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::destroy_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_last
-                );
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        p,
+                        n
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
 
                 if (new_first != data_.internal_storage())
                 {
@@ -2564,7 +2673,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -2690,6 +2799,26 @@ typename small_vector<T, N, A>::size_type
     return r;
 }
 
+namespace dtl
+{
+
+//
+// Gives access to the storage of `small_vector`. Containers with the same
+// storage layout (small flat maps and sets) use it to exchange dynamically
+// allocated storage with `small_vector` without moving elements.
+// For internal use only.
+//
+struct small_vector_storage_access
+{
+    template <typename T, std::size_t N, typename A>
+    static auto storage(sfl::small_vector<T, N, A>& v) noexcept -> decltype((v.data_))
+    {
+        return v.data_;
+    }
+};
+
+} // namespace dtl
+
 } // namespace sfl
 
 #endif // SFL_SMALL_VECTOR_HPP_INCLUDED
@@ -25,9 +25,12 @@
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/initialized_memory_algorithms.hpp>
 #include <sfl/detail/normal_iterator.hpp>
+#include <sfl/detail/sorted_range_algorithms.hpp>
+#include <sfl/detail/sorted_search.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/type_traits.hpp>
 #include <sfl/detail/uninitialized_memory_algorithms.hpp>
+#include <sfl/static_vector.hpp>
 
 #include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
 #include <cstddef>          // size_t
@@ -74,6 +77,7 @@ public:
     using const_iterator         = sfl::dtl::normal_iterator<const_pointer, static_flat_multimap>;
     using reverse_iterator       = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using container_type         = sfl::static_vector<value_type, N>;
 
     class value_compare : protected key_compare
     {
@@ -187,6 +191,9 @@ private:
 
     data data_;
 
+    // Lookup uses branchless binary search for arithmetic keys compared by `std::less`.
+    using branchless_search = sfl::dtl::is_branchless_searchable<Key, Compare>;
+
 public:
 
     //
@@ -225,6 +232,31 @@ public:
         : static_flat_multimap(ilist.begin(), ilist.end(), comp)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        initialize_range(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    static_flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist)
+        : static_flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end())
+    {}
+
+    static_flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist,
+                         const Compare& comp)
+        : static_flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
     static_flat_multimap(const static_flat_multimap& other)
         : data_(other.data_.ref_to_comp())
     {
@@ -562,6 +594,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+    {
+        insert_range_aux(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    void insert(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_aux(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end());
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -570,6 +614,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_equivalent_t, Range&& range)
+    {
+        insert_range_aux(sfl::sorted_equivalent_t(), std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -580,6 +630,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_equivalent_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_aux(sfl::sorted_equivalent_t(), begin(range), end(range));
+    }
+
 #endif // before C++20
 
     iterator erase(iterator pos)
@@ -702,6 +760,42 @@ public:
         other.data_.last_ = other.data_.first_ + this_size;
     }
 
+    //
+    // Moves out the underlying storage. Container is empty after the call.
+    //
+    container_type extract() &&
+    {
+        container_type c
+        (
+            std::make_move_iterator(begin()),
+            std::make_move_iterator(end())
+        );
+
+        clear();
+
+        return c;
+    }
+
+    //
+    // Replaces the underlying storage with `other`. Elements of `other` must be
+    // sorted.
+    //
+    void replace(container_type&& other)
+    {
+        SFL_ASSERT(std::is_sorted(other.begin(), other.end(), data_.ref_to_comp()));
+
+        clear();
+
+        data_.last_ = sfl::dtl::uninitialized_move
+        (
+            other.data(),
+            other.data() + other.size(),
+            data_.first_
+        );
+
+        other.clear();
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -709,13 +803,13 @@ public:
     SFL_NODISCARD
     iterator lower_bound(const Key& key)
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::sorted_lower_bound(begin(), end(), key, data_.ref_to_comp(), branchless_search());
     }
 
     SFL_NODISCARD
     const_iterator lower_bound(const Key& key) const
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::sorted_lower_bound(begin(), end(), key, data_.ref_to_comp(), branchless_search());
     }
 
     template <typename K,
@@ -723,7 +817,7 @@ public:
     SFL_NODISCARD
     iterator lower_bound(const K& x)
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::sorted_lower_bound(begin(), end(), x, data_.ref_to_comp(), branchless_search());
     }
 
     template <typename K,
@@ -731,19 +825,19 @@ public:
     SFL_NODISCARD
     const_iterator lower_bound(const K& x) const
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::sorted_lower_bound(begin(), end(), x, data_.ref_to_comp(), branchless_search());
     }
 
     SFL_NODISCARD
     iterator upper_bound(const Key& key)
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::sorted_upper_bound(begin(), end(), key, data_.ref_to_comp(), branchless_search());
     }
 
     SFL_NODISCARD
     const_iterator upper_bound(const Key& key) const
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::sorted_upper_bound(begin(), end(), key, data_.ref_to_comp(), branchless_search());
     }
 
     template <typename K,
@@ -751,7 +845,7 @@ public:
     SFL_NODISCARD
     iterator upper_bound(const K& x)
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::sorted_upper_bound(begin(), end(), x, data_.ref_to_comp(), branchless_search());
     }
 
     template <typename K,
@@ -759,19 +853,19 @@ public:
     SFL_NODISCARD
     const_iterator upper_bound(const K& x) const
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::sorted_upper_bound(begin(), end(), x, data_.ref_to_comp(), branchless_search());
     }
 
     SFL_NODISCARD
     std::pair<iterator, iterator> equal_range(const Key& key)
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::sorted_equal_range(begin(), end(), key, data_.ref_to_comp(), branchless_search());
     }
 
     SFL_NODISCARD
     std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::sorted_equal_range(begin(), end(), key, data_.ref_to_comp(), branchless_search());
     }
 
     template <typename K,
@@ -779,7 +873,7 @@ public:
     SFL_NODISCARD
     std::pair<iterator, iterator> equal_range(const K& x)
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::sorted_equal_range(begin(), end(), x, data_.ref_to_comp(), branchless_search());
     }
 
     template <typename K,
@@ -787,7 +881,7 @@ public:
     SFL_NODISCARD
     std::pair<const_iterator, const_iterator> equal_range(const K& x) const
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::sorted_equal_range(begin(), end(), x, data_.ref_to_comp(), branchless_search());
     }
 
     SFL_NODISCARD
@@ -899,11 +993,21 @@ private:
     {
         SFL_TRY
         {
-            while (first != last)
-            {
-                insert(*first);
-                ++first;
-            }
+            insert_range_aux(std::move(first), std::move(last));
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.first_, data_.last_);
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void initialize_range(sfl::sorted_equivalent_t, InputIt first, Sentinel last)
+    {
+        SFL_TRY
+        {
+            insert_range_aux(sfl::sorted_equivalent_t(), std::move(first), std::move(last));
         }
         SFL_CATCH (...)
         {
@@ -999,11 +1103,136 @@ private:
 
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
+    {
+        // New elements are appended at the end and then sorted and merged with
+        // old elements. That is much faster than inserting elements one by one.
+
+        while (first != last)
+        {
+            const size_type old_size = size();
+
+            append_range(first, last);
+
+            sort_and_merge_tail(old_size);
+
+            if (first != last && full())
+            {
+                // Container is full. Insert next element in the usual way.
+                insert(*first);
+                ++first;
+            }
+        }
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(sfl::sorted_equivalent_t, InputIt first, Sentinel last)
     {
         while (first != last)
         {
-            insert(*first);
-            ++first;
+            const size_type old_size = size();
+
+            append_range(first, last);
+
+            SFL_ASSERT
+            (
+                std::is_sorted
+                (
+                    data_.first_ + old_size,
+                    data_.last_,
+                    data_.ref_to_comp()
+                )
+            );
+
+            merge_sorted_tail(old_size);
+
+            if (first != last && full())
+            {
+                // Container is full. Insert next element in the usual way.
+                insert(*first);
+                ++first;
+            }
+        }
+    }
+
+    //
+    // Appends elements from range [first, last) at the end until container
+    // is full. If exception is thrown, appended elements are destroyed.
+    //
+    template <typename InputIt, typename Sentinel>
+    void append_range(InputIt& first, const Sentinel& last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            while (first != last && !full())
+            {
+                insert_exactly_at(cend(), *first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            const pointer mid = data_.first_ + old_size;
+
+            sfl::dtl::destroy(mid, data_.last_);
+
+            data_.last_ = mid;
+
+            SFL_RETHROW;
+        }
+    }
+
+    //
+    // Sorts elements in range [first_ + old_size, last_) and merges them with
+    // elements in range [first_, first_ + old_size).
+    //
+    void sort_and_merge_tail(size_type old_size)
+    {
+        SFL_TRY
+        {
+            sfl::dtl::sort_equal_tail
+            (
+                data_.first_ + old_size,
+                data_.last_,
+                data_.ref_to_comp()
+            );
+        }
+        SFL_CATCH (...)
+        {
+            const pointer mid = data_.first_ + old_size;
+
+            sfl::dtl::destroy(mid, data_.last_);
+
+            data_.last_ = mid;
+
+            SFL_RETHROW;
+        }
+
+        merge_sorted_tail(old_size);
+    }
+
+    //
+    // Merges sorted elements in range [first_ + old_size, last_) with elements
+    // in range [first_, first_ + old_size).
+    //
+    void merge_sorted_tail(size_type old_size)
+    {
+        SFL_TRY
+        {
+            sfl::dtl::merge_tail
+            (
+                data_.first_,
+                data_.first_ + old_size,
+                data_.last_,
+                data_.ref_to_comp()
+            );
+        }
+        SFL_CATCH (...)
+        {
+            // Order of elements is unspecified now.
+            clear();
+            SFL_RETHROW;
         }
     }
 
@@ -1166,21 +1395,12 @@ template <typename K, typename T, std::size_t N, typename C, typename Predicate>
 typename static_flat_multimap<K, T, N, C>::size_type
     erase_if(static_flat_multimap<K, T, N, C>& c, Predicate pred)
 {
-    auto old_size = c.size();
-
-    for (auto it = c.begin(); it != c.end(); )
-    {
-        if (pred(*it))
-        {
-            it = c.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
-    }
-
-    return old_size - c.size();
+    auto first = c.data();
+    auto last = first + c.size();
+    auto it = std::remove_if(first, last, pred);
+    auto r = std::distance(it, last);
+    c.erase(c.begin() + std::distance(first, it), c.end());
+    return r;
 }
 
 } // namespace sfl
@@ -0,0 +1,1331 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_STATIC_FLAT_SOA_MAP_HPP_INCLUDED
+#define SFL_STATIC_FLAT_SOA_MAP_HPP_INCLUDED
+
+#include <sfl/detail/container_compatible_range.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/soa_iterator.hpp>
+#include <sfl/detail/sorted_range_algorithms.hpp>
+#include <sfl/detail/sorted_search.hpp>
+#include <sfl/detail/tags.hpp>
+#include <sfl/detail/type_traits.hpp>
+#include <sfl/static_vector.hpp>
+
+#include <algorithm>        // equal, lexicographical_compare
+#include <cstddef>          // size_t
+#include <functional>       // less
+#include <initializer_list> // initializer_list
+#include <iterator>         // distance, reverse_iterator
+#include <memory>           // addressof
+#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <utility>          // forward, move, pair
+
+#ifdef SFL_TEST_STATIC_FLAT_SOA_MAP
+void test_static_flat_soa_map();
+#endif
+
+namespace sfl
+{
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename Compare = std::less<Key> >
+class static_flat_soa_map
+{
+    #ifdef SFL_TEST_STATIC_FLAT_SOA_MAP
+    friend void ::test_static_flat_soa_map();
+    #endif
+
+    static_assert(N > 0, "N must be greater than zero.");
+
+public:
+
+    using key_type               = Key;
+    using mapped_type            = T;
+    using value_type             = std::pair<Key, T>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using key_compare            = Compare;
+    using reference              = std::pair<const Key&, T&>;
+    using const_reference        = std::pair<const Key&, const T&>;
+    using iterator               = sfl::dtl::soa_iterator<const Key*, T*, static_flat_soa_map>;
+    using const_iterator         = sfl::dtl::soa_iterator<const Key*, const T*, static_flat_soa_map>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using key_container_type     = sfl::static_vector<Key, N>;
+    using mapped_container_type  = sfl::static_vector<T, N>;
+
+    struct containers
+    {
+        key_container_type keys;
+        mapped_container_type values;
+    };
+
+    class value_compare : protected key_compare
+    {
+        friend class static_flat_soa_map;
+
+    private:
+
+        value_compare(const key_compare& c) : key_compare(c)
+        {}
+
+    public:
+
+        bool operator()(const const_reference& x, const const_reference& y) const
+        {
+            return key_compare::operator()(x.first, y.first);
+        }
+    };
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+private:
+
+    class data : public key_compare
+    {
+    public:
+
+        key_container_type keys_;
+        mapped_container_type values_;
+
+        data() noexcept(std::is_nothrow_default_constructible<key_compare>::value)
+            : key_compare()
+        {}
+
+        data(const key_compare& comp) noexcept(std::is_nothrow_copy_constructible<key_compare>::value)
+            : key_compare(comp)
+        {}
+
+        data(const data& other)
+            : key_compare(other.ref_to_comp())
+            , keys_(other.keys_)
+            , values_(other.values_)
+        {}
+
+        data(data&& other)
+            : key_compare(std::move(other.ref_to_comp()))
+            , keys_(std::move(other.keys_))
+            , values_(std::move(other.values_))
+        {}
+
+        key_compare& ref_to_comp() noexcept
+        {
+            return *this;
+        }
+
+        const key_compare& ref_to_comp() const noexcept
+        {
+            return *this;
+        }
+    };
+
+    data data_;
+
+    // Lookup uses branchless binary search for arithmetic keys compared by `std::less`.
+    using branchless_search = sfl::dtl::is_branchless_searchable<Key, Compare>;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    static_flat_soa_map() noexcept(std::is_nothrow_default_constructible<Compare>::value)
+        : data_()
+    {}
+
+    explicit static_flat_soa_map(const Compare& comp) noexcept(std::is_nothrow_copy_constructible<Compare>::value)
+        : data_(comp)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_soa_map(InputIt first, InputIt last)
+        : data_()
+    {
+        insert_range_aux(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_soa_map(InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        insert_range_aux(first, last);
+    }
+
+    static_flat_soa_map(std::initializer_list<value_type> ilist)
+        : static_flat_soa_map(ilist.begin(), ilist.end())
+    {}
+
+    static_flat_soa_map(std::initializer_list<value_type> ilist,
+                        const Compare& comp)
+        : static_flat_soa_map(ilist.begin(), ilist.end(), comp)
+    {}
+
+    static_flat_soa_map(const static_flat_soa_map& other)
+        : data_(other.data_)
+    {}
+
+    static_flat_soa_map(static_flat_soa_map&& other)
+        : data_(std::move(other.data_))
+    {}
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    static_flat_soa_map(sfl::from_range_t, Range&& range)
+        : data_()
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    static_flat_soa_map(sfl::from_range_t, Range&& range, const Compare& comp)
+        : data_(comp)
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    static_flat_soa_map(sfl::from_range_t, Range&& range)
+        : data_()
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <typename Range>
+    static_flat_soa_map(sfl::from_range_t, Range&& range, const Compare& comp)
+        : data_(comp)
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+#endif // before C++20
+
+    ~static_flat_soa_map()
+    {}
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    static_flat_soa_map& operator=(const static_flat_soa_map& other)
+    {
+        if (this != &other)
+        {
+            SFL_TRY
+            {
+                data_.ref_to_comp() = other.data_.ref_to_comp();
+                data_.keys_ = other.data_.keys_;
+                data_.values_ = other.data_.values_;
+            }
+            SFL_CATCH (...)
+            {
+                // Arrays may have different sizes now.
+                clear();
+                SFL_RETHROW;
+            }
+        }
+
+        return *this;
+    }
+
+    static_flat_soa_map& operator=(static_flat_soa_map&& other)
+    {
+        SFL_TRY
+        {
+            data_.ref_to_comp() = std::move(other.data_.ref_to_comp());
+            data_.keys_ = std::move(other.data_.keys_);
+            data_.values_ = std::move(other.data_.values_);
+        }
+        SFL_CATCH (...)
+        {
+            // Arrays may have different sizes now.
+            clear();
+            SFL_RETHROW;
+        }
+
+        return *this;
+    }
+
+    static_flat_soa_map& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- KEY COMPARE -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_compare key_comp() const
+    {
+        return data_.ref_to_comp();
+    }
+
+    //
+    // ---- VALUE COMPARE -----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    value_compare value_comp() const
+    {
+        return value_compare(data_.ref_to_comp());
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return iterator(data_.keys_.data(), data_.values_.data());
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(data_.keys_.data(), data_.values_.data());
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return begin() + size();
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return begin() + size();
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return begin() + pos;
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return begin() + pos;
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return std::distance(cbegin(), pos);
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.keys_.empty();
+    }
+
+    SFL_NODISCARD
+    bool full() const noexcept
+    {
+        return data_.keys_.full();
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.keys_.size();
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type max_size() noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type capacity() noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    size_type available() const noexcept
+    {
+        return capacity() - size();
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        data_.keys_.clear();
+        data_.values_.clear();
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return insert_aux(value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        SFL_ASSERT(!full());
+        return insert_aux(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        SFL_ASSERT(!full());
+        return insert_aux(std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        SFL_ASSERT(!full());
+        return insert_aux(value_type(std::forward<P>(value)));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P>::value>* = nullptr>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value_type(std::forward<P>(value)));
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(InputIt first, InputIt last)
+    {
+        insert_range_aux(first, last);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert_range_aux(ilist.begin(), ilist.end());
+    }
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(Range&& range)
+    {
+        insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    void insert_range(Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_aux(begin(range), end(range));
+    }
+
+#endif // before C++20
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, const Key& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, Key&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                sfl::dtl::has_is_transparent<Compare, K>::value
+              >* = nullptr>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos < cend());
+
+        const difference_type offset = std::distance(cbegin(), pos);
+
+        data_.keys_.erase(data_.keys_.begin() + offset);
+        data_.values_.erase(data_.values_.begin() + offset);
+
+        return begin() + offset;
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+
+        const difference_type offset1 = std::distance(cbegin(), first);
+        const difference_type offset2 = std::distance(cbegin(), last);
+
+        data_.keys_.erase
+        (
+            data_.keys_.begin() + offset1,
+            data_.keys_.begin() + offset2
+        );
+
+        data_.values_.erase
+        (
+            data_.values_.begin() + offset1,
+            data_.values_.begin() + offset2
+        );
+
+        return begin() + offset1;
+    }
+
+    size_type erase(const Key& key)
+    {
+        auto it = find(key);
+        if (it == cend())
+        {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    size_type erase(K&& x)
+    {
+        auto it = find(x);
+        if (it == cend())
+        {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    void swap(static_flat_soa_map& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        using std::swap;
+
+        swap(this->data_.ref_to_comp(), other.data_.ref_to_comp());
+
+        this->data_.keys_.swap(other.data_.keys_);
+        this->data_.values_.swap(other.data_.values_);
+    }
+
+    //
+    // Moves out the underlying arrays of keys and mapped values.
+    // Container is empty after the call.
+    //
+    containers extract() &&
+    {
+        containers c
+        {
+            std::move(data_.keys_),
+            std::move(data_.values_)
+        };
+
+        clear();
+
+        return c;
+    }
+
+    //
+    // Replaces the underlying arrays. Arrays must have the same size and keys
+    // must be sorted and must not contain equivalent elements.
+    //
+    void replace(key_container_type&& keys, mapped_container_type&& values)
+    {
+        SFL_ASSERT(keys.size() == values.size());
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(keys.begin(), keys.end(), data_.ref_to_comp()));
+
+        SFL_TRY
+        {
+            data_.keys_ = std::move(keys);
+            data_.values_ = std::move(values);
+        }
+        SFL_CATCH (...)
+        {
+            clear();
+            SFL_RETHROW;
+        }
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator lower_bound(const Key& key)
+    {
+        return begin() + lower_bound_index(key);
+    }
+
+    SFL_NODISCARD
+    const_iterator lower_bound(const Key& key) const
+    {
+        return begin() + lower_bound_index(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator lower_bound(const K& x)
+    {
+        return begin() + lower_bound_index(x);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator lower_bound(const K& x) const
+    {
+        return begin() + lower_bound_index(x);
+    }
+
+    SFL_NODISCARD
+    iterator upper_bound(const Key& key)
+    {
+        return begin() + upper_bound_index(key);
+    }
+
+    SFL_NODISCARD
+    const_iterator upper_bound(const Key& key) const
+    {
+        return begin() + upper_bound_index(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator upper_bound(const K& x)
+    {
+        return begin() + upper_bound_index(x);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator upper_bound(const K& x) const
+    {
+        return begin() + upper_bound_index(x);
+    }
+
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        return std::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        return std::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const K& x)
+    {
+        return std::make_pair(lower_bound(x), upper_bound(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const K& x) const
+    {
+        return std::make_pair(lower_bound(x), upper_bound(x));
+    }
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return begin() + find_index(key);
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return begin() + find_index(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator find(const K& x)
+    {
+        return begin() + find_index(x);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator find(const K& x) const
+    {
+        return begin() + find_index(x);
+    }
+
+    SFL_NODISCARD
+    size_type count(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    size_type count(const K& x) const
+    {
+        return find_index(x) != size();
+    }
+
+    SFL_NODISCARD
+    bool contains(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    bool contains(const K& x) const
+    {
+        return find_index(x) != size();
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    T& at(const Key& key)
+    {
+        const size_type i = find_index(key);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_flat_soa_map::at");
+        }
+
+        return data_.values_[i];
+    }
+
+    SFL_NODISCARD
+    const T& at(const Key& key) const
+    {
+        const size_type i = find_index(key);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_flat_soa_map::at");
+        }
+
+        return data_.values_[i];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& at(const K& x)
+    {
+        const size_type i = find_index(x);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_flat_soa_map::at");
+        }
+
+        return data_.values_[i];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const T& at(const K& x) const
+    {
+        const size_type i = find_index(x);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_flat_soa_map::at");
+        }
+
+        return data_.values_[i];
+    }
+
+    SFL_NODISCARD
+    T& operator[](const Key& key)
+    {
+        return data_.values_[index_of(try_emplace(key).first)];
+    }
+
+    SFL_NODISCARD
+    T& operator[](Key&& key)
+    {
+        return data_.values_[index_of(try_emplace(std::move(key)).first)];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& operator[](K&& key)
+    {
+        return data_.values_[index_of(try_emplace(std::forward<K>(key)).first)];
+    }
+
+    SFL_NODISCARD
+    const key_container_type& keys() const noexcept
+    {
+        return data_.keys_;
+    }
+
+    SFL_NODISCARD
+    const mapped_container_type& values() const noexcept
+    {
+        return data_.values_;
+    }
+
+private:
+
+    template <typename K>
+    size_type lower_bound_index(const K& x) const
+    {
+        return std::distance
+        (
+            data_.keys_.begin(),
+            sfl::dtl::sorted_lower_bound
+            (
+                data_.keys_.begin(),
+                data_.keys_.end(),
+                x,
+                data_.ref_to_comp(),
+                branchless_search()
+            )
+        );
+    }
+
+    template <typename K>
+    size_type upper_bound_index(const K& x) const
+    {
+        return std::distance
+        (
+            data_.keys_.begin(),
+            sfl::dtl::sorted_upper_bound
+            (
+                data_.keys_.begin(),
+                data_.keys_.end(),
+                x,
+                data_.ref_to_comp(),
+                branchless_search()
+            )
+        );
+    }
+
+    // Returns size() if element is not found.
+    template <typename K>
+    size_type find_index(const K& x) const
+    {
+        const size_type i = lower_bound_index(x);
+
+        if (i != size() && data_.ref_to_comp()(x, data_.keys_[i]))
+        {
+            return size();
+        }
+
+        return i;
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(InputIt first, Sentinel last)
+    {
+        while (first != last)
+        {
+            insert(*first);
+            ++first;
+        }
+    }
+
+    template <typename Value>
+    std::pair<iterator, bool> insert_aux(Value&& value)
+    {
+        const size_type i = lower_bound_index(value.first);
+
+        if (i == size() || data_.ref_to_comp()(value.first, data_.keys_[i]))
+        {
+            return std::make_pair
+            (
+                insert_exactly_at
+                (
+                    i,
+                    std::forward<Value>(value).first,
+                    std::forward<Value>(value).second
+                ),
+                true
+            );
+        }
+
+        return std::make_pair(begin() + i, false);
+    }
+
+    template <typename Value>
+    iterator insert_aux(const_iterator hint, Value&& value)
+    {
+        if (is_insert_hint_good(hint, value.first))
+        {
+            return insert_exactly_at
+            (
+                index_of(hint),
+                std::forward<Value>(value).first,
+                std::forward<Value>(value).second
+            );
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return insert_aux(std::forward<Value>(value)).first;
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign_aux(K&& key, M&& obj)
+    {
+        const size_type i = lower_bound_index(key);
+
+        if (i == size() || data_.ref_to_comp()(key, data_.keys_[i]))
+        {
+            return std::make_pair
+            (
+                insert_exactly_at(i, std::forward<K>(key), std::forward<M>(obj)),
+                true
+            );
+        }
+
+        data_.values_[i] = std::forward<M>(obj);
+        return std::make_pair(begin() + i, false);
+    }
+
+    template <typename K, typename M>
+    iterator insert_or_assign_aux(const_iterator hint, K&& key, M&& obj)
+    {
+        if (is_insert_hint_good(hint, key))
+        {
+            return insert_exactly_at
+            (
+                index_of(hint),
+                std::forward<K>(key),
+                std::forward<M>(obj)
+            );
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj)).first;
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_aux(K&& key, Args&&... args)
+    {
+        const size_type i = lower_bound_index(key);
+
+        if (i == size() || data_.ref_to_comp()(key, data_.keys_[i]))
+        {
+            return std::make_pair
+            (
+                insert_exactly_at(i, std::forward<K>(key), std::forward<Args>(args)...),
+                true
+            );
+        }
+
+        return std::make_pair(begin() + i, false);
+    }
+
+    template <typename K, typename... Args>
+    iterator try_emplace_aux(const_iterator hint, K&& key, Args&&... args)
+    {
+        if (is_insert_hint_good(hint, key))
+        {
+            return insert_exactly_at
+            (
+                index_of(hint),
+                std::forward<K>(key),
+                std::forward<Args>(args)...
+            );
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
+    }
+
+    //
+    // Inserts key at position `i` into array of keys and constructs mapped
+    // value from `args` at position `i` into array of mapped values.
+    //
+    template <typename K, typename... Args>
+    iterator insert_exactly_at(size_type i, K&& key, Args&&... args)
+    {
+        data_.keys_.emplace(data_.keys_.begin() + i, std::forward<K>(key));
+
+        SFL_TRY
+        {
+            data_.values_.emplace(data_.values_.begin() + i, std::forward<Args>(args)...);
+        }
+        SFL_CATCH (...)
+        {
+            data_.keys_.erase(data_.keys_.begin() + i);
+            SFL_RETHROW;
+        }
+
+        return begin() + i;
+    }
+
+    template <typename K>
+    bool is_insert_hint_good(const_iterator hint, const K& key)
+    {
+        const size_type i = index_of(hint);
+
+        return (i == 0      || data_.ref_to_comp()(data_.keys_[i - 1], key))
+            && (i == size() || data_.ref_to_comp()(key, data_.keys_[i]));
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator==
+(
+    const static_flat_soa_map<K, T, N, C>& x,
+    const static_flat_soa_map<K, T, N, C>& y
+)
+{
+    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator!=
+(
+    const static_flat_soa_map<K, T, N, C>& x,
+    const static_flat_soa_map<K, T, N, C>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator<
+(
+    const static_flat_soa_map<K, T, N, C>& x,
+    const static_flat_soa_map<K, T, N, C>& y
+)
+{
+    return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator>
+(
+    const static_flat_soa_map<K, T, N, C>& x,
+    const static_flat_soa_map<K, T, N, C>& y
+)
+{
+    return y < x;
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator<=
+(
+    const static_flat_soa_map<K, T, N, C>& x,
+    const static_flat_soa_map<K, T, N, C>& y
+)
+{
+    return !(y < x);
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator>=
+(
+    const static_flat_soa_map<K, T, N, C>& x,
+    const static_flat_soa_map<K, T, N, C>& y
+)
+{
+    return !(x < y);
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+void swap
+(
+    static_flat_soa_map<K, T, N, C>& x,
+    static_flat_soa_map<K, T, N, C>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename Predicate>
+typename static_flat_soa_map<K, T, N, C>::size_type
+    erase_if(static_flat_soa_map<K, T, N, C>& c, Predicate pred)
+{
+    using const_reference = typename static_flat_soa_map<K, T, N, C>::const_reference;
+
+    // Elements are erased from both arrays in a single pass.
+
+    auto containers = std::move(c).extract();
+
+    auto& keys = containers.keys;
+    auto& values = containers.values;
+
+    const auto old_size = keys.size();
+
+    decltype(keys.size()) new_size = 0;
+
+    for (decltype(keys.size()) i = 0; i < old_size; ++i)
+    {
+        const_reference ref(keys[i], values[i]);
+
+        if (!pred(ref))
+        {
+            if (i != new_size)
+            {
+                keys[new_size] = std::move(keys[i]);
+                values[new_size] = std::move(values[i]);
+            }
+
+            ++new_size;
+        }
+    }
+
+    keys.erase(keys.begin() + new_size, keys.end());
+    values.erase(values.begin() + new_size, values.end());
+
+    c.replace(std::move(keys), std::move(values));
+
+    return old_size - new_size;
+}
+
+} // namespace sfl
+
+#endif // SFL_STATIC_FLAT_SOA_MAP_HPP_INCLUDED
@@ -40,6 +40,9 @@
 namespace sfl
 {
 
+template <typename Key, typename T, std::size_t N, typename Compare>
+class static_multimap;
+
 template < typename Key,
            typename T,
            std::size_t N,
@@ -48,6 +51,12 @@ class static_map
 {
     static_assert(N > 0, "N must be greater than zero.");
 
+    template <typename, typename, std::size_t, typename>
+    friend class static_map;
+
+    template <typename, typename, std::size_t, typename>
+    friend class static_multimap;
+
 public:
 
     using key_type       = Key;
@@ -98,6 +107,8 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::reverse_iterator;
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = typename tree_type::node_handle;
+    using insert_return_type     = sfl::dtl::rb_tree_insert_return_type<iterator, node_type>;
 
 public:
 
@@ -426,6 +437,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    insert_return_type insert(node_type&& nh)
+    {
+        SFL_ASSERT(nh.empty() || !full());
+        return tree_.insert_node_unique(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        SFL_ASSERT(nh.empty() || !full());
+        return tree_.insert_node_hint_unique(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -586,6 +609,51 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.extract(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.extract(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.extract(x);
+    }
+
+    template <typename Compare2>
+    void merge(static_map<Key, T, N, Compare2>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(static_map<Key, T, N, Compare2>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(static_multimap<Key, T, N, Compare2>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(static_multimap<Key, T, N, Compare2>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -815,11 +883,7 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_unique(first, last);
     }
 
     template <typename K, typename M>
@@ -835,7 +899,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<M>(obj))
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return std::make_pair(iterator(x), true);
         }
@@ -860,7 +924,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<M>(obj))
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return iterator(x);
         }
@@ -885,7 +949,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return std::make_pair(iterator(x), true);
         }
@@ -908,7 +972,7 @@ private:
                 std::forward_as_tuple(std::forward<K>(key)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
             );
-            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum());
+            tree_.insert(x, res.pos, res.left, tree_.data_.root(), tree_.data_.minimum(), tree_.data_.maximum());
             ++tree_.data_.size_;
             return iterator(x);
         }
@@ -39,6 +39,9 @@
 namespace sfl
 {
 
+template <typename Key, typename T, std::size_t N, typename Compare>
+class static_map;
+
 template < typename Key,
            typename T,
            std::size_t N,
@@ -47,6 +50,12 @@ class static_multimap
 {
     static_assert(N > 0, "N must be greater than zero.");
 
+    template <typename, typename, std::size_t, typename>
+    friend class static_multimap;
+
+    template <typename, typename, std::size_t, typename>
+    friend class static_map;
+
 public:
 
     using key_type       = Key;
@@ -97,6 +106,7 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::reverse_iterator;
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = typename tree_type::node_handle;
 
 public:
 
@@ -425,6 +435,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    iterator insert(node_type&& nh)
+    {
+        SFL_ASSERT(nh.empty() || !full());
+        return tree_.insert_node_equal(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        SFL_ASSERT(nh.empty() || !full());
+        return tree_.insert_node_hint_equal(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -477,6 +499,55 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.extract(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.extract(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.extract(x);
+    }
+
+    template <typename Compare2>
+    void merge(static_multimap<Key, T, N, Compare2>& source)
+    {
+        SFL_ASSERT(size() + source.size() <= capacity());
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(static_multimap<Key, T, N, Compare2>&& source)
+    {
+        SFL_ASSERT(size() + source.size() <= capacity());
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(static_map<Key, T, N, Compare2>& source)
+    {
+        SFL_ASSERT(size() + source.size() <= capacity());
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(static_map<Key, T, N, Compare2>&& source)
+    {
+        SFL_ASSERT(size() + source.size() <= capacity());
+        tree_.merge_equal(source.tree_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -626,11 +697,7 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_equal(first, last);
     }
 };
 
@@ -0,0 +1,512 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_STATIC_PERFECT_MAP_HPP_INCLUDED
+#define SFL_STATIC_PERFECT_MAP_HPP_INCLUDED
+
+#include <sfl/detail/cpp.hpp>
+
+#if SFL_CPP_VERSION >= SFL_CPP_17
+
+#include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/index_sequence.hpp>
+#include <sfl/detail/type_traits.hpp>
+
+#include <cstddef>          // size_t
+#include <cstdint>          // uint32_t, uint64_t
+#include <functional>       // equal_to
+#include <initializer_list> // initializer_list
+#include <limits>           // numeric_limits
+#include <string_view>      // basic_string_view
+#include <type_traits>      // is_enum, is_integral
+#include <utility>          // pair
+
+namespace sfl
+{
+
+//
+// Hash function that can be evaluated at compile time.
+// Specialized for integral types, enumerations and string views.
+//
+template <typename Key, typename = void>
+struct constexpr_hash;
+
+template <typename Key>
+struct constexpr_hash
+<
+    Key,
+    sfl::dtl::enable_if_t<std::is_integral<Key>::value || std::is_enum<Key>::value>
+>
+{
+    constexpr std::uint64_t operator()(const Key& key) const noexcept
+    {
+        return std::uint64_t(key);
+    }
+};
+
+template <typename CharT, typename Traits>
+struct constexpr_hash<std::basic_string_view<CharT, Traits>, void>
+{
+    using is_transparent = void;
+
+    // FNV-1a
+    constexpr std::uint64_t operator()(std::basic_string_view<CharT, Traits> key) const noexcept
+    {
+        std::uint64_t h = 0xCBF29CE484222325ull;
+
+        for (const CharT c : key)
+        {
+            h ^= std::uint64_t(c);
+            h *= 0x100000001B3ull;
+        }
+
+        return h;
+    }
+};
+
+namespace dtl
+{
+
+// Finalizer of MurmurHash3. `seed` selects one of many hash functions.
+constexpr std::uint64_t perfect_hash_mix(std::uint64_t h, std::uint64_t seed) noexcept
+{
+    h ^= seed * 0x9E3779B97F4A7C15ull;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+} // namespace dtl
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename Hash = sfl::constexpr_hash<Key>,
+           typename KeyEqual = std::equal_to<Key> >
+class static_perfect_map
+{
+    static_assert(N > 0, "N must be greater than zero.");
+
+public:
+
+    using key_type        = Key;
+    using mapped_type     = T;
+    using value_type      = std::pair<Key, T>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = KeyEqual;
+    using reference       = const value_type&;
+    using const_reference = const value_type&;
+    using pointer         = const value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = const value_type*;
+    using const_iterator  = const value_type*;
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+private:
+
+    // Keys are first distributed into buckets. Each bucket has its own seed
+    // that maps keys of the bucket to distinct slots (hash and displace).
+    static constexpr size_type bucket_count_ = (N + 1) / 2;
+
+    struct layout_type
+    {
+        std::uint32_t seeds[bucket_count_];
+        size_type     order[N]; // Index of input element stored in each slot
+    };
+
+    template <typename K>
+    using is_transparent = std::integral_constant
+    <
+        bool,
+        sfl::dtl::has_is_transparent<Hash, K>::value &&
+        sfl::dtl::has_is_transparent<KeyEqual, K>::value
+    >;
+
+    hasher hash_;
+    key_equal equal_;
+    std::uint32_t seeds_[bucket_count_];
+    value_type values_[N];
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    constexpr static_perfect_map(const value_type (&values)[N])
+        : static_perfect_map(values, Hash(), KeyEqual())
+    {}
+
+    constexpr static_perfect_map(const value_type (&values)[N], const Hash& hash, const KeyEqual& equal)
+        : static_perfect_map
+          (
+              values,
+              make_layout(values, hash, equal),
+              hash,
+              equal,
+              sfl::dtl::make_index_sequence<bucket_count_>(),
+              sfl::dtl::make_index_sequence<N>()
+          )
+    {}
+
+    constexpr static_perfect_map(std::initializer_list<value_type> ilist)
+        : static_perfect_map(ilist, Hash(), KeyEqual())
+    {}
+
+    constexpr static_perfect_map(std::initializer_list<value_type> ilist, const Hash& hash, const KeyEqual& equal)
+        : static_perfect_map
+          (
+              (SFL_ASSERT(ilist.size() == N), ilist.begin()),
+              make_layout(ilist.begin(), hash, equal),
+              hash,
+              equal,
+              sfl::dtl::make_index_sequence<bucket_count_>(),
+              sfl::dtl::make_index_sequence<N>()
+          )
+    {}
+
+    constexpr static_perfect_map(const static_perfect_map& other) = default;
+
+    constexpr static_perfect_map& operator=(const static_perfect_map& other) = default;
+
+private:
+
+    template <std::size_t... I, std::size_t... J>
+    constexpr static_perfect_map
+    (
+        const value_type* values,
+        const layout_type& layout,
+        const Hash& hash,
+        const KeyEqual& equal,
+        sfl::dtl::index_sequence<I...>,
+        sfl::dtl::index_sequence<J...>
+    )
+        : hash_(hash)
+        , equal_(equal)
+        , seeds_{layout.seeds[I]...}
+        , values_{values[layout.order[J]]...}
+    {}
+
+public:
+
+    //
+    // ---- HASH POLICY -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr hasher hash_function() const
+    {
+        return hash_;
+    }
+
+    SFL_NODISCARD
+    constexpr key_equal key_eq() const
+    {
+        return equal_;
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr const_iterator begin() const noexcept
+    {
+        return values_;
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return values_;
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator end() const noexcept
+    {
+        return values_ + N;
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator cend() const noexcept
+    {
+        return values_ + N;
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr bool empty() const noexcept
+    {
+        return false;
+    }
+
+    SFL_NODISCARD
+    constexpr size_type size() const noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type max_size() noexcept
+    {
+        return N;
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr const_iterator find(const Key& key) const
+    {
+        return find_aux(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    constexpr const_iterator find(const K& x) const
+    {
+        return find_aux(x);
+    }
+
+    SFL_NODISCARD
+    constexpr size_type count(const Key& key) const
+    {
+        return find_aux(key) != end();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    constexpr size_type count(const K& x) const
+    {
+        return find_aux(x) != end();
+    }
+
+    SFL_NODISCARD
+    constexpr bool contains(const Key& key) const
+    {
+        return find_aux(key) != end();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    constexpr bool contains(const K& x) const
+    {
+        return find_aux(x) != end();
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr const T& at(const Key& key) const
+    {
+        return at_aux(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    constexpr const T& at(const K& x) const
+    {
+        return at_aux(x);
+    }
+
+private:
+
+    static constexpr size_type bucket_of(std::uint64_t h) noexcept
+    {
+        return size_type(h % bucket_count_);
+    }
+
+    static constexpr size_type slot_of(std::uint64_t h, std::uint32_t seed) noexcept
+    {
+        return size_type(sfl::dtl::perfect_hash_mix(h, seed) % N);
+    }
+
+    // Every key maps to exactly one slot, so lookup doesn't probe:
+    // one hash, one seed load and one key comparison.
+    template <typename K>
+    constexpr const_iterator find_aux(const K& key) const
+    {
+        const std::uint64_t h = sfl::dtl::perfect_hash_mix(hash_(key), 0);
+        const size_type i = slot_of(h, seeds_[bucket_of(h)]);
+        return equal_(values_[i].first, key) ? values_ + i : values_ + N;
+    }
+
+    template <typename K>
+    constexpr const T& at_aux(const K& key) const
+    {
+        const auto it = find_aux(key);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_perfect_map::at");
+        }
+
+        return it->second;
+    }
+
+    static constexpr layout_type make_layout(const value_type* values, const Hash& hash, const KeyEqual& equal)
+    {
+        layout_type layout {};
+
+        std::uint64_t hashes[N] {};
+        size_type bucket_size[bucket_count_] {};
+        size_type bucket_first[bucket_count_ + 1] {};
+        size_type by_bucket[N] {};
+        size_type max_bucket_size = 0;
+
+        for (size_type i = 0; i < N; ++i)
+        {
+            hashes[i] = sfl::dtl::perfect_hash_mix(hash(values[i].first), 0);
+            ++bucket_size[bucket_of(hashes[i])];
+        }
+
+        // Group elements by bucket (counting sort).
+        for (size_type b = 0; b < bucket_count_; ++b)
+        {
+            bucket_first[b + 1] = bucket_first[b] + bucket_size[b];
+
+            if (bucket_size[b] > max_bucket_size)
+            {
+                max_bucket_size = bucket_size[b];
+            }
+        }
+
+        {
+            size_type next[bucket_count_] {};
+
+            for (size_type i = 0; i < N; ++i)
+            {
+                const size_type b = bucket_of(hashes[i]);
+                by_bucket[bucket_first[b] + next[b]++] = i;
+            }
+        }
+
+        // Elements with equal hashes cannot be separated by any seed.
+        for (size_type b = 0; b < bucket_count_; ++b)
+        {
+            for (size_type k = bucket_first[b]; k < bucket_first[b + 1]; ++k)
+            {
+                for (size_type l = bucket_first[b]; l < k; ++l)
+                {
+                    if (hashes[by_bucket[k]] == hashes[by_bucket[l]])
+                    {
+                        if (equal(values[by_bucket[k]].first, values[by_bucket[l]].first))
+                        {
+                            sfl::dtl::throw_invalid_argument("sfl::static_perfect_map: duplicate key");
+                        }
+                        else
+                        {
+                            sfl::dtl::throw_invalid_argument("sfl::static_perfect_map: hash collision");
+                        }
+                    }
+                }
+            }
+        }
+
+        // Place large buckets first, while most slots are still free.
+        bool taken[N] {};
+        size_type slots[N] {};
+
+        for (size_type size = max_bucket_size; size > 0; --size)
+        {
+            for (size_type b = 0; b < bucket_count_; ++b)
+            {
+                if (bucket_size[b] != size)
+                {
+                    continue;
+                }
+
+                const size_type first = bucket_first[b];
+
+                for (std::uint32_t seed = 1; ; ++seed)
+                {
+                    if (seed == std::numeric_limits<std::uint32_t>::max())
+                    {
+                        sfl::dtl::throw_invalid_argument("sfl::static_perfect_map: cannot find seed");
+                    }
+
+                    bool ok = true;
+
+                    for (size_type k = 0; k < size && ok; ++k)
+                    {
+                        slots[k] = slot_of(hashes[by_bucket[first + k]], seed);
+
+                        ok = !taken[slots[k]];
+
+                        for (size_type l = 0; l < k && ok; ++l)
+                        {
+                            ok = slots[l] != slots[k];
+                        }
+                    }
+
+                    if (ok)
+                    {
+                        for (size_type k = 0; k < size; ++k)
+                        {
+                            taken[slots[k]] = true;
+                            layout.order[slots[k]] = by_bucket[first + k];
+                        }
+
+                        layout.seeds[b] = seed;
+                        break;
+                    }
+                }
+            }
+        }
+
+        return layout;
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename Key, typename T, std::size_t N>
+SFL_NODISCARD
+constexpr static_perfect_map<Key, T, N>
+    make_static_perfect_map(const std::pair<Key, T> (&values)[N])
+{
+    return static_perfect_map<Key, T, N>(values);
+}
+
+} // namespace sfl
+
+#endif // SFL_CPP_VERSION >= SFL_CPP_17
+
+#endif // SFL_STATIC_PERFECT_MAP_HPP_INCLUDED
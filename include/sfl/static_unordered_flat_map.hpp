@@ -26,6 +26,7 @@
 #include <sfl/detail/exceptions.hpp>
 #include <sfl/detail/ignore_unused.hpp>
 #include <sfl/detail/initialized_memory_algorithms.hpp>
+#include <sfl/detail/lookup_policy.hpp>
 #include <sfl/detail/normal_iterator.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/type_traits.hpp>
@@ -51,7 +52,8 @@ namespace sfl
 template < typename Key,
            typename T,
            std::size_t N,
-           typename KeyEqual = std::equal_to<Key> >
+           typename KeyEqual = std::equal_to<Key>,
+           typename LookupPolicy = sfl::lookup_keep_order >
 class static_unordered_flat_map
 {
     #ifdef SFL_TEST_STATIC_UNORDERED_FLAT_MAP
@@ -68,6 +70,7 @@ public:
     using size_type        = std::size_t;
     using difference_type  = std::ptrdiff_t;
     using key_equal        = KeyEqual;
+    using lookup_policy    = LookupPolicy;
     using reference        = value_type&;
     using const_reference  = const value_type&;
     using pointer          = value_type*;
@@ -729,7 +732,7 @@ public:
 
     size_type erase(const Key& key)
     {
-        auto it = find(key);
+        auto it = find_aux(key);
 
         if (it == cend())
         {
@@ -744,7 +747,7 @@ public:
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
     size_type erase(K&& x)
     {
-        auto it = find(x);
+        auto it = find_aux(x);
 
         if (it == cend())
         {
@@ -825,15 +828,7 @@ public:
     SFL_NODISCARD
     iterator find(const Key& key)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return find_on_access(key);
     }
 
     SFL_NODISCARD
@@ -855,15 +850,7 @@ public:
     SFL_NODISCARD
     iterator find(const K& x)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, x))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return find_on_access(x);
     }
 
     template <typename K,
@@ -1089,11 +1076,39 @@ private:
         }
     }
 
+    template <typename K>
+    iterator find_aux(const K& x)
+    {
+        for (auto it = begin(); it != end(); ++it)
+        {
+            if (data_.ref_to_equal()(*it, x))
+            {
+                return it;
+            }
+        }
+
+        return end();
+    }
+
+    // Non-const lookup.
+    template <typename K>
+    iterator find_on_access(const K& x)
+    {
+        const auto it = find_aux(x);
+
+        if (it == end())
+        {
+            return it;
+        }
+
+        return LookupPolicy::on_hit(begin(), it);
+    }
+
     template <typename... Args>
     std::pair<iterator, bool> emplace_aux(Args&&... args)
     {
         const auto it1 = emplace_back(std::forward<Args>(args)...);
-        const auto it2 = find(it1->first);
+        const auto it2 = find_aux(it1->first);
 
         const bool is_unique = it1 == it2;
 
@@ -1233,57 +1248,63 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, typename T, std::size_t N, typename E>
+template <typename K, typename T, std::size_t N, typename E, typename P>
 SFL_NODISCARD
 bool operator==
 (
-    const static_unordered_flat_map<K, T, N, E>& x,
-    const static_unordered_flat_map<K, T, N, E>& y
+    const static_unordered_flat_map<K, T, N, E, P>& x,
+    const static_unordered_flat_map<K, T, N, E, P>& y
 )
 {
     return x.size() == y.size() && std::is_permutation(x.begin(), x.end(), y.begin());
 }
 
-template <typename K, typename T, std::size_t N, typename E>
+template <typename K, typename T, std::size_t N, typename E, typename P>
 SFL_NODISCARD
 bool operator!=
 (
-    const static_unordered_flat_map<K, T, N, E>& x,
-    const static_unordered_flat_map<K, T, N, E>& y
+    const static_unordered_flat_map<K, T, N, E, P>& x,
+    const static_unordered_flat_map<K, T, N, E, P>& y
 )
 {
     return !(x == y);
 }
 
-template <typename K, typename T, std::size_t N, typename E>
+template <typename K, typename T, std::size_t N, typename E, typename P>
 void swap
 (
-    static_unordered_flat_map<K, T, N, E>& x,
-    static_unordered_flat_map<K, T, N, E>& y
+    static_unordered_flat_map<K, T, N, E, P>& x,
+    static_unordered_flat_map<K, T, N, E, P>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, typename T, std::size_t N, typename E, typename Predicate>
-typename static_unordered_flat_map<K, T, N, E>::size_type
-    erase_if(static_unordered_flat_map<K, T, N, E>& c, Predicate pred)
+template <typename K, typename T, std::size_t N, typename E, typename P, typename Predicate>
+typename static_unordered_flat_map<K, T, N, E, P>::size_type
+    erase_if(static_unordered_flat_map<K, T, N, E, P>& c, Predicate pred)
 {
-    auto old_size = c.size();
-
-    for (auto it = c.begin(); it != c.end(); )
+    auto first = c.data();
+    auto last = first + c.size();
+    auto it = first;
+    while (it != last)
     {
         if (pred(*it))
         {
-            it = c.erase(it);
+            --last;
+            if (it != last)
+            {
+                *it = std::move(*last);
+            }
         }
         else
         {
             ++it;
         }
     }
-
-    return old_size - c.size();
+    auto r = std::distance(last, first + c.size());
+    c.erase(c.begin() + std::distance(first, last), c.end());
+    return r;
 }
 
 } // namespace sfl
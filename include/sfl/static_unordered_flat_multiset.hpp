@@ -26,6 +26,7 @@
 #include <sfl/detail/ignore_unused.hpp>
 #include <sfl/detail/initialized_memory_algorithms.hpp>
 #include <sfl/detail/normal_iterator.hpp>
+#include <sfl/detail/simd_find.hpp>
 #include <sfl/detail/tags.hpp>
 #include <sfl/detail/type_traits.hpp>
 #include <sfl/detail/uninitialized_memory_algorithms.hpp>
@@ -131,6 +132,8 @@ private:
 
     data data_;
 
+    using simd_search = sfl::dtl::is_simd_searchable<Key, KeyEqual>;
+
 public:
 
     //
@@ -640,29 +643,13 @@ public:
     SFL_NODISCARD
     iterator find(const Key& key)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return begin() + find_index(key);
     }
 
     SFL_NODISCARD
     const_iterator find(const Key& key) const
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return begin() + find_index(key);
     }
 
     template <typename K,
@@ -700,17 +687,7 @@ public:
     SFL_NODISCARD
     size_type count(const Key& key) const
     {
-        size_type n = 0;
-
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                ++n;
-            }
-        }
-
-        return n;
+        return count_aux(key, simd_search());
     }
 
     template <typename K,
@@ -763,6 +740,64 @@ public:
 
 private:
 
+    size_type find_index(const Key& key) const
+    {
+        return find_index(key, simd_search());
+    }
+
+    size_type find_index(const Key& key, std::true_type) const
+    {
+        const value_type* const first = data();
+        return sfl::dtl::simd_find(first, first + size(), key) - first;
+    }
+
+    size_type find_index(const Key& key, std::false_type) const
+    {
+        for (auto it = begin(); it != end(); ++it)
+        {
+            if (data_.ref_to_equal()(*it, key))
+            {
+                return std::distance(begin(), it);
+            }
+        }
+
+        return size();
+    }
+
+    size_type count_aux(const Key& key, std::true_type) const
+    {
+        const value_type* const last = data() + size();
+
+        size_type n = 0;
+
+        for
+        (
+            const value_type* p = sfl::dtl::simd_find(data(), last, key);
+            p != last;
+            p = sfl::dtl::simd_find(p + 1, last, key)
+        )
+        {
+            ++n;
+        }
+
+        return n;
+    }
+
+    size_type count_aux(const Key& key, std::false_type) const
+    {
+        size_type n = 0;
+
+        for (auto it = begin(); it != end(); ++it)
+        {
+            if (data_.ref_to_equal()(*it, key))
+            {
+                ++n;
+            }
+        }
+
+        return n;
+    }
+
     template <typename InputIt, typename Sentinel>
     void initialize_range(InputIt first, Sentinel last)
     {
@@ -917,21 +952,27 @@ template <typename K, std::size_t N, typename E, typename Predicate>
 typename static_unordered_flat_multiset<K, N, E>::size_type
     erase_if(static_unordered_flat_multiset<K, N, E>& c, Predicate pred)
 {
-    auto old_size = c.size();
-
-    for (auto it = c.begin(); it != c.end(); )
+    auto first = c.data();
+    auto last = first + c.size();
+    auto it = first;
+    while (it != last)
     {
         if (pred(*it))
         {
-            it = c.erase(it);
+            --last;
+            if (it != last)
+            {
+                *it = std::move(*last);
+            }
         }
         else
         {
             ++it;
         }
     }
-
-    return old_size - c.size();
+    auto r = std::distance(last, first + c.size());
+    c.erase(c.begin() + std::distance(first, last), c.end());
+    return r;
 }
 
 } // namespace sfl
@@ -0,0 +1,829 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_STATIC_UNORDERED_MAP_HPP_INCLUDED
+#define SFL_STATIC_UNORDERED_MAP_HPP_INCLUDED
+
+#include <sfl/detail/container_compatible_range.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/functional.hpp>
+#include <sfl/detail/hash_table.hpp>
+#include <sfl/detail/ignore_unused.hpp>
+#include <sfl/detail/tags.hpp>
+#include <sfl/detail/type_traits.hpp>
+
+#include <algorithm>        // all_of
+#include <cstddef>          // size_t
+#include <functional>       // equal_to, hash
+#include <initializer_list> // initializer_list
+#include <tuple>            // forward_as_tuple
+#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <utility>          // forward, move, pair, piecewise_construct
+
+namespace sfl
+{
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename Hash = std::hash<Key>,
+           typename KeyEqual = std::equal_to<Key> >
+class static_unordered_map
+{
+    static_assert(N > 0, "N must be greater than zero.");
+
+public:
+
+    using key_type       = Key;
+    using mapped_type    = T;
+    using value_type     = std::pair<const Key, T>;
+    using hasher         = Hash;
+    using key_equal      = KeyEqual;
+
+private:
+
+    using table_type = sfl::dtl::hash_table
+    <
+        key_type,
+        value_type,
+        sfl::dtl::first,
+        hasher,
+        key_equal,
+        void,
+        N,
+        static_unordered_map
+    >;
+
+    table_type table_;
+
+public:
+
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = typename table_type::iterator;
+    using const_iterator  = typename table_type::const_iterator;
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+private:
+
+    // Heterogeneous lookup is enabled only if both `Hash` and `KeyEqual` are
+    // transparent, so that `K` is hashed consistently with `Key`.
+    template <typename K>
+    using is_transparent = std::integral_constant
+    <
+        bool,
+        sfl::dtl::has_is_transparent<Hash, K>::value &&
+        sfl::dtl::has_is_transparent<KeyEqual, K>::value
+    >;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    static_unordered_map() noexcept
+    (
+        std::is_nothrow_default_constructible<Hash>::value &&
+        std::is_nothrow_default_constructible<KeyEqual>::value
+    )
+        : table_()
+    {}
+
+    explicit static_unordered_map(const Hash& hash, const KeyEqual& equal)
+        : table_(hash, equal, typename table_type::allocator_type())
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_unordered_map(InputIt first, InputIt last)
+        : table_()
+    {
+        insert(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_unordered_map(InputIt first, InputIt last, const Hash& hash, const KeyEqual& equal)
+        : table_(hash, equal, typename table_type::allocator_type())
+    {
+        insert(first, last);
+    }
+
+    static_unordered_map(std::initializer_list<value_type> ilist)
+        : static_unordered_map(ilist.begin(), ilist.end())
+    {}
+
+    static_unordered_map(std::initializer_list<value_type> ilist, const Hash& hash, const KeyEqual& equal)
+        : static_unordered_map(ilist.begin(), ilist.end(), hash, equal)
+    {}
+
+    static_unordered_map(const static_unordered_map& other)
+        : table_(other.table_)
+    {}
+
+    static_unordered_map(static_unordered_map&& other)
+        : table_(std::move(other.table_))
+    {}
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    static_unordered_map(sfl::from_range_t, Range&& range)
+        : table_()
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    static_unordered_map(sfl::from_range_t, Range&& range, const Hash& hash, const KeyEqual& equal)
+        : table_(hash, equal, typename table_type::allocator_type())
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    static_unordered_map(sfl::from_range_t, Range&& range)
+        : table_()
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <typename Range>
+    static_unordered_map(sfl::from_range_t, Range&& range, const Hash& hash, const KeyEqual& equal)
+        : table_(hash, equal, typename table_type::allocator_type())
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+#endif // before C++20
+
+    ~static_unordered_map()
+    {}
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    static_unordered_map& operator=(const static_unordered_map& other)
+    {
+        table_.operator=(other.table_);
+        return *this;
+    }
+
+    static_unordered_map& operator=(static_unordered_map&& other)
+    {
+        table_.operator=(std::move(other.table_));
+        return *this;
+    }
+
+    static_unordered_map& operator=(std::initializer_list<value_type> ilist)
+    {
+        SFL_ASSERT(size_type(ilist.size()) <= capacity());
+        clear();
+        insert(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- HASH POLICY -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    hasher hash_function() const
+    {
+        return table_.ref_to_hash();
+    }
+
+    SFL_NODISCARD
+    key_equal key_eq() const
+    {
+        return table_.ref_to_equal();
+    }
+
+    SFL_NODISCARD
+    size_type bucket_count() const noexcept
+    {
+        return table_.bucket_count();
+    }
+
+    SFL_NODISCARD
+    float load_factor() const noexcept
+    {
+        return bucket_count() == 0 ? 0.0f : float(size()) / float(bucket_count());
+    }
+
+    SFL_NODISCARD
+    float max_load_factor() const noexcept
+    {
+        return 0.875f;
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return table_.begin();
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return table_.begin();
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return table_.begin();
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return table_.end();
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return table_.end();
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return table_.end();
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return table_.empty();
+    }
+
+    SFL_NODISCARD
+    bool full() const noexcept
+    {
+        return size() == capacity();
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return table_.size();
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type max_size() noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type capacity() noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    size_type available() const noexcept
+    {
+        return capacity() - size();
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        table_.clear();
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return table_.emplace_unique(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return table_.emplace_unique(std::forward<Args>(args)...).first;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        SFL_ASSERT(!full());
+        return table_.insert_unique(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        SFL_ASSERT(!full());
+        return table_.insert_unique(std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        SFL_ASSERT(!full());
+        return table_.emplace_unique(std::forward<P>(value));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return table_.insert_unique(value).first;
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return table_.insert_unique(std::move(value)).first;
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P>::value>* = nullptr>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return table_.emplace_unique(std::forward<P>(value)).first;
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(InputIt first, InputIt last)
+    {
+        insert_range_aux(first, last);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert_range_aux(ilist.begin(), ilist.end());
+    }
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(Range&& range)
+    {
+        insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    void insert_range(Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_aux(begin(range), end(range));
+    }
+
+#endif // before C++20
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< is_transparent<K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, const Key& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return insert_or_assign_aux(key, std::forward<M>(obj)).first;
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, Key&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return insert_or_assign_aux(std::move(key), std::forward<M>(obj)).first;
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< is_transparent<K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj)).first;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                is_transparent<K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return try_emplace_aux(key, std::forward<Args>(args)...).first;
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return try_emplace_aux(std::move(key), std::forward<Args>(args)...).first;
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                is_transparent<K>::value
+              >* = nullptr>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        sfl::dtl::ignore_unused(hint);
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
+    }
+
+    iterator erase(iterator pos)
+    {
+        return table_.erase(pos);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return table_.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return table_.erase(first, last);
+    }
+
+    size_type erase(const Key& key)
+    {
+        return table_.erase_key(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    size_type erase(K&& x)
+    {
+        return table_.erase_key(x);
+    }
+
+    void swap(static_unordered_map& other)
+    {
+        table_.swap(other.table_);
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return table_.find(key);
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return table_.find(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator find(const K& x)
+    {
+        return table_.find(x);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator find(const K& x) const
+    {
+        return table_.find(x);
+    }
+
+    SFL_NODISCARD
+    size_type count(const Key& key) const
+    {
+        return table_.count(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    size_type count(const K& x) const
+    {
+        return table_.count(x);
+    }
+
+    SFL_NODISCARD
+    bool contains(const Key& key) const
+    {
+        return table_.contains(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    bool contains(const K& x) const
+    {
+        return table_.contains(x);
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    T& at(const Key& key)
+    {
+        auto it = find(key);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_unordered_map::at");
+        }
+
+        return it->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& at(const K& x)
+    {
+        auto it = find(x);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_unordered_map::at");
+        }
+
+        return it->second;
+    }
+
+    SFL_NODISCARD
+    const T& at(const Key& key) const
+    {
+        auto it = find(key);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_unordered_map::at");
+        }
+
+        return it->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    const T& at(const K& x) const
+    {
+        auto it = find(x);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_unordered_map::at");
+        }
+
+        return it->second;
+    }
+
+    SFL_NODISCARD
+    T& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    SFL_NODISCARD
+    T& operator[](Key&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent<K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& operator[](K&& key)
+    {
+        return try_emplace(std::forward<K>(key)).first->second;
+    }
+
+private:
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(InputIt first, Sentinel last)
+    {
+        while (first != last)
+        {
+            insert(*first);
+            ++first;
+        }
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign_aux(K&& key, M&& obj)
+    {
+        // Arguments are used only if new element is constructed.
+        auto res = table_.emplace_with_key
+        (
+            key,
+            std::piecewise_construct,
+            std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<M>(obj))
+        );
+
+        if (!res.second)
+        {
+            res.first->second = std::forward<M>(obj);
+        }
+
+        return res;
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_aux(K&& key, Args&&... args)
+    {
+        return table_.emplace_with_key
+        (
+            key,
+            std::piecewise_construct,
+            std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...)
+        );
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename K, typename T, std::size_t N, typename H, typename E>
+SFL_NODISCARD
+bool operator==
+(
+    const static_unordered_map<K, T, N, H, E>& x,
+    const static_unordered_map<K, T, N, H, E>& y
+)
+{
+    using value_type = typename static_unordered_map<K, T, N, H, E>::value_type;
+
+    return x.size() == y.size() && std::all_of
+    (
+        x.begin(),
+        x.end(),
+        [&y](const value_type& value)
+        {
+            const auto it = y.find(value.first);
+            return it != y.end() && *it == value;
+        }
+    );
+}
+
+template <typename K, typename T, std::size_t N, typename H, typename E>
+SFL_NODISCARD
+bool operator!=
+(
+    const static_unordered_map<K, T, N, H, E>& x,
+    const static_unordered_map<K, T, N, H, E>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename K, typename T, std::size_t N, typename H, typename E>
+void swap
+(
+    static_unordered_map<K, T, N, H, E>& x,
+    static_unordered_map<K, T, N, H, E>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename K, typename T, std::size_t N, typename H, typename E, typename Predicate>
+typename static_unordered_map<K, T, N, H, E>::size_type
+    erase_if(static_unordered_map<K, T, N, H, E>& c, Predicate pred)
+{
+    auto old_size = c.size();
+
+    for (auto it = c.begin(); it != c.end(); )
+    {
+        if (pred(*it))
+        {
+            it = c.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return old_size - c.size();
+}
+
+} // namespace sfl
+
+#endif // SFL_STATIC_UNORDERED_MAP_HPP_INCLUDED
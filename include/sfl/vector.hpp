@@ -473,13 +473,18 @@ public:
 
         if (new_cap > capacity())
         {
+            if (expand_storage(new_cap) || reallocate_storage(new_cap))
+            {
+                return;
+            }
+
             pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -499,7 +504,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -525,13 +530,18 @@ public:
 
         if (new_cap < capacity())
         {
+            if (new_cap != 0 && (expand_storage(new_cap) || reallocate_storage(new_cap)))
+            {
+                return;
+            }
+
             pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -551,7 +561,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -687,6 +697,21 @@ public:
 
                 ++data_.last_;
             }
+            else if (sfl::is_trivially_relocatable<value_type>::value)
+            {
+                // Construct new element at the end and relocate it
+                // to its position.
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.last_,
+                    std::forward<Args>(args)...
+                );
+
+                ++data_.last_;
+
+                sfl::dtl::trivially_rotate_right_by_one(p1, data_.last_);
+            }
             else
             {
                 // This container can contain duplicates so we must
@@ -724,6 +749,11 @@ public:
 
             const size_type new_cap = calculate_new_capacity(1, "sfl::vector::emplace");
 
+            if (expand_storage(new_cap))
+            {
+                return emplace(pos, std::forward<Args>(args)...);
+            }
+
             pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
@@ -741,7 +771,7 @@ public:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -751,7 +781,7 @@ public:
 
                 ++new_last;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -789,7 +819,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -894,6 +924,11 @@ public:
         {
             const size_type new_cap = calculate_new_capacity(1, "sfl::vector::emplace_back");
 
+            if (expand_storage(new_cap))
+            {
+                return emplace_back(std::forward<Args>(args)...);
+            }
+
             pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
@@ -911,7 +946,7 @@ public:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -946,7 +981,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1011,9 +1046,18 @@ public:
 
         const pointer p = data_.first_ + std::distance(cbegin(), pos);
 
-        data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
+        if (sfl::is_trivially_relocatable<value_type>::value)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), p);
 
-        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+            data_.last_ = sfl::dtl::trivially_relocate(p + 1, data_.last_, p);
+        }
+        else
+        {
+            data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
+
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+        }
 
         return iterator(p);
     }
@@ -1030,11 +1074,20 @@ public:
         const pointer p1 = data_.first_ + std::distance(cbegin(), first);
         const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
-        const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
+        if (sfl::is_trivially_relocatable<value_type>::value)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), p1, p2);
+
+            data_.last_ = sfl::dtl::trivially_relocate(p2, data_.last_, p1);
+        }
+        else
+        {
+            const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
 
-        sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
 
-        data_.last_ = new_last;
+            data_.last_ = new_last;
+        }
 
         return iterator(p1);
     }
@@ -1081,7 +1134,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1122,7 +1175,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1195,7 +1248,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1236,7 +1289,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1307,6 +1360,56 @@ private:
         }
     }
 
+    //
+    // Tries to resize storage to `new_cap` elements in place, i.e. without
+    // moving elements. Returns true on success.
+    //
+    bool expand_storage(size_type new_cap)
+    {
+        if
+        (
+            sfl::dtl::try_expand
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                capacity(),
+                new_cap
+            )
+        )
+        {
+            data_.eos_ = data_.first_ + new_cap;
+            return true;
+        }
+        return false;
+    }
+
+    //
+    // Tries to resize storage to `new_cap` elements by allocator's member
+    // function `reallocate`. Storage can be moved to a new location, but only
+    // if elements are trivially relocatable. Returns true on success.
+    //
+    bool reallocate_storage(size_type new_cap)
+    {
+        const size_type size = this->size();
+
+        const pointer new_first = sfl::dtl::try_reallocate
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            capacity(),
+            new_cap
+        );
+
+        if (new_first != nullptr)
+        {
+            data_.first_ = new_first;
+            data_.last_  = new_first + size;
+            data_.eos_   = new_first + new_cap;
+            return true;
+        }
+        return false;
+    }
+
     size_type calculate_new_capacity(size_type num_additional_elements, const char* msg)
     {
         const size_type size = this->size();
@@ -1797,7 +1900,31 @@ private:
             const pointer p1 = data_.first_ + std::distance(cbegin(), pos);
             const pointer p2 = p1 + n;
 
-            if (p2 <= data_.last_)
+            if (sfl::is_trivially_relocatable<value_type>::value)
+            {
+                const pointer old_last = data_.last_;
+
+                sfl::dtl::trivially_relocate(p1, old_last, p2);
+
+                SFL_TRY
+                {
+                    sfl::dtl::uninitialized_fill_a
+                    (
+                        data_.ref_to_alloc(),
+                        p1,
+                        p2,
+                        tmp
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::trivially_relocate(p2, old_last + n, p1);
+                    SFL_RETHROW;
+                }
+
+                data_.last_ = old_last + n;
+            }
+            else if (p2 <= data_.last_)
             {
                 const pointer p3 = data_.last_ - n;
 
@@ -1863,6 +1990,11 @@ private:
 
             const size_type new_cap = calculate_new_capacity(n, "sfl::vector::insert_fill_n");
 
+            if (expand_storage(new_cap))
+            {
+                return insert_fill_n(pos, n, value);
+            }
+
             pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
@@ -1885,7 +2017,7 @@ private:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1895,7 +2027,7 @@ private:
 
                 new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -1934,7 +2066,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1992,7 +2124,31 @@ private:
             const pointer p1 = data_.first_ + std::distance(cbegin(), pos);
             const pointer p2 = p1 + n;
 
-            if (p2 <= data_.last_)
+            if (sfl::is_trivially_relocatable<value_type>::value)
+            {
+                const pointer old_last = data_.last_;
+
+                sfl::dtl::trivially_relocate(p1, old_last, p2);
+
+                SFL_TRY
+                {
+                    sfl::dtl::uninitialized_copy_a
+                    (
+                        data_.ref_to_alloc(),
+                        first,
+                        last,
+                        p1
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::trivially_relocate(p2, old_last + n, p1);
+                    SFL_RETHROW;
+                }
+
+                data_.last_ = old_last + n;
+            }
+            else if (p2 <= data_.last_)
             {
                 const pointer p3 = data_.last_ - n;
 
@@ -2058,6 +2214,11 @@ private:
 
             const size_type new_cap = calculate_new_capacity(n, "sfl::vector::insert_range");
 
+            if (expand_storage(new_cap))
+            {
+                return insert_range(pos, first, last, std::forward_iterator_tag());
+            }
+
             pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
@@ -2066,23 +2227,30 @@ private:
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                // Elements are relocated after all new elements are
+                // constructed. Relocation cannot be undone.
+
+                sfl::dtl::uninitialized_copy_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.first_ + offset,
-                    new_first
+                    first,
+                    last,
+                    p
                 );
 
-                new_last = sfl::dtl::uninitialized_copy_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    first,
-                    last,
-                    new_last
+                    data_.first_,
+                    data_.first_ + offset,
+                    new_first
                 );
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last += n;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -2092,12 +2260,24 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::destroy_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_last
-                );
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        p,
+                        n
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
 
                 sfl::dtl::deallocate
                 (
@@ -2109,7 +2289,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
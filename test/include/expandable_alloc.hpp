@@ -0,0 +1,244 @@
+#ifndef SFL_TEST_EXPANDABLE_ALLOC_HPP
+#define SFL_TEST_EXPANDABLE_ALLOC_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+namespace sfl
+{
+namespace test
+{
+
+template<typename T>
+class expandable_alloc
+{
+public:
+
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using reference       = T&;
+    using const_reference = const T&;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = expandable_alloc<U>;
+    };
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    expandable_alloc() noexcept
+    {}
+
+    expandable_alloc(const expandable_alloc& /*other*/) noexcept
+    {}
+
+    template <typename U>
+    expandable_alloc(const expandable_alloc<U>& /*other*/) noexcept
+    {}
+
+    expandable_alloc(expandable_alloc&& /*other*/) noexcept
+    {}
+
+    template <typename U>
+    expandable_alloc(expandable_alloc<U>&& /*other*/) noexcept
+    {}
+
+    ~expandable_alloc() noexcept
+    {}
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    expandable_alloc& operator=(const expandable_alloc& /*other*/) noexcept
+    {
+        return *this;
+    }
+
+    expandable_alloc& operator=(expandable_alloc&& /*other*/) noexcept
+    {
+        return *this;
+    }
+
+    //
+    // ---- ALLOCATE AND DEALLOACTE -------------------------------------------
+    //
+
+    T* allocate(size_type n, const void* = nullptr)
+    {
+        if (n > max_size())
+        {
+            #ifdef SFL_NO_EXCEPTIONS
+            assert(!"n > max_size()");
+            std::abort();
+            #else
+            throw std::bad_alloc();
+            #endif
+        }
+
+        return resize_block(nullptr, n);
+    }
+
+    void deallocate(T* p, size_type)
+    {
+        std::free(header(p));
+    }
+
+    //
+    // ---- RESIZE ------------------------------------------------------------
+    //
+
+    // Storage can be resized in place within the reserved space (four times
+    // the number of requested elements).
+    bool try_expand(T* p, size_type /*n*/, size_type new_n) noexcept
+    {
+        return new_n <= *header(p);
+    }
+
+    T* reallocate(T* p, size_type /*n*/, size_type new_n)
+    {
+        if (new_n > max_size())
+        {
+            #ifdef SFL_NO_EXCEPTIONS
+            assert(!"new_n > max_size()");
+            std::abort();
+            #else
+            throw std::bad_alloc();
+            #endif
+        }
+
+        return resize_block(p, new_n);
+    }
+
+private:
+
+    static constexpr std::size_t header_size = sizeof(std::max_align_t);
+
+    static std::size_t* header(T* p) noexcept
+    {
+        return reinterpret_cast<std::size_t*>(reinterpret_cast<char*>(p) - header_size);
+    }
+
+    static T* resize_block(T* p, size_type n)
+    {
+        const size_type reserved = n * 4;
+
+        void* block = std::realloc
+        (
+            p == nullptr ? nullptr : header(p),
+            header_size + reserved * sizeof(T)
+        );
+
+        if (block == nullptr)
+        {
+            #ifdef SFL_NO_EXCEPTIONS
+            assert(!"std::realloc failed");
+            std::abort();
+            #else
+            throw std::bad_alloc();
+            #endif
+        }
+
+        *static_cast<std::size_t*>(block) = reserved;
+
+        return reinterpret_cast<T*>(static_cast<char*>(block) + header_size);
+    }
+
+public:
+
+    //
+    // ---- CONSTRUCT AND DESTROY ---------------------------------------------
+    //
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) noexcept(
+        std::is_nothrow_constructible<U, Args...>::value
+    )
+    {
+        ::new ((void *)p) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U* p) noexcept(std::is_nothrow_destructible<U>::value)
+    {
+        p->~U();
+    }
+
+    //
+    // ---- ADDRESS -----------------------------------------------------------
+    //
+
+    pointer address(reference x) const noexcept
+    {
+        return std::addressof(x);
+    }
+
+    const_pointer address(const_reference x) const noexcept
+    {
+        return std::addressof(x);
+    }
+
+    //
+    // ---- MAX SIZE ----------------------------------------------------------
+    //
+
+    size_type max_size() const noexcept
+    {
+        return std::size_t(PTRDIFF_MAX) / sizeof(T) / 4;
+    }
+
+    //
+    // ---- COMPARISONS -------------------------------------------------------
+    //
+
+    template <typename T1, typename T2>
+    friend bool operator==
+    (
+        const expandable_alloc<T1>& /*x*/,
+        const expandable_alloc<T2>& /*y*/
+    ) noexcept;
+
+    template <typename T1, typename T2>
+    friend bool operator!=
+    (
+        const expandable_alloc<T1>& /*x*/,
+        const expandable_alloc<T2>& /*y*/
+    ) noexcept;
+};
+
+template <typename T1, typename T2>
+bool operator==
+(
+    const expandable_alloc<T1>& /*x*/,
+    const expandable_alloc<T2>& /*y*/
+) noexcept
+{
+    return true;
+}
+
+template <typename T1, typename T2>
+bool operator!=
+(
+    const expandable_alloc<T1>& /*x*/,
+    const expandable_alloc<T2>& /*y*/
+) noexcept
+{
+    return false;
+}
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_EXPANDABLE_ALLOC_HPP
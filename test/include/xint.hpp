@@ -3,6 +3,9 @@
 
 #include "print.hpp"
 
+#include <cstddef>
+#include <functional>
+
 #define SFL_TEST_XINT_DEFAULT_VALUE 789456123
 
 namespace sfl
@@ -106,6 +109,21 @@ public:
     {
         return *x.value_ < y;
     }
+
+    struct hash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(const xint& x) const
+        {
+            return std::hash<int>()(*x.value_);
+        }
+
+        std::size_t operator()(int x) const
+        {
+            return std::hash<int>()(x);
+        }
+    };
 };
 
 int xint::counter_ = 0;
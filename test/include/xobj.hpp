@@ -1,6 +1,9 @@
 #ifndef SFL_TEST_XOBJ_HPP
 #define SFL_TEST_XOBJ_HPP
 
+#include <cstddef>
+#include <functional>
+
 namespace sfl
 {
 namespace test
@@ -94,6 +97,21 @@ public:
             return a == b.value();
         }
     };
+
+    struct hash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(const xobj& x) const
+        {
+            return std::hash<int>()(x.value());
+        }
+
+        std::size_t operator()(int x) const
+        {
+            return std::hash<int>()(x);
+        }
+    };
 };
 
 } // namespace test
@@ -0,0 +1,109 @@
+#ifndef SFL_TEST_XRINT_HPP
+#define SFL_TEST_XRINT_HPP
+
+#include "print.hpp"
+
+#include "sfl/detail/type_traits.hpp"
+
+#include <cstdlib>
+#include <type_traits>
+
+namespace sfl
+{
+namespace test
+{
+
+//
+// Same as xint, but declared as trivially relocatable.
+//
+class xrint
+{
+private:
+
+    static int counter_;
+    int* value_;
+
+public:
+
+    xrint(int value) noexcept
+    {
+        ++counter_;
+        value_ = new int(value);
+        PRINT("  ++ xrint::xrint(int) [value = " << *value_ << "]");
+    }
+
+    xrint(const xrint& other) noexcept
+    {
+        ++counter_;
+        value_ = new int(*other.value_);
+        PRINT("  ++ xrint::xrint(const xrint&) [value = " << *value_ << "]");
+    }
+
+    xrint(xrint&& other) noexcept
+    {
+        ++counter_;
+        value_ = new int(*other.value_);
+        *other.value_ = -*other.value_;
+        PRINT("  ++ xrint::xrint(xrint&&) [value = " << *value_ << "]");
+    }
+
+    xrint& operator=(const xrint& other) noexcept
+    {
+        *value_ = *other.value_;
+        PRINT("  ++ xrint::operator=(const xrint&) [value = " << *value_ << "]");
+        return *this;
+    }
+
+    xrint& operator=(xrint&& other) noexcept
+    {
+        *value_ = *other.value_;
+        *other.value_ = -*other.value_;
+        PRINT("  ++ xrint::operator=(xrint&&) [value = " << *value_ << "]");
+        return *this;
+    }
+
+    ~xrint()
+    {
+        PRINT("  ++ xrint::~xrint() [value = " << *value_ << "]");
+        delete value_;
+
+        --counter_;
+
+        if (counter_ < 0)
+        {
+            PRINT("ERROR: xrint::~xrint(): counter = " << counter_ << " < 0.");
+            std::abort();
+        }
+    }
+
+    static int counter() noexcept
+    {
+        return counter_;
+    }
+
+    friend bool operator==(const xrint& x, const xrint& y)
+    {
+        return *x.value_ == *y.value_;
+    }
+
+    friend bool operator==(int x, const xrint& y)
+    {
+        return x == *y.value_;
+    }
+
+    friend bool operator==(const xrint& x, int y)
+    {
+        return *x.value_ == y;
+    }
+};
+
+int xrint::counter_ = 0;
+
+} // namespace test
+
+template <>
+struct is_trivially_relocatable<sfl::test::xrint> : std::true_type {};
+
+} // namespace sfl
+
+#endif // SFL_TEST_XRINT_HPP
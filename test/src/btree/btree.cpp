@@ -0,0 +1,84 @@
+//
+// g++ -std=c++11 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include btree.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#define SFL_TEST_BTREE
+#include "sfl/detail/btree.hpp"
+
+#include "sfl/detail/functional.hpp"
+
+#include "check.hpp"
+#include "nth.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+#include "stateless_fancy_alloc.hpp"
+#include "partially_propagable_alloc.hpp"
+
+#include <vector>
+
+template <>
+void test_btree<1>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<2>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<3>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<4>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<5>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<6>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::partially_propagable_alloc
+    #include "btree.inc"
+}
+
+int main()
+{
+    test_btree<1>();
+    test_btree<2>();
+    test_btree<3>();
+    test_btree<4>();
+    test_btree<5>();
+    test_btree<6>();
+}
@@ -0,0 +1,70 @@
+//
+// g++ -std=c++11 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include btree_map.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/btree_map.hpp"
+#include "sfl/btree_multimap.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "nth.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+#include "stateless_fancy_alloc.hpp"
+
+#include <sstream>
+#include <vector>
+
+void test_btree_map_1()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "btree_map.inc"
+}
+
+void test_btree_map_2()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "btree_map.inc"
+}
+
+void test_btree_map_3()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "btree_map.inc"
+}
+
+void test_btree_map_4()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "btree_map.inc"
+}
+
+void test_btree_map_5()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "btree_map.inc"
+}
+
+int main()
+{
+    test_btree_map_1();
+    test_btree_map_2();
+    test_btree_map_3();
+    test_btree_map_4();
+    test_btree_map_5();
+}
@@ -13,7 +13,9 @@
 #include "print.hpp"
 
 #include "xint.hpp"
+#include "xrint.hpp"
 
+#include "expandable_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
@@ -66,6 +68,13 @@ void test_compact_vector_5()
     #include "compact_vector.inc"
 }
 
+void test_compact_vector_6()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::expandable_alloc
+    #include "compact_vector.inc"
+}
+
 int main()
 {
     test_compact_vector_1();
@@ -73,4 +82,5 @@ int main()
     test_compact_vector_3();
     test_compact_vector_4();
     test_compact_vector_5();
+    test_compact_vector_6();
 }
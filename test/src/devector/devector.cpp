@@ -14,6 +14,7 @@
 #include "print.hpp"
 
 #include "xint.hpp"
+#include "xrint.hpp"
 
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
@@ -25,6 +25,14 @@
 
 #include <vector>
 
+// Fancy pointer used in tests just wraps raw pointer, so tree nodes can store
+// color in the parent pointer.
+namespace sfl
+{
+template <typename T>
+struct pointer_has_spare_low_bits<sfl::test::fancy_ptr<T>> : std::true_type {};
+} // namespace sfl
+
 template <>
 void test_rb_tree<1>()
 {
@@ -0,0 +1,70 @@
+//
+// g++ -std=c++11 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include small_btree_multimap.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/small_btree_multimap.hpp"
+#include "sfl/small_btree_map.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "nth.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+#include "stateless_fancy_alloc.hpp"
+
+#include <sstream>
+#include <vector>
+
+void test_small_btree_multimap_1()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "small_btree_multimap.inc"
+}
+
+void test_small_btree_multimap_2()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "small_btree_multimap.inc"
+}
+
+void test_small_btree_multimap_3()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "small_btree_multimap.inc"
+}
+
+void test_small_btree_multimap_4()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "small_btree_multimap.inc"
+}
+
+void test_small_btree_multimap_5()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "small_btree_multimap.inc"
+}
+
+int main()
+{
+    test_small_btree_multimap_1();
+    test_small_btree_multimap_2();
+    test_small_btree_multimap_3();
+    test_small_btree_multimap_4();
+    test_small_btree_multimap_5();
+}
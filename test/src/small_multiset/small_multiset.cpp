@@ -6,6 +6,7 @@
 #undef NDEBUG // This is very important. Must be in the first line.
 
 #include "sfl/small_multiset.hpp"
+#include "sfl/small_set.hpp"
 
 #include "check.hpp"
 #include "istream_view.hpp"
@@ -23,6 +23,7 @@
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
 
+#include <cstdint>
 #include <sstream>
 #include <vector>
 
@@ -0,0 +1,1566 @@
+//
+// g++ -std=c++11 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include static_btree_set.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/static_btree_set.hpp"
+#include "sfl/static_btree_multiset.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "nth.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xint_xint.hpp"
+#include "xobj.hpp"
+
+#include <sstream>
+#include <vector>
+
+#if !defined(SFL_NO_EXCEPTIONS)
+
+namespace
+{
+
+// Copy and move constructors throw while `throws` is true.
+struct throwing_int
+{
+    static bool throws;
+
+    int value;
+
+    throwing_int(int v) noexcept
+        : value(v)
+    {}
+
+    throwing_int(const throwing_int& other)
+        : value(other.value)
+    {
+        if (throws)
+        {
+            throw 1;
+        }
+    }
+
+    throwing_int(throwing_int&& other)
+        : value(other.value)
+    {
+        if (throws)
+        {
+            throw 1;
+        }
+    }
+
+    throwing_int& operator=(const throwing_int& other) = default;
+
+    friend bool operator<(const throwing_int& x, const throwing_int& y) noexcept
+    {
+        return x.value < y.value;
+    }
+};
+
+bool throwing_int::throws = false;
+
+} // namespace
+
+#endif
+
+void test_static_btree_set()
+{
+    using sfl::test::xint;
+    using sfl::test::xint_xint;
+    using sfl::test::xobj;
+
+    PRINT("Test static_capacity");
+    {
+        CHECK((sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>>::static_capacity == 32));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test container()");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.empty() == true);
+        CHECK(set.full() == false);
+        CHECK(set.size() == 0);
+        CHECK(set.max_size() == 32);
+        CHECK(set.capacity() == 32);
+        CHECK(set.available() == 32);
+    }
+
+    PRINT("Test container(const Compare&)");
+    {
+        std::less<xint_xint> comp;
+
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set(comp);
+
+        CHECK(set.empty() == true);
+        CHECK(set.full() == false);
+        CHECK(set.size() == 0);
+        CHECK(set.max_size() == 32);
+        CHECK(set.capacity() == 32);
+        CHECK(set.available() == 32);
+    }
+
+    PRINT("Test container(InputIt, InputIt)");
+    {
+        std::vector<xint_xint> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1},
+                {20, 2},
+                {20, 3}
+            }
+        );
+
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set(data.begin(), data.end());
+
+        CHECK(set.empty() == false);
+        CHECK(set.full() == false);
+        CHECK(set.size() == 3);
+        CHECK(set.max_size() == 32);
+        CHECK(set.capacity() == 32);
+        CHECK(set.available() == 29);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+    }
+
+    PRINT("Test container(InputIt, InputIt, const Compare&)");
+    {
+        std::vector<xint_xint> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1},
+                {20, 2},
+                {20, 3}
+            }
+        );
+
+        std::less<xint_xint> comp;
+
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set(data.begin(), data.end(), comp);
+
+        CHECK(set.empty() == false);
+        CHECK(set.full() == false);
+        CHECK(set.size() == 3);
+        CHECK(set.max_size() == 32);
+        CHECK(set.capacity() == 32);
+        CHECK(set.available() == 29);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+    }
+
+    PRINT("Test container(std::initializer_list)");
+    {
+        std::initializer_list<xint_xint> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1},
+            {20, 2},
+            {20, 3}
+        };
+
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set(ilist);
+
+        CHECK(set.empty() == false);
+        CHECK(set.full() == false);
+        CHECK(set.size() == 3);
+        CHECK(set.max_size() == 32);
+        CHECK(set.capacity() == 32);
+        CHECK(set.available() == 29);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+    }
+
+    PRINT("Test container(std::initializer_list, const Compare&)");
+    {
+        std::initializer_list<xint_xint> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1},
+            {20, 2},
+            {20, 3}
+        };
+
+        std::less<xint_xint> comp;
+
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set(ilist, comp);
+
+        CHECK(set.empty() == false);
+        CHECK(set.full() == false);
+        CHECK(set.size() == 3);
+        CHECK(set.max_size() == 32);
+        CHECK(set.capacity() == 32);
+        CHECK(set.available() == 29);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+    }
+
+    PRINT("Test container(const container&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set2(set1);
+
+        CHECK(set2.size() == 3);
+        CHECK(NTH(set2, 0)->first == 10); CHECK(NTH(set2, 0)->second == 1);
+        CHECK(NTH(set2, 1)->first == 20); CHECK(NTH(set2, 1)->second == 1);
+        CHECK(NTH(set2, 2)->first == 30); CHECK(NTH(set2, 2)->second == 1);
+
+        CHECK(set2.max_size() == 32);
+        CHECK(set2.capacity() == 32);
+        CHECK(set2.available() == 29);
+    }
+
+    PRINT("Test container(container&&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set2(std::move(set1));
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == -10); CHECK(NTH(set1, 0)->second == -1);
+        CHECK(NTH(set1, 1)->first == -20); CHECK(NTH(set1, 1)->second == -1);
+        CHECK(NTH(set1, 2)->first == -30); CHECK(NTH(set1, 2)->second == -1);
+
+        CHECK(set2.size() == 3);
+        CHECK(NTH(set2, 0)->first == 10); CHECK(NTH(set2, 0)->second == 1);
+        CHECK(NTH(set2, 1)->first == 20); CHECK(NTH(set2, 1)->second == 1);
+        CHECK(NTH(set2, 2)->first == 30); CHECK(NTH(set2, 2)->second == 1);
+
+        CHECK(set2.max_size() == 32);
+        CHECK(set2.capacity() == 32);
+        CHECK(set2.available() == 29);
+    }
+
+    PRINT("Test container(sfl::from_range_t, Range&&)");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 20 30 20 20");
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_btree_set<xint, 32, std::less<xint>> set
+            (
+                (sfl::from_range_t()),
+                (std::views::istream<int>(iss))
+            );
+            #else
+            sfl::static_btree_set<xint, 32, std::less<xint>> set
+            (
+                (sfl::from_range_t()),
+                (sfl::test::istream_view<int>(iss))
+            );
+            #endif
+
+            CHECK(set.empty() == false);
+            CHECK(set.size() == 3);
+            CHECK(set.max_size() > 0);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+
+        // Forward iterator
+        {
+            std::vector<xint> data({10, 20, 30, 20, 20});
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_btree_set<xint, 32, std::less<xint>> set
+            (
+                sfl::from_range_t(),
+                std::views::all(data)
+            );
+            #else
+            sfl::static_btree_set<xint, 32, std::less<xint>> set
+            (
+                sfl::from_range_t(),
+                data
+            );
+            #endif
+
+            CHECK(set.empty() == false);
+            CHECK(set.size() == 3);
+            CHECK(set.max_size() > 0);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+    }
+
+    PRINT("Test container(sfl::from_range_t, Range&&, const Compare&)");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 20 30 20 20");
+
+            std::less<xint> comp;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_btree_set<xint, 32, std::less<xint>> set
+            (
+                (sfl::from_range_t()),
+                (std::views::istream<int>(iss)),
+                comp
+            );
+            #else
+            sfl::static_btree_set<xint, 32, std::less<xint>> set
+            (
+                (sfl::from_range_t()),
+                (sfl::test::istream_view<int>(iss)),
+                comp
+            );
+            #endif
+
+            CHECK(set.empty() == false);
+            CHECK(set.size() == 3);
+            CHECK(set.max_size() > 0);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+
+        // Forward iterator
+        {
+            std::vector<xint> data({10, 20, 30, 20, 20});
+
+            std::less<xint> comp;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_btree_set<xint, 32, std::less<xint>> set
+            (
+                sfl::from_range_t(),
+                std::views::all(data),
+                comp
+            );
+            #else
+            sfl::static_btree_set<xint, 32, std::less<xint>> set
+            (
+                sfl::from_range_t(),
+                data,
+                comp
+            );
+            #endif
+
+            CHECK(set.empty() == false);
+            CHECK(set.size() == 3);
+            CHECK(set.max_size() > 0);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test operator=(const container&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1, set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+
+        set2.emplace(40, 2);
+        set2.emplace(50, 2);
+        set2.emplace(60, 2);
+
+        CHECK(set2.size() == 3);
+        CHECK(NTH(set2, 0)->first == 40); CHECK(NTH(set2, 0)->second == 2);
+        CHECK(NTH(set2, 1)->first == 50); CHECK(NTH(set2, 1)->second == 2);
+        CHECK(NTH(set2, 2)->first == 60); CHECK(NTH(set2, 2)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        set2 = set1;
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+
+        CHECK(set2.size() == 3);
+        CHECK(NTH(set2, 0)->first == 10); CHECK(NTH(set2, 0)->second == 1);
+        CHECK(NTH(set2, 1)->first == 20); CHECK(NTH(set2, 1)->second == 1);
+        CHECK(NTH(set2, 2)->first == 30); CHECK(NTH(set2, 2)->second == 1);
+    }
+
+    PRINT("Test operator=(container&&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1, set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+
+        set2.emplace(40, 2);
+        set2.emplace(50, 2);
+        set2.emplace(60, 2);
+
+        CHECK(set2.size() == 3);
+        CHECK(NTH(set2, 0)->first == 40); CHECK(NTH(set2, 0)->second == 2);
+        CHECK(NTH(set2, 1)->first == 50); CHECK(NTH(set2, 1)->second == 2);
+        CHECK(NTH(set2, 2)->first == 60); CHECK(NTH(set2, 2)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        set2 = std::move(set1);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == -10); CHECK(NTH(set1, 0)->second == -1);
+        CHECK(NTH(set1, 1)->first == -20); CHECK(NTH(set1, 1)->second == -1);
+        CHECK(NTH(set1, 2)->first == -30); CHECK(NTH(set1, 2)->second == -1);
+
+        CHECK(set2.size() == 3);
+        CHECK(NTH(set2, 0)->first == 10); CHECK(NTH(set2, 0)->second == 1);
+        CHECK(NTH(set2, 1)->first == 20); CHECK(NTH(set2, 1)->second == 1);
+        CHECK(NTH(set2, 2)->first == 30); CHECK(NTH(set2, 2)->second == 1);
+    }
+
+    PRINT("Test operator=(std::initializer_list)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        CHECK(set.size() == 3);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        std::initializer_list<xint_xint> ilist
+        {
+            {40, 2},
+            {50, 2},
+            {60, 2},
+            {50, 3},
+            {50, 4}
+        };
+
+        set = ilist;
+
+        CHECK(set.size() == 3);
+        CHECK(NTH(set, 0)->first == 40); CHECK(NTH(set, 0)->second == 2);
+        CHECK(NTH(set, 1)->first == 50); CHECK(NTH(set, 1)->second == 2);
+        CHECK(NTH(set, 2)->first == 60); CHECK(NTH(set, 2)->second == 2);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test key_comp()");
+    {
+        {
+            sfl::static_btree_set<xint, 32, std::less<xint>> set;
+
+            auto key_comp = set.key_comp();
+
+            CHECK(key_comp(10, 10) == false);
+            CHECK(key_comp(10, 20) == true);
+            CHECK(key_comp(20, 10) == false);
+            CHECK(key_comp(20, 20) == false);
+        }
+
+        {
+            sfl::static_btree_set<xobj, 32, xobj::less> set;
+
+            auto key_comp = set.key_comp();
+
+            CHECK(key_comp(xobj(10), 10) == false);
+            CHECK(key_comp(xobj(10), 20) == true);
+            CHECK(key_comp(xobj(20), 10) == false);
+            CHECK(key_comp(xobj(20), 20) == false);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test value_comp()");
+    {
+        {
+            sfl::static_btree_set<xint, 32, std::less<xint>> set;
+
+            auto value_comp = set.value_comp();
+
+            CHECK(value_comp(10, 10) == false);
+            CHECK(value_comp(10, 20) == true);
+            CHECK(value_comp(20, 10) == false);
+            CHECK(value_comp(20, 20) == false);
+        }
+
+        {
+            sfl::static_btree_set<xobj, 32, xobj::less> set;
+
+            auto value_comp = set.value_comp();
+
+            CHECK(value_comp(xobj(10), 10) == false);
+            CHECK(value_comp(xobj(10), 20) == true);
+            CHECK(value_comp(xobj(20), 10) == false);
+            CHECK(value_comp(xobj(20), 20) == false);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test begin, end, cbegin, cend, rbegin, rend, crbegin, crend");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(20, 1);
+        set.emplace(40, 1);
+        set.emplace(60, 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        auto it = set.begin();
+        CHECK(it->first == 20); CHECK(it->second == 1); ++it;
+        CHECK(it->first == 40); CHECK(it->second == 1); ++it;
+        CHECK(it->first == 60); CHECK(it->second == 1); ++it;
+        CHECK(it == set.end());
+
+        ///////////////////////////////////////////////////////////////////////
+
+        auto cit = set.cbegin();
+        CHECK(cit->first == 20); CHECK(cit->second == 1); ++cit;
+        CHECK(cit->first == 40); CHECK(cit->second == 1); ++cit;
+        CHECK(cit->first == 60); CHECK(cit->second == 1); ++cit;
+        CHECK(cit == set.cend());
+
+        ///////////////////////////////////////////////////////////////////////
+
+        auto rit = set.rbegin();
+        CHECK(rit->first == 60); CHECK(rit->second == 1); ++rit;
+        CHECK(rit->first == 40); CHECK(rit->second == 1); ++rit;
+        CHECK(rit->first == 20); CHECK(rit->second == 1); ++rit;
+        CHECK(rit == set.rend());
+
+        ///////////////////////////////////////////////////////////////////////
+
+        auto crit = set.crbegin();
+        CHECK(crit->first == 60); CHECK(crit->second == 1); ++crit;
+        CHECK(crit->first == 40); CHECK(crit->second == 1); ++crit;
+        CHECK(crit->first == 20); CHECK(crit->second == 1); ++crit;
+        CHECK(crit == set.crend());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test lower_bound, upper_bound, equal_range, find, count, contains");
+    {
+        // xint
+        {
+            sfl::static_btree_set<xint, 32, std::less<xint> > set;
+
+            set.emplace(20);
+            set.emplace(40);
+            set.emplace(60);
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.lower_bound(10) == NTH(set, 0));
+            CHECK(set.lower_bound(20) == NTH(set, 0));
+            CHECK(set.lower_bound(30) == NTH(set, 1));
+            CHECK(set.lower_bound(40) == NTH(set, 1));
+            CHECK(set.lower_bound(50) == NTH(set, 2));
+            CHECK(set.lower_bound(60) == NTH(set, 2));
+            CHECK(set.lower_bound(70) == NTH(set, 3));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.upper_bound(10) == NTH(set, 0));
+            CHECK(set.upper_bound(20) == NTH(set, 1));
+            CHECK(set.upper_bound(30) == NTH(set, 1));
+            CHECK(set.upper_bound(40) == NTH(set, 2));
+            CHECK(set.upper_bound(50) == NTH(set, 2));
+            CHECK(set.upper_bound(60) == NTH(set, 3));
+            CHECK(set.upper_bound(70) == NTH(set, 3));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.equal_range(10) == std::make_pair(NTH(set, 0), NTH(set, 0)));
+            CHECK(set.equal_range(20) == std::make_pair(NTH(set, 0), NTH(set, 1)));
+            CHECK(set.equal_range(30) == std::make_pair(NTH(set, 1), NTH(set, 1)));
+            CHECK(set.equal_range(40) == std::make_pair(NTH(set, 1), NTH(set, 2)));
+            CHECK(set.equal_range(50) == std::make_pair(NTH(set, 2), NTH(set, 2)));
+            CHECK(set.equal_range(60) == std::make_pair(NTH(set, 2), NTH(set, 3)));
+            CHECK(set.equal_range(70) == std::make_pair(NTH(set, 3), NTH(set, 3)));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.find(10) == set.end());
+            CHECK(set.find(20) == NTH(set, 0));
+            CHECK(set.find(30) == set.end());
+            CHECK(set.find(40) == NTH(set, 1));
+            CHECK(set.find(50) == set.end());
+            CHECK(set.find(60) == NTH(set, 2));
+            CHECK(set.find(70) == set.end());
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.count(10) == 0);
+            CHECK(set.count(20) == 1);
+            CHECK(set.count(30) == 0);
+            CHECK(set.count(40) == 1);
+            CHECK(set.count(50) == 0);
+            CHECK(set.count(60) == 1);
+            CHECK(set.count(70) == 0);
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.contains(10) == false);
+            CHECK(set.contains(20) == true);
+            CHECK(set.contains(30) == false);
+            CHECK(set.contains(40) == true);
+            CHECK(set.contains(50) == false);
+            CHECK(set.contains(60) == true);
+            CHECK(set.contains(70) == false);
+        }
+
+        // xobj
+        {
+            sfl::static_btree_set<xobj, 32, xobj::less > set;
+
+            set.emplace(20);
+            set.emplace(40);
+            set.emplace(60);
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.lower_bound(10) == NTH(set, 0));
+            CHECK(set.lower_bound(20) == NTH(set, 0));
+            CHECK(set.lower_bound(30) == NTH(set, 1));
+            CHECK(set.lower_bound(40) == NTH(set, 1));
+            CHECK(set.lower_bound(50) == NTH(set, 2));
+            CHECK(set.lower_bound(60) == NTH(set, 2));
+            CHECK(set.lower_bound(70) == NTH(set, 3));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.upper_bound(10) == NTH(set, 0));
+            CHECK(set.upper_bound(20) == NTH(set, 1));
+            CHECK(set.upper_bound(30) == NTH(set, 1));
+            CHECK(set.upper_bound(40) == NTH(set, 2));
+            CHECK(set.upper_bound(50) == NTH(set, 2));
+            CHECK(set.upper_bound(60) == NTH(set, 3));
+            CHECK(set.upper_bound(70) == NTH(set, 3));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.equal_range(10) == std::make_pair(NTH(set, 0), NTH(set, 0)));
+            CHECK(set.equal_range(20) == std::make_pair(NTH(set, 0), NTH(set, 1)));
+            CHECK(set.equal_range(30) == std::make_pair(NTH(set, 1), NTH(set, 1)));
+            CHECK(set.equal_range(40) == std::make_pair(NTH(set, 1), NTH(set, 2)));
+            CHECK(set.equal_range(50) == std::make_pair(NTH(set, 2), NTH(set, 2)));
+            CHECK(set.equal_range(60) == std::make_pair(NTH(set, 2), NTH(set, 3)));
+            CHECK(set.equal_range(70) == std::make_pair(NTH(set, 3), NTH(set, 3)));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.find(10) == set.end());
+            CHECK(set.find(20) == NTH(set, 0));
+            CHECK(set.find(30) == set.end());
+            CHECK(set.find(40) == NTH(set, 1));
+            CHECK(set.find(50) == set.end());
+            CHECK(set.find(60) == NTH(set, 2));
+            CHECK(set.find(70) == set.end());
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.count(10) == 0);
+            CHECK(set.count(20) == 1);
+            CHECK(set.count(30) == 0);
+            CHECK(set.count(40) == 1);
+            CHECK(set.count(50) == 0);
+            CHECK(set.count(60) == 1);
+            CHECK(set.count(70) == 0);
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(set.contains(10) == false);
+            CHECK(set.contains(20) == true);
+            CHECK(set.contains(30) == false);
+            CHECK(set.contains(40) == true);
+            CHECK(set.contains(50) == false);
+            CHECK(set.contains(60) == true);
+            CHECK(set.contains(70) == false);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test emplace(Args&&...)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.size() == 0);
+
+        {
+            const auto res = set.emplace(10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(set.size() == 1);
+        }
+
+        {
+            const auto res = set.emplace(10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(set.size() == 1);
+        }
+    }
+
+    PRINT("Test emplace_hint(const_iterator, Args&&...)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.size() == 0);
+
+        {
+            const auto res = set.emplace_hint(set.begin(), 10, 1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(set.size() == 1);
+        }
+
+        {
+            const auto res = set.emplace_hint(set.begin(), 10, 2);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(set.size() == 1);
+        }
+    }
+
+    PRINT("Test insert(const value_type&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.size() == 0);
+
+        using value_type = xint_xint;
+
+        {
+            const value_type value_10_1(10, 1);
+
+            const auto res = set.insert(value_10_1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(set.size() == 1);
+        }
+
+        {
+            const value_type value_10_2(10, 2);
+
+            const auto res = set.insert(value_10_2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(set.size() == 1);
+        }
+    }
+
+    PRINT("Test insert(value_type&&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.size() == 0);
+
+        using value_type = xint_xint;
+
+        {
+            value_type value_10_1(10, 1);
+
+            const auto res = set.insert(std::move(value_10_1));
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(set.size() == 1);
+
+            CHECK(value_10_1.first  == -10);
+            CHECK(value_10_1.second == -1);
+        }
+
+        {
+            value_type value_10_2(10, 2);
+
+            const auto res = set.insert(std::move(value_10_2));
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(set.size() == 1);
+
+            CHECK(value_10_2.first  == +10);
+            CHECK(value_10_2.second == +2);
+        }
+    }
+
+    PRINT("Test insert(const_iterator, const value_type&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.size() == 0);
+
+        using value_type = xint_xint;
+
+        {
+            const value_type value_10_1(10, 1);
+
+            const auto res = set.insert(set.begin(), value_10_1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(set.size() == 1);
+        }
+
+        {
+            const value_type value_10_2(10, 2);
+
+            const auto res = set.insert(set.begin(), value_10_2);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(set.size() == 1);
+        }
+    }
+
+    PRINT("Test insert(const_iterator, value_type&&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.size() == 0);
+
+        using value_type = xint_xint;
+
+        {
+            value_type value_10_1(10, 1);
+
+            const auto res = set.insert(set.begin(), std::move(value_10_1));
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(set.size() == 1);
+
+            CHECK(value_10_1.first  == -10);
+            CHECK(value_10_1.second == -1);
+        }
+
+        {
+            value_type value_10_2(10, 2);
+
+            const auto res = set.insert(set.begin(), std::move(value_10_2));
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(set.size() == 1);
+
+            CHECK(value_10_2.first  == +10);
+            CHECK(value_10_2.second == +2);
+        }
+    }
+
+    PRINT("Test insert(InputIt, InputIt");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.size() == 0);
+
+        std::vector<xint_xint> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1},
+                {20, 2},
+                {20, 3}
+            }
+        );
+
+        set.insert(data.begin(), data.end());
+
+        CHECK(set.size() == 3);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+    }
+
+    PRINT("Test insert(std::initializer_list");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        CHECK(set.size() == 0);
+
+        std::initializer_list<xint_xint> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1},
+            {20, 2},
+            {20, 3}
+        };
+
+        set.insert(ilist);
+
+        CHECK(set.size() == 3);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+    }
+
+    PRINT("Test insert_range(Range&&");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 20 30 20 20");
+
+            sfl::static_btree_set<xint, 32, std::less<xint>> set;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            set.insert_range(std::views::istream<int>(iss));
+            #else
+            set.insert_range(sfl::test::istream_view<int>(iss));
+            #endif
+
+            CHECK(set.size() == 3);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+
+        // Forward iterator
+        {
+            std::vector<xint> data({10, 20, 30, 20, 20});
+
+            sfl::static_btree_set<xint, 32, std::less<xint>> set;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            set.insert_range(std::views::all(data));
+            #else
+            set.insert_range(data);
+            #endif
+
+            CHECK(set.size() == 3);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+    }
+
+    PRINT("Test erase(const_iterator)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        CHECK(set.size() == 3);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+
+        {
+            const auto res = set.erase(set.begin());
+
+            CHECK(res == set.begin());
+            CHECK(set.size() == 2);
+            CHECK(NTH(set, 0)->first == 20); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+        }
+
+        {
+            const auto res = set.erase(set.begin());
+
+            CHECK(res == set.begin());
+            CHECK(set.size() == 1);
+            CHECK(NTH(set, 0)->first == 30); CHECK(NTH(set, 0)->second == 1);
+        }
+
+        {
+            const auto res = set.erase(set.begin());
+
+            CHECK(res == set.end());
+            CHECK(set.size() == 0);
+        }
+    }
+
+    PRINT("Test erase(const_iterator, const_iterator)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        CHECK(set.size() == 3);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+
+        const auto res = set.erase(NTH(set, 1), NTH(set, 2));
+
+        CHECK(res == NTH(set, 1));
+        CHECK(set.size() == 2);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 0)->second == 1);
+    }
+
+    PRINT("Test erase(const Key&)");
+    {
+        sfl::static_btree_set<xint, 32, std::less<xint>> set;
+
+        set.emplace(10);
+        set.emplace(20);
+        set.emplace(30);
+
+        CHECK(set.size() == 3);
+        CHECK(*NTH(set, 0) == 10);
+        CHECK(*NTH(set, 1) == 20);
+        CHECK(*NTH(set, 2) == 30);
+
+        CHECK(set.erase(30) == 1);
+        CHECK(set.erase(30) == 0);
+        CHECK(set.size() == 2);
+        CHECK(*NTH(set, 0) == 10);
+        CHECK(*NTH(set, 1) == 20);
+
+        CHECK(set.erase(20) == 1);
+        CHECK(set.erase(20) == 0);
+        CHECK(set.size() == 1);
+        CHECK(*NTH(set, 0) == 10);
+
+        CHECK(set.erase(10) == 1);
+        CHECK(set.erase(10) == 0);
+        CHECK(set.size() == 0);
+    }
+
+    PRINT("Test erase(K&&)");
+    {
+        sfl::static_btree_set<xobj, 32, xobj::less> set;
+
+        set.emplace(10);
+        set.emplace(20);
+        set.emplace(30);
+
+        CHECK(set.size() == 3);
+        CHECK(NTH(set, 0)->value() == 10);
+        CHECK(NTH(set, 1)->value() == 20);
+        CHECK(NTH(set, 2)->value() == 30);
+
+        CHECK(set.erase(30) == 1);
+        CHECK(set.erase(30) == 0);
+        CHECK(set.size() == 2);
+        CHECK(NTH(set, 0)->value() == 10);
+        CHECK(NTH(set, 1)->value() == 20);
+
+        CHECK(set.erase(20) == 1);
+        CHECK(set.erase(20) == 0);
+        CHECK(set.size() == 1);
+        CHECK(NTH(set, 0)->value() == 10);
+
+        CHECK(set.erase(10) == 1);
+        CHECK(set.erase(10) == 0);
+        CHECK(set.size() == 0);
+    }
+
+    #if !defined(SFL_NO_EXCEPTIONS)
+    PRINT("Test erase(const_iterator) with throwing copy and move constructors");
+    {
+        // Erasing must not leave underfull nodes when rebalancing throws,
+        // otherwise the pool runs out of nodes before the set is full.
+
+        sfl::static_btree_set<throwing_int, 1020> set;
+
+        for (int i = 0; i < 1020; ++i)
+        {
+            set.emplace(i);
+        }
+
+        CHECK(set.full() == true);
+
+        std::size_t size = set.size();
+        int num_erased = 0;
+        int num_thrown = 0;
+
+        throwing_int::throws = true;
+
+        for (int i = 0; i < 1020; ++i)
+        {
+            if (i % 51 != 0)
+            {
+                bool thrown = false;
+
+                try
+                {
+                    set.erase(set.find(i));
+                }
+                catch (...)
+                {
+                    thrown = true;
+                }
+
+                if (thrown)
+                {
+                    ++num_thrown;
+                    CHECK(set.size() == size);
+                    CHECK(set.contains(i) == true);
+                }
+                else
+                {
+                    ++num_erased;
+                    --size;
+                    CHECK(set.size() == size);
+                    CHECK(set.contains(i) == false);
+                }
+            }
+        }
+
+        throwing_int::throws = false;
+
+        for (int i = 2000; !set.full(); ++i)
+        {
+            set.emplace(i);
+        }
+
+        CHECK(set.size() == 1020);
+
+        int prev = -1;
+
+        for (const auto& x : set)
+        {
+            CHECK(prev < x.value);
+            prev = x.value;
+        }
+
+        CHECK(num_erased > 0);
+        CHECK(num_thrown > 0);
+    }
+    #endif
+
+    PRINT("Test swap(container&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1, set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        set2.emplace(40, 2);
+        set2.emplace(50, 2);
+        set2.emplace(60, 2);
+        set2.emplace(70, 2);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+
+        CHECK(set2.size() == 4);
+        CHECK(NTH(set2, 0)->first == 40); CHECK(NTH(set2, 0)->second == 2);
+        CHECK(NTH(set2, 1)->first == 50); CHECK(NTH(set2, 1)->second == 2);
+        CHECK(NTH(set2, 2)->first == 60); CHECK(NTH(set2, 2)->second == 2);
+        CHECK(NTH(set2, 3)->first == 70); CHECK(NTH(set2, 3)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        set1.swap(set2);
+
+        CHECK(set1.size() == 4);
+        CHECK(NTH(set1, 0)->first == 40); CHECK(NTH(set1, 0)->second == 2);
+        CHECK(NTH(set1, 1)->first == 50); CHECK(NTH(set1, 1)->second == 2);
+        CHECK(NTH(set1, 2)->first == 60); CHECK(NTH(set1, 2)->second == 2);
+        CHECK(NTH(set1, 3)->first == 70); CHECK(NTH(set1, 3)->second == 2);
+
+        CHECK(set2.size() == 3);
+        CHECK(NTH(set2, 0)->first == 10); CHECK(NTH(set2, 0)->second == 1);
+        CHECK(NTH(set2, 1)->first == 20); CHECK(NTH(set2, 1)->second == 1);
+        CHECK(NTH(set2, 2)->first == 30); CHECK(NTH(set2, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        set1.swap(set2);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+
+        CHECK(set2.size() == 4);
+        CHECK(NTH(set2, 0)->first == 40); CHECK(NTH(set2, 0)->second == 2);
+        CHECK(NTH(set2, 1)->first == 50); CHECK(NTH(set2, 1)->second == 2);
+        CHECK(NTH(set2, 2)->first == 60); CHECK(NTH(set2, 2)->second == 2);
+        CHECK(NTH(set2, 3)->first == 70); CHECK(NTH(set2, 3)->second == 2);
+    }
+
+    PRINT("Test extract(const_iterator), insert(node_type&&), insert(const_iterator, node_type&&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        auto nh = set.extract(NTH(set, 1));
+
+        CHECK(!nh.empty());
+        CHECK(nh.value().first == 20); CHECK(nh.value().second == 1);
+        CHECK(set.size() == 2);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+
+        nh.value().first = 40;
+        nh.value().second = 2;
+
+        {
+            auto res = set.insert(std::move(nh));
+
+            CHECK(res.inserted == true);
+            CHECK(res.position == NTH(set, 2));
+            CHECK(res.node.empty());
+            CHECK(nh.empty());
+            CHECK(set.size() == 3);
+            CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+            CHECK(NTH(set, 2)->first == 40); CHECK(NTH(set, 2)->second == 2);
+        }
+
+        nh = set.extract(NTH(set, 0));
+        nh.value().first = 30;
+
+        {
+            auto res = set.insert(std::move(nh));
+
+            CHECK(res.inserted == false);
+            CHECK(res.position == NTH(set, 0));
+            CHECK(!res.node.empty());
+            CHECK(res.node.value().first == 30); CHECK(res.node.value().second == 1);
+            CHECK(set.size() == 2);
+
+            const auto it1 = set.insert(set.end(), std::move(res.node));
+
+            CHECK(it1 == NTH(set, 0));
+            CHECK(!res.node.empty());
+            CHECK(set.size() == 2);
+
+            res.node.value().first = 5;
+
+            const auto it2 = set.insert(set.end(), std::move(res.node));
+
+            CHECK(it2 == NTH(set, 0));
+            CHECK(res.node.empty());
+            CHECK(set.size() == 3);
+            CHECK(NTH(set, 0)->first ==  5); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+            CHECK(NTH(set, 2)->first == 40); CHECK(NTH(set, 2)->second == 2);
+        }
+
+        {
+            auto res = set.insert(std::move(nh));
+
+            CHECK(res.inserted == false);
+            CHECK(res.position == set.end());
+            CHECK(res.node.empty());
+            CHECK(set.size() == 3);
+        }
+    }
+
+    PRINT("Test extract(const Key&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        {
+            const auto nh = set.extract(xint_xint(20, 0));
+
+            CHECK(!nh.empty());
+            CHECK(nh.value().first == 20); CHECK(nh.value().second == 1);
+            CHECK(set.size() == 2);
+            CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+        }
+
+        {
+            const auto nh = set.extract(xint_xint(20, 0));
+
+            CHECK(nh.empty());
+            CHECK(set.size() == 2);
+        }
+    }
+
+    PRINT("Test extract(K&&)");
+    {
+        sfl::static_btree_set<xobj, 32, xobj::less> set;
+
+        set.emplace(10);
+        set.emplace(20);
+        set.emplace(30);
+
+        {
+            const auto nh = set.extract(20);
+
+            CHECK(!nh.empty());
+            CHECK(nh.value().value() == 20);
+            CHECK(set.size() == 2);
+            CHECK(NTH(set, 0)->value() == 10);
+            CHECK(NTH(set, 1)->value() == 30);
+        }
+
+        {
+            const auto nh = set.extract(20);
+
+            CHECK(nh.empty());
+            CHECK(set.size() == 2);
+        }
+    }
+
+    PRINT("Test merge(container&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1, set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        set2.emplace(20, 2);
+        set2.emplace(40, 2);
+        set2.emplace(50, 2);
+
+        set1.merge(set2);
+
+        CHECK(set1.size() == 5);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+        CHECK(NTH(set1, 3)->first == 40); CHECK(NTH(set1, 3)->second == 2);
+        CHECK(NTH(set1, 4)->first == 50); CHECK(NTH(set1, 4)->second == 2);
+
+        CHECK(set2.size() == 1);
+        CHECK(NTH(set2, 0)->first == 20); CHECK(NTH(set2, 0)->second == 2);
+
+        set1.merge(std::move(set2));
+
+        CHECK(set1.size() == 5);
+        CHECK(set2.size() == 1);
+
+        set1.merge(set1);
+
+        CHECK(set1.size() == 5);
+    }
+
+    PRINT("Test merge(multi_container&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1;
+        sfl::static_btree_multiset<xint_xint, 32, std::less<xint_xint>> set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+
+        set2.emplace(10, 2);
+        set2.emplace(30, 2);
+        set2.emplace(30, 3);
+
+        set1.merge(set2);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 2);
+
+        CHECK(set2.size() == 2);
+        CHECK(NTH(set2, 0)->first == 10); CHECK(NTH(set2, 0)->second == 2);
+        CHECK(NTH(set2, 1)->first == 30); CHECK(NTH(set2, 1)->second == 3);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test NON-MEMBER comparison operators");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1, set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        set2.emplace(10, 1);
+        set2.emplace(20, 1);
+        set2.emplace(30, 1);
+        set2.emplace(40, 1);
+        set2.emplace(50, 1);
+
+        CHECK((set1 == set1) == true);
+        CHECK((set1 == set2) == false);
+        CHECK((set2 == set1) == false);
+        CHECK((set2 == set2) == true);
+
+        CHECK((set1 != set1) == false);
+        CHECK((set1 != set2) == true);
+        CHECK((set2 != set1) == true);
+        CHECK((set2 != set2) == false);
+
+        CHECK((set1 < set1) == false);
+        CHECK((set1 < set2) == true);
+        CHECK((set2 < set1) == false);
+        CHECK((set2 < set2) == false);
+
+        CHECK((set1 > set1) == false);
+        CHECK((set1 > set2) == false);
+        CHECK((set2 > set1) == true);
+        CHECK((set2 > set2) == false);
+
+        CHECK((set1 <= set1) == true);
+        CHECK((set1 <= set2) == true);
+        CHECK((set2 <= set1) == false);
+        CHECK((set2 <= set2) == true);
+
+        CHECK((set1 >= set1) == true);
+        CHECK((set1 >= set2) == false);
+        CHECK((set2 >= set1) == true);
+        CHECK((set2 >= set2) == true);
+    }
+
+    PRINT("Test NON-MEMBER swap(container&)");
+    {
+        sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>> set1, set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        set2.emplace(40, 2);
+        set2.emplace(50, 2);
+        set2.emplace(60, 2);
+        set2.emplace(70, 2);
+        set2.emplace(80, 2);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+
+        CHECK(set2.size() == 5);
+        CHECK(NTH(set2, 0)->first == 40); CHECK(NTH(set2, 0)->second == 2);
+        CHECK(NTH(set2, 1)->first == 50); CHECK(NTH(set2, 1)->second == 2);
+        CHECK(NTH(set2, 2)->first == 60); CHECK(NTH(set2, 2)->second == 2);
+        CHECK(NTH(set2, 3)->first == 70); CHECK(NTH(set2, 3)->second == 2);
+        CHECK(NTH(set2, 4)->first == 80); CHECK(NTH(set2, 4)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        swap(set1, set2);
+
+        CHECK(set1.size() == 5);
+        CHECK(NTH(set1, 0)->first == 40); CHECK(NTH(set1, 0)->second == 2);
+        CHECK(NTH(set1, 1)->first == 50); CHECK(NTH(set1, 1)->second == 2);
+        CHECK(NTH(set1, 2)->first == 60); CHECK(NTH(set1, 2)->second == 2);
+        CHECK(NTH(set1, 3)->first == 70); CHECK(NTH(set1, 3)->second == 2);
+        CHECK(NTH(set1, 4)->first == 80); CHECK(NTH(set1, 4)->second == 2);
+
+        CHECK(set2.size() == 3);
+        CHECK(NTH(set2, 0)->first == 10); CHECK(NTH(set2, 0)->second == 1);
+        CHECK(NTH(set2, 1)->first == 20); CHECK(NTH(set2, 1)->second == 1);
+        CHECK(NTH(set2, 2)->first == 30); CHECK(NTH(set2, 2)->second == 1);
+    }
+
+    PRINT("Test NON-MEMBER erase_if(container&, Predicate)");
+    {
+        using container_type =
+            sfl::static_btree_set<xint_xint, 32, std::less<xint_xint>>;
+
+        using const_reference = typename container_type::const_reference;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        CHECK(set.size() == 3);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 20); CHECK(NTH(set, 1)->second == 1);
+        CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        CHECK(erase_if(set, [](const_reference& value){ return value.first == 20; }) == 1);
+        CHECK(set.size() == 2);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        CHECK(erase_if(set, [](const_reference& value){ return value.first == 20; }) == 0);
+        CHECK(set.size() == 2);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+    }
+}
+
+int main()
+{
+    test_static_btree_set();
+}
@@ -17,6 +17,7 @@
 #include "xint.hpp"
 #include "xobj.hpp"
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -3130,6 +3131,235 @@ void test_static_flat_multimap()
         CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
         CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 1);
     }
+
+    PRINT("Test insert(InputIt, InputIt) with unsorted input and equivalent keys");
+    {
+        {
+            sfl::static_flat_multimap<xint, xint, 20, std::less<xint>> map;
+
+            map.emplace(30, 0);
+            map.emplace(10, 0);
+
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {50, 1},
+                    {20, 1},
+                    {30, 1},
+                    {40, 1},
+                    {20, 2},
+                    {60, 1},
+                    {10, 1},
+                    {50, 2},
+                    {5, 1}
+                }
+            );
+
+            map.insert(data.begin(), data.end());
+
+            CHECK(map.size() == 11);
+            CHECK(map.nth(0)->first == 5); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 1);
+            CHECK(map.nth(2)->first == 10); CHECK(map.nth(2)->second == 0);
+            CHECK(map.nth(3)->first == 20); CHECK(map.nth(3)->second == 2);
+            CHECK(map.nth(4)->first == 20); CHECK(map.nth(4)->second == 1);
+            CHECK(map.nth(5)->first == 30); CHECK(map.nth(5)->second == 1);
+            CHECK(map.nth(6)->first == 30); CHECK(map.nth(6)->second == 0);
+            CHECK(map.nth(7)->first == 40); CHECK(map.nth(7)->second == 1);
+            CHECK(map.nth(8)->first == 50); CHECK(map.nth(8)->second == 2);
+            CHECK(map.nth(9)->first == 50); CHECK(map.nth(9)->second == 1);
+            CHECK(map.nth(10)->first == 60); CHECK(map.nth(10)->second == 1);
+        }
+
+        {
+            sfl::static_flat_multimap<xint, xint, 5, std::less<xint>> map;
+
+            map.emplace(10, 0);
+
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {20, 1},
+                    {10, 1},
+                    {30, 1},
+                    {20, 2}
+                }
+            );
+
+            map.insert(data.begin(), data.end());
+
+            CHECK(map.size() == 5);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 0);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 2);
+            CHECK(map.nth(3)->first == 20); CHECK(map.nth(3)->second == 1);
+            CHECK(map.nth(4)->first == 30); CHECK(map.nth(4)->second == 1);
+        }
+
+        {
+            sfl::static_flat_multimap<int, int, 100, std::less<int>> map1;
+            sfl::static_flat_multimap<int, int, 100, std::less<int>> map2;
+
+            std::vector<std::pair<int, int>> data;
+
+            for (int i = 0; i < 100; ++i)
+            {
+                data.emplace_back((i * 7919) % 51, i);
+            }
+
+            map1.insert(data.begin(), data.begin() + 25);
+            map1.insert(data.begin() + 25, data.end());
+
+            for (const auto& value : data)
+            {
+                map2.insert(value);
+            }
+
+            CHECK(map1 == map2);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_equivalent_t, InputIt, InputIt), insert(sfl::sorted_equivalent_t, InputIt, InputIt) and insert_range(sfl::sorted_equivalent_t, Range&&)");
+    {
+        std::vector<std::pair<xint, xint>> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {20, 2},
+                {30, 1},
+                {40, 1},
+                {50, 1}
+            }
+        );
+
+        {
+            sfl::static_flat_multimap<xint, xint, 10, std::less<xint>> map(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 6);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 2);
+            CHECK(map.nth(3)->first == 30); CHECK(map.nth(3)->second == 1);
+            CHECK(map.nth(4)->first == 40); CHECK(map.nth(4)->second == 1);
+            CHECK(map.nth(5)->first == 50); CHECK(map.nth(5)->second == 1);
+        }
+
+        {
+            sfl::static_flat_multimap<xint, xint, 10, std::less<xint>> map(sfl::sorted_equivalent_t(), {{10, 1}, {20, 1}});
+
+            CHECK(map.size() == 2);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        }
+
+        {
+            sfl::static_flat_multimap<xint, xint, 10, std::less<xint>> map;
+
+            map.emplace(20, 0);
+            map.emplace(45, 0);
+
+            map.insert(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 8);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 2);
+            CHECK(map.nth(3)->first == 20); CHECK(map.nth(3)->second == 0);
+            CHECK(map.nth(4)->first == 30); CHECK(map.nth(4)->second == 1);
+            CHECK(map.nth(5)->first == 40); CHECK(map.nth(5)->second == 1);
+            CHECK(map.nth(6)->first == 45); CHECK(map.nth(6)->second == 0);
+            CHECK(map.nth(7)->first == 50); CHECK(map.nth(7)->second == 1);
+        }
+
+        {
+            sfl::static_flat_multimap<xint, xint, 10, std::less<xint>> map;
+
+            map.emplace(20, 0);
+            map.emplace(45, 0);
+
+            map.insert_range(sfl::sorted_equivalent_t(), data);
+
+            CHECK(map.size() == 8);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 2);
+            CHECK(map.nth(3)->first == 20); CHECK(map.nth(3)->second == 0);
+            CHECK(map.nth(4)->first == 30); CHECK(map.nth(4)->second == 1);
+            CHECK(map.nth(5)->first == 40); CHECK(map.nth(5)->second == 1);
+            CHECK(map.nth(6)->first == 45); CHECK(map.nth(6)->second == 0);
+            CHECK(map.nth(7)->first == 50); CHECK(map.nth(7)->second == 1);
+        }
+
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 1 20 1 20 2 30 1 40 1 50 1");
+
+            sfl::static_flat_multimap<xint, xint, 10, std::less<xint>> map;
+
+            map.emplace(20, 0);
+            map.emplace(45, 0);
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            map.insert_range(sfl::sorted_equivalent_t(), std::views::istream<std::pair<int, int>>(iss));
+            #else
+            map.insert_range(sfl::sorted_equivalent_t(), sfl::test::istream_view<std::pair<int, int>>(iss));
+            #endif
+
+            CHECK(map.size() == 8);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 2);
+            CHECK(map.nth(3)->first == 20); CHECK(map.nth(3)->second == 0);
+            CHECK(map.nth(4)->first == 30); CHECK(map.nth(4)->second == 1);
+            CHECK(map.nth(5)->first == 40); CHECK(map.nth(5)->second == 1);
+            CHECK(map.nth(6)->first == 45); CHECK(map.nth(6)->second == 0);
+            CHECK(map.nth(7)->first == 50); CHECK(map.nth(7)->second == 1);
+        }
+    }
+
+    PRINT("Test lower_bound, upper_bound, equal_range, find with arithmetic keys and std::less (branchless search)");
+    {
+        using container_type = sfl::static_flat_multimap<int, int, 40, std::less<int>>;
+
+        using const_reference = typename container_type::const_reference;
+
+        for (int n = 0; n <= 20; ++n)
+        {
+            container_type container;
+
+            for (int i = 0; i < n; ++i)
+            {
+                container.emplace(2 * i + 10, i);
+                    container.emplace(2 * i + 10, i);
+            }
+
+            CHECK(container.size() == std::size_t(2 * n));
+
+            for (int key = 0; key <= 2 * n + 20; ++key)
+            {
+                const auto lower = std::partition_point
+                (
+                    container.begin(),
+                    container.end(),
+                    [key](const_reference value) { return value.first < key; }
+                );
+
+                const auto upper = std::partition_point
+                (
+                    container.begin(),
+                    container.end(),
+                    [key](const_reference value) { return !(key < value.first); }
+                );
+
+                CHECK(container.lower_bound(key) == lower);
+                CHECK(container.upper_bound(key) == upper);
+                CHECK(container.equal_range(key) == std::make_pair(lower, upper));
+                CHECK(container.find(key) == (lower == upper ? container.end() : lower));
+                CHECK(container.count(key) == std::size_t(std::distance(lower, upper)));
+            }
+        }
+    }
 }
 
 int main()
@@ -18,6 +18,7 @@
 #include "xint_xint.hpp"
 #include "xobj.hpp"
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -2947,6 +2948,49 @@ void test_static_flat_multiset()
         CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 1);
         CHECK(set.nth(1)->first == 30); CHECK(set.nth(1)->second == 1);
     }
+
+    PRINT("Test lower_bound, upper_bound, equal_range, find with arithmetic keys and std::less (branchless search)");
+    {
+        using container_type = sfl::static_flat_multiset<int, 40, std::less<int>>;
+
+        using const_reference = typename container_type::const_reference;
+
+        for (int n = 0; n <= 20; ++n)
+        {
+            container_type container;
+
+            for (int i = 0; i < n; ++i)
+            {
+                container.emplace(2 * i + 10);
+                    container.emplace(2 * i + 10);
+            }
+
+            CHECK(container.size() == std::size_t(2 * n));
+
+            for (int key = 0; key <= 2 * n + 20; ++key)
+            {
+                const auto lower = std::partition_point
+                (
+                    container.begin(),
+                    container.end(),
+                    [key](const_reference value) { return value < key; }
+                );
+
+                const auto upper = std::partition_point
+                (
+                    container.begin(),
+                    container.end(),
+                    [key](const_reference value) { return !(key < value); }
+                );
+
+                CHECK(container.lower_bound(key) == lower);
+                CHECK(container.upper_bound(key) == upper);
+                CHECK(container.equal_range(key) == std::make_pair(lower, upper));
+                CHECK(container.find(key) == (lower == upper ? container.end() : lower));
+                CHECK(container.count(key) == std::size_t(std::distance(lower, upper)));
+            }
+        }
+    }
 }
 
 int main()
@@ -18,6 +18,7 @@
 #include "xint_xint.hpp"
 #include "xobj.hpp"
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -2907,6 +2908,76 @@ void test_static_flat_set()
         CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 1);
         CHECK(set.nth(1)->first == 30); CHECK(set.nth(1)->second == 1);
     }
+
+    PRINT("Test extract() && and replace(container_type&&)");
+    {
+        sfl::static_flat_set<xint, 5, std::less<xint>> set;
+
+        set.emplace(20);
+        set.emplace(10);
+        set.emplace(30);
+
+        auto c = std::move(set).extract();
+
+        CHECK(set.empty());
+        CHECK(c.size() == 3);
+        CHECK(c[0] == 10);
+        CHECK(c[1] == 20);
+        CHECK(c[2] == 30);
+
+        c.emplace_back(40);
+
+        set.replace(std::move(c));
+
+        CHECK(c.empty());
+        CHECK(set.size() == 4);
+        CHECK(*set.nth(0) == 10);
+        CHECK(*set.nth(1) == 20);
+        CHECK(*set.nth(2) == 30);
+        CHECK(*set.nth(3) == 40);
+    }
+
+    PRINT("Test lower_bound, upper_bound, equal_range, find with arithmetic keys and std::less (branchless search)");
+    {
+        using container_type = sfl::static_flat_set<int, 40, std::less<int>>;
+
+        using const_reference = typename container_type::const_reference;
+
+        for (int n = 0; n <= 20; ++n)
+        {
+            container_type container;
+
+            for (int i = 0; i < n; ++i)
+            {
+                container.emplace(2 * i + 10);
+            }
+
+            CHECK(container.size() == std::size_t(1 * n));
+
+            for (int key = 0; key <= 2 * n + 20; ++key)
+            {
+                const auto lower = std::partition_point
+                (
+                    container.begin(),
+                    container.end(),
+                    [key](const_reference value) { return value < key; }
+                );
+
+                const auto upper = std::partition_point
+                (
+                    container.begin(),
+                    container.end(),
+                    [key](const_reference value) { return !(key < value); }
+                );
+
+                CHECK(container.lower_bound(key) == lower);
+                CHECK(container.upper_bound(key) == upper);
+                CHECK(container.equal_range(key) == std::make_pair(lower, upper));
+                CHECK(container.find(key) == (lower == upper ? container.end() : lower));
+                CHECK(container.count(key) == std::size_t(std::distance(lower, upper)));
+            }
+        }
+    }
 }
 
 int main()
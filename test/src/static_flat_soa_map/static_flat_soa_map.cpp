@@ -0,0 +1,957 @@
+//
+// g++ -std=c++11 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include static_flat_soa_map.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#define SFL_TEST_STATIC_FLAT_SOA_MAP
+#include "sfl/static_flat_soa_map.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "nth.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+void test_static_flat_soa_map()
+{
+    using sfl::test::xint;
+    using sfl::test::xobj;
+
+    PRINT("Test PRIVATE member function insert_exactly_at(size_type, K&&, Args&&...)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        {
+            PRINT(">");
+            const auto res = map.insert_exactly_at(0, 20, 2);
+            PRINT("<");
+
+            CHECK(res == map.nth(0));
+            CHECK(map.size() == 1);
+            CHECK(map.keys().size() == 1);
+            CHECK(map.values().size() == 1);
+            CHECK(map.nth(0)->first == 20); CHECK(map.nth(0)->second == 2);
+        }
+
+        {
+            PRINT(">");
+            const auto res = map.insert_exactly_at(0, 10, 1);
+            PRINT("<");
+
+            CHECK(res == map.nth(0));
+            CHECK(map.size() == 2);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 2);
+        }
+
+        {
+            PRINT(">");
+            const auto res = map.insert_exactly_at(2, 40, 4);
+            PRINT("<");
+
+            CHECK(res == map.nth(2));
+            CHECK(map.size() == 3);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 2);
+            CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 4);
+        }
+
+        {
+            PRINT(">");
+            const auto res = map.insert_exactly_at(2, 30, 3);
+            PRINT("<");
+
+            CHECK(res == map.nth(2));
+            CHECK(map.size() == 4);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 2);
+            CHECK(map.nth(2)->first == 30); CHECK(map.nth(2)->second == 3);
+            CHECK(map.nth(3)->first == 40); CHECK(map.nth(3)->second == 4);
+        }
+
+        CHECK(map.keys().size() == 4);
+        CHECK(map.keys()[0] == 10);
+        CHECK(map.keys()[1] == 20);
+        CHECK(map.keys()[2] == 30);
+        CHECK(map.keys()[3] == 40);
+
+        CHECK(map.values().size() == 4);
+        CHECK(map.values()[0] == 1);
+        CHECK(map.values()[1] == 2);
+        CHECK(map.values()[2] == 3);
+        CHECK(map.values()[3] == 4);
+    }
+
+    PRINT("Test PRIVATE member function is_insert_hint_good(const_iterator, const K&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.insert_exactly_at(0, 20, 1);
+        map.insert_exactly_at(1, 40, 1);
+        map.insert_exactly_at(2, 60, 1);
+
+        CHECK(map.is_insert_hint_good(map.nth(0), 10) == true);
+        CHECK(map.is_insert_hint_good(map.nth(1), 10) == false);
+        CHECK(map.is_insert_hint_good(map.nth(0), 20) == false);
+        CHECK(map.is_insert_hint_good(map.nth(1), 20) == false);
+        CHECK(map.is_insert_hint_good(map.nth(1), 30) == true);
+        CHECK(map.is_insert_hint_good(map.nth(2), 30) == false);
+        CHECK(map.is_insert_hint_good(map.nth(3), 60) == false);
+        CHECK(map.is_insert_hint_good(map.nth(3), 70) == true);
+        CHECK(map.is_insert_hint_good(map.nth(2), 70) == false);
+    }
+
+    PRINT("Test begin, end, cbegin, cend, rbegin, rend, crbegin, crend, nth, index_of");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.emplace(20, 1);
+        map.emplace(40, 2);
+        map.emplace(60, 3);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        auto it = map.begin();
+        CHECK(it->first == 20); CHECK(it->second == 1); ++it;
+        CHECK(it->first == 40); CHECK(it->second == 2); ++it;
+        CHECK(it->first == 60); CHECK(it->second == 3); ++it;
+        CHECK(it == map.end());
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        auto cit = map.cbegin();
+        CHECK(cit->first == 20); CHECK(cit->second == 1); ++cit;
+        CHECK(cit->first == 40); CHECK(cit->second == 2); ++cit;
+        CHECK(cit->first == 60); CHECK(cit->second == 3); ++cit;
+        CHECK(cit == map.cend());
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        auto rit = map.rbegin();
+        CHECK(rit->first == 60); CHECK(rit->second == 3); ++rit;
+        CHECK(rit->first == 40); CHECK(rit->second == 2); ++rit;
+        CHECK(rit->first == 20); CHECK(rit->second == 1); ++rit;
+        CHECK(rit == map.rend());
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        auto crit = map.crbegin();
+        CHECK(crit->first == 60); CHECK(crit->second == 3); ++crit;
+        CHECK(crit->first == 40); CHECK(crit->second == 2); ++crit;
+        CHECK(crit->first == 20); CHECK(crit->second == 1); ++crit;
+        CHECK(crit == map.crend());
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        CHECK(map.begin() + 3 == map.end());
+        CHECK(map.end() - map.begin() == 3);
+        CHECK(map.begin()[1].first == 40); CHECK(map.begin()[1].second == 2);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        CHECK(map.nth(0) == map.begin());
+        CHECK(map.nth(3) == map.end());
+        CHECK(map.index_of(map.nth(0)) == 0);
+        CHECK(map.index_of(map.nth(1)) == 1);
+        CHECK(map.index_of(map.nth(2)) == 2);
+        CHECK(map.index_of(map.nth(3)) == 3);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        // Mapped values are modifiable through iterator.
+        for (auto it2 = map.begin(); it2 != map.end(); ++it2)
+        {
+            it2->second = 5;
+        }
+
+        CHECK(map.values()[0] == 5);
+        CHECK(map.values()[1] == 5);
+        CHECK(map.values()[2] == 5);
+
+        for (auto elem : map)
+        {
+            elem.second = 7;
+        }
+
+        CHECK(map.values()[0] == 7);
+        CHECK(map.values()[1] == 7);
+        CHECK(map.values()[2] == 7);
+    }
+
+    PRINT("Test static_capacity, full(), capacity(), max_size(), available()");
+    {
+        CHECK((sfl::static_flat_soa_map<xint, xint, 5, std::less<xint>>::static_capacity == 5));
+
+        sfl::static_flat_soa_map<xint, xint, 3, std::less<xint>> map;
+
+        CHECK(map.capacity() == 3);
+        CHECK(map.max_size() == 3);
+        CHECK(map.available() == 3);
+        CHECK(map.full() == false);
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+
+        CHECK(map.available() == 1);
+        CHECK(map.full() == false);
+
+        map.emplace(30, 1);
+
+        CHECK(map.available() == 0);
+        CHECK(map.full() == true);
+    }
+
+    PRINT("Test key_comp() and value_comp()");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 2);
+
+        auto key_comp = map.key_comp();
+
+        CHECK(key_comp(10, 10) == false);
+        CHECK(key_comp(10, 20) == true);
+        CHECK(key_comp(20, 10) == false);
+
+        auto value_comp = map.value_comp();
+
+        CHECK(value_comp(*map.nth(0), *map.nth(0)) == false);
+        CHECK(value_comp(*map.nth(0), *map.nth(1)) == true);
+        CHECK(value_comp(*map.nth(1), *map.nth(0)) == false);
+    }
+
+    PRINT("Test lower_bound, upper_bound, equal_range, find, count, contains");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.emplace(20, 1);
+        map.emplace(40, 1);
+        map.emplace(60, 1);
+
+        CHECK(map.lower_bound(10) == map.nth(0));
+        CHECK(map.lower_bound(20) == map.nth(0));
+        CHECK(map.lower_bound(30) == map.nth(1));
+        CHECK(map.lower_bound(40) == map.nth(1));
+        CHECK(map.lower_bound(50) == map.nth(2));
+        CHECK(map.lower_bound(60) == map.nth(2));
+        CHECK(map.lower_bound(70) == map.nth(3));
+
+        CHECK(map.upper_bound(10) == map.nth(0));
+        CHECK(map.upper_bound(20) == map.nth(1));
+        CHECK(map.upper_bound(30) == map.nth(1));
+        CHECK(map.upper_bound(40) == map.nth(2));
+        CHECK(map.upper_bound(50) == map.nth(2));
+        CHECK(map.upper_bound(60) == map.nth(3));
+        CHECK(map.upper_bound(70) == map.nth(3));
+
+        CHECK(map.equal_range(10) == std::make_pair(map.nth(0), map.nth(0)));
+        CHECK(map.equal_range(20) == std::make_pair(map.nth(0), map.nth(1)));
+        CHECK(map.equal_range(30) == std::make_pair(map.nth(1), map.nth(1)));
+        CHECK(map.equal_range(60) == std::make_pair(map.nth(2), map.nth(3)));
+        CHECK(map.equal_range(70) == std::make_pair(map.nth(3), map.nth(3)));
+
+        CHECK(map.find(10) == map.end());
+        CHECK(map.find(20) == map.nth(0));
+        CHECK(map.find(30) == map.end());
+        CHECK(map.find(40) == map.nth(1));
+        CHECK(map.find(50) == map.end());
+        CHECK(map.find(60) == map.nth(2));
+        CHECK(map.find(70) == map.end());
+
+        CHECK(map.count(10) == 0);
+        CHECK(map.count(20) == 1);
+        CHECK(map.count(30) == 0);
+        CHECK(map.count(60) == 1);
+
+        CHECK(map.contains(10) == false);
+        CHECK(map.contains(20) == true);
+        CHECK(map.contains(30) == false);
+        CHECK(map.contains(60) == true);
+    }
+
+    PRINT("Test lower_bound, upper_bound, equal_range, find, count, contains (transparent)");
+    {
+        sfl::static_flat_soa_map<xobj, xint, 100, xobj::less> map;
+
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(20), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(40), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(60), std::forward_as_tuple(1));
+
+        CHECK(map.lower_bound(30) == map.nth(1));
+        CHECK(map.lower_bound(40) == map.nth(1));
+        CHECK(map.upper_bound(40) == map.nth(2));
+        CHECK(map.equal_range(40) == std::make_pair(map.nth(1), map.nth(2)));
+        CHECK(map.find(40) == map.nth(1));
+        CHECK(map.find(50) == map.end());
+        CHECK(map.count(40) == 1);
+        CHECK(map.count(50) == 0);
+        CHECK(map.contains(40) == true);
+        CHECK(map.contains(50) == false);
+    }
+
+    PRINT("Test clear()");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.size() == 3);
+
+        map.clear();
+
+        CHECK(map.empty());
+        CHECK(map.size() == 0);
+        CHECK(map.keys().size() == 0);
+        CHECK(map.values().size() == 0);
+    }
+
+    PRINT("Test emplace(Args&&...) and emplace_hint(const_iterator, Args&&...)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        CHECK(map.emplace(20, 1) == std::make_pair(map.nth(0), true));
+        CHECK(map.emplace(40, 1) == std::make_pair(map.nth(1), true));
+        CHECK(map.emplace(60, 1) == std::make_pair(map.nth(2), true));
+        CHECK(map.emplace(20, 2) == std::make_pair(map.nth(0), false));
+        CHECK(map.emplace(40, 2) == std::make_pair(map.nth(1), false));
+
+        CHECK(map.emplace_hint(map.nth(1), 30, 1) == map.nth(1));
+        CHECK(map.emplace_hint(map.begin(), 50, 1) == map.nth(3));
+        CHECK(map.emplace_hint(map.end(), 30, 2) == map.nth(1));
+
+        CHECK(map.size() == 5);
+        CHECK(map.nth(0)->first == 20); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 1);
+        CHECK(map.nth(3)->first == 50); CHECK(map.nth(3)->second == 1);
+        CHECK(map.nth(4)->first == 60); CHECK(map.nth(4)->second == 1);
+    }
+
+    PRINT("Test insert(const value_type&), insert(value_type&&), insert(P&&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        using value_type = std::pair<xint, xint>;
+
+        const value_type value_20_1(20, 1);
+        const value_type value_20_2(20, 2);
+
+        CHECK(map.insert(value_20_1) == std::make_pair(map.nth(0), true));
+        CHECK(map.insert(value_20_2) == std::make_pair(map.nth(0), false));
+
+        value_type value_40_1(40, 1);
+        value_type value_40_2(40, 2);
+
+        CHECK(map.insert(std::move(value_40_1)) == std::make_pair(map.nth(1), true));
+        CHECK(map.insert(std::move(value_40_2)) == std::make_pair(map.nth(1), false));
+
+        CHECK(value_40_1.first == -40); CHECK(value_40_1.second == -1);
+        CHECK(value_40_2.first == +40); CHECK(value_40_2.second == +2);
+
+        CHECK(map.insert(std::make_pair(30, 1)) == std::make_pair(map.nth(1), true));
+        CHECK(map.insert(std::make_pair(30, 2)) == std::make_pair(map.nth(1), false));
+
+        CHECK(map.size() == 3);
+        CHECK(map.nth(0)->first == 20); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 1);
+    }
+
+    PRINT("Test insert(const_iterator, const value_type&), insert(const_iterator, value_type&&), insert(const_iterator, P&&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        using value_type = std::pair<xint, xint>;
+
+        const value_type value_20_1(20, 1);
+        const value_type value_20_2(20, 2);
+
+        CHECK(map.insert(map.end(), value_20_1) == map.nth(0));
+        CHECK(map.insert(map.end(), value_20_2) == map.nth(0));
+
+        value_type value_40_1(40, 1);
+        value_type value_40_2(40, 2);
+
+        CHECK(map.insert(map.begin(), std::move(value_40_1)) == map.nth(1));
+        CHECK(map.insert(map.begin(), std::move(value_40_2)) == map.nth(1));
+
+        CHECK(value_40_1.first == -40); CHECK(value_40_1.second == -1);
+        CHECK(value_40_2.first == +40); CHECK(value_40_2.second == +2);
+
+        CHECK(map.insert(map.nth(1), std::make_pair(30, 1)) == map.nth(1));
+        CHECK(map.insert(map.nth(1), std::make_pair(30, 2)) == map.nth(1));
+
+        CHECK(map.size() == 3);
+        CHECK(map.nth(0)->first == 20); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 1);
+    }
+
+    PRINT("Test insert(InputIt, InputIt), insert(std::initializer_list), insert_range(Range&&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        {
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {40, 1},
+                    {20, 1},
+                    {40, 2},
+                    {10, 1}
+                }
+            );
+
+            map.insert(data.begin(), data.end());
+        }
+
+        CHECK(map.size() == 3);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 1);
+
+        map.insert({{30, 1}, {20, 2}, {50, 1}});
+
+        CHECK(map.size() == 5);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 30); CHECK(map.nth(2)->second == 1);
+        CHECK(map.nth(3)->first == 40); CHECK(map.nth(3)->second == 1);
+        CHECK(map.nth(4)->first == 50); CHECK(map.nth(4)->second == 1);
+
+        {
+            std::istringstream iss("60 1 10 2 70 1");
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            map.insert_range(std::views::istream<std::pair<int, int>>(iss));
+            #else
+            map.insert_range(sfl::test::istream_view<std::pair<int, int>>(iss));
+            #endif
+        }
+
+        CHECK(map.size() == 7);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 30); CHECK(map.nth(2)->second == 1);
+        CHECK(map.nth(3)->first == 40); CHECK(map.nth(3)->second == 1);
+        CHECK(map.nth(4)->first == 50); CHECK(map.nth(4)->second == 1);
+        CHECK(map.nth(5)->first == 60); CHECK(map.nth(5)->second == 1);
+        CHECK(map.nth(6)->first == 70); CHECK(map.nth(6)->second == 1);
+    }
+
+    PRINT("Test insert_or_assign(const Key&, M&&), insert_or_assign(Key&&, M&&), insert_or_assign(K&&, M&&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        const xint key_20(20);
+
+        CHECK(map.insert_or_assign(key_20, 1) == std::make_pair(map.nth(0), true));
+        CHECK(map.insert_or_assign(key_20, 2) == std::make_pair(map.nth(0), false));
+
+        xint key_40a(40);
+        xint key_40b(40);
+
+        CHECK(map.insert_or_assign(std::move(key_40a), 1) == std::make_pair(map.nth(1), true));
+        CHECK(map.insert_or_assign(std::move(key_40b), 2) == std::make_pair(map.nth(1), false));
+
+        CHECK(key_40a == -40);
+        CHECK(key_40b == +40);
+
+        CHECK(map.insert_or_assign(map.nth(1), 30, 1) == map.nth(1));
+        CHECK(map.insert_or_assign(map.end(), 30, 3) == map.nth(1));
+
+        CHECK(map.size() == 3);
+        CHECK(map.nth(0)->first == 20); CHECK(map.nth(0)->second == 2);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 3);
+        CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        sfl::static_flat_soa_map<xobj, xint, 100, xobj::less> map2;
+
+        CHECK(map2.insert_or_assign(20, 1) == std::make_pair(map2.nth(0), true));
+        CHECK(map2.insert_or_assign(20, 2) == std::make_pair(map2.nth(0), false));
+        CHECK(map2.insert_or_assign(map2.begin(), 10, 1) == map2.nth(0));
+
+        CHECK(map2.size() == 2);
+        CHECK(map2.nth(0)->first.value() == 10); CHECK(map2.nth(0)->second == 1);
+        CHECK(map2.nth(1)->first.value() == 20); CHECK(map2.nth(1)->second == 2);
+    }
+
+    PRINT("Test try_emplace(const Key&, Args&&...), try_emplace(Key&&, Args&&...), try_emplace(K&&, Args&&...)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        const xint key_20(20);
+
+        CHECK(map.try_emplace(key_20, 1) == std::make_pair(map.nth(0), true));
+        CHECK(map.try_emplace(key_20, 2) == std::make_pair(map.nth(0), false));
+
+        xint key_40a(40);
+        xint key_40b(40);
+
+        CHECK(map.try_emplace(std::move(key_40a), 1) == std::make_pair(map.nth(1), true));
+        CHECK(map.try_emplace(std::move(key_40b), 2) == std::make_pair(map.nth(1), false));
+
+        CHECK(key_40a == -40);
+        CHECK(key_40b == +40);
+
+        CHECK(map.try_emplace(map.nth(1), 30, 1) == map.nth(1));
+        CHECK(map.try_emplace(map.end(), 30, 3) == map.nth(1));
+
+        CHECK(map.size() == 3);
+        CHECK(map.nth(0)->first == 20); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        sfl::static_flat_soa_map<xobj, xint, 100, xobj::less> map2;
+
+        CHECK(map2.try_emplace(20, 1) == std::make_pair(map2.nth(0), true));
+        CHECK(map2.try_emplace(20, 2) == std::make_pair(map2.nth(0), false));
+        CHECK(map2.try_emplace(map2.begin(), 10, 1) == map2.nth(0));
+
+        CHECK(map2.size() == 2);
+        CHECK(map2.nth(0)->first.value() == 10); CHECK(map2.nth(0)->second == 1);
+        CHECK(map2.nth(1)->first.value() == 20); CHECK(map2.nth(1)->second == 1);
+    }
+
+    PRINT("Test erase(const_iterator), erase(const_iterator, const_iterator)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 2);
+        map.emplace(30, 3);
+        map.emplace(40, 4);
+        map.emplace(50, 5);
+
+        {
+            const auto res = map.erase(map.nth(1));
+            CHECK(res == map.nth(1));
+        }
+
+        CHECK(map.size() == 4);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 3);
+        CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 4);
+        CHECK(map.nth(3)->first == 50); CHECK(map.nth(3)->second == 5);
+
+        {
+            const auto res = map.erase(map.nth(3));
+            CHECK(res == map.end());
+        }
+
+        CHECK(map.size() == 3);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 3);
+        CHECK(map.nth(2)->first == 40); CHECK(map.nth(2)->second == 4);
+
+        {
+            const auto res = map.erase(map.nth(0), map.nth(2));
+            CHECK(res == map.nth(0));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.nth(0)->first == 40); CHECK(map.nth(0)->second == 4);
+
+        {
+            const auto res = map.erase(map.nth(0), map.nth(0));
+            CHECK(res == map.nth(0));
+        }
+        CHECK(map.size() == 1);
+
+        {
+            const auto res = map.erase(map.begin(), map.end());
+            CHECK(res == map.end());
+        }
+        CHECK(map.empty());
+        CHECK(map.keys().empty());
+        CHECK(map.values().empty());
+    }
+
+    PRINT("Test erase(const Key&), erase(K&&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 2);
+        map.emplace(30, 3);
+
+        CHECK(map.erase(20) == 1);
+        CHECK(map.erase(20) == 0);
+        CHECK(map.size() == 2);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 3);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        sfl::static_flat_soa_map<xobj, xint, 100, xobj::less> map2;
+
+        map2.try_emplace(10, 1);
+        map2.try_emplace(20, 2);
+
+        CHECK(map2.erase(10) == 1);
+        CHECK(map2.erase(10) == 0);
+        CHECK(map2.size() == 1);
+        CHECK(map2.nth(0)->first.value() == 20); CHECK(map2.nth(0)->second == 2);
+    }
+
+    PRINT("Test swap(container&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+
+        map2.emplace(40, 2);
+        map2.emplace(50, 2);
+        map2.emplace(60, 2);
+        map2.emplace(70, 2);
+
+        map1.swap(map2);
+
+        CHECK(map1.size() == 4);
+        CHECK(map1.nth(0)->first == 40); CHECK(map1.nth(0)->second == 2);
+        CHECK(map1.nth(1)->first == 50); CHECK(map1.nth(1)->second == 2);
+        CHECK(map1.nth(2)->first == 60); CHECK(map1.nth(2)->second == 2);
+        CHECK(map1.nth(3)->first == 70); CHECK(map1.nth(3)->second == 2);
+
+        CHECK(map2.size() == 2);
+        CHECK(map2.nth(0)->first == 10); CHECK(map2.nth(0)->second == 1);
+        CHECK(map2.nth(1)->first == 20); CHECK(map2.nth(1)->second == 1);
+
+        map1.swap(map1);
+
+        CHECK(map1.size() == 4);
+    }
+
+    PRINT("Test at(const Key&), at(const K&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 2);
+
+        CHECK(map.at(10) == 1);
+        CHECK(map.at(20) == 2);
+
+        map.at(20) = 3;
+
+        CHECK(map.at(20) == 3);
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            (void)map.at(30);
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        #endif
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        sfl::static_flat_soa_map<xobj, xint, 100, xobj::less> map2;
+
+        map2.try_emplace(10, 1);
+
+        CHECK(map2.at(10) == 1);
+    }
+
+    PRINT("Test operator[](const Key&), operator[](Key&&), operator[](K&&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        const xint key_20(20);
+
+        map[key_20] = 2;
+        map[xint(10)] = 1;
+        map[key_20] = 3;
+
+        CHECK(map.size() == 2);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 3);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        sfl::static_flat_soa_map<xobj, xint, 100, xobj::less> map2;
+
+        map2[10] = 1;
+        map2[10] = 2;
+
+        CHECK(map2.size() == 1);
+        CHECK(map2.nth(0)->first.value() == 10); CHECK(map2.nth(0)->second == 2);
+    }
+
+    PRINT("Test container(...) constructors");
+    {
+        using container_type =
+            sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>>;
+
+        std::vector<std::pair<xint, xint>> data
+        (
+            {
+                {30, 1},
+                {10, 1},
+                {20, 1},
+                {10, 2}
+            }
+        );
+
+        std::less<xint> comp;
+
+        container_type map1;
+        container_type map2(comp);
+
+        CHECK(map1.empty());
+        CHECK(map2.empty());
+
+        container_type map3(data.begin(), data.end());
+        container_type map4(data.begin(), data.end(), comp);
+        container_type map5({{30, 1}, {10, 1}, {20, 1}, {10, 2}});
+        container_type map6({{30, 1}, {10, 1}, {20, 1}, {10, 2}}, comp);
+        container_type map7(sfl::from_range_t(), data);
+        container_type map8(sfl::from_range_t(), data, comp);
+
+        for (const container_type* map : { &map3, &map4, &map5, &map6, &map7, &map8 })
+        {
+            CHECK(map->size() == 3);
+            CHECK(map->nth(0)->first == 10); CHECK(map->nth(0)->second == 1);
+            CHECK(map->nth(1)->first == 20); CHECK(map->nth(1)->second == 1);
+            CHECK(map->nth(2)->first == 30); CHECK(map->nth(2)->second == 1);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type map9(map3);
+
+        CHECK(map9 == map3);
+
+        container_type map10(std::move(map9));
+
+        CHECK(map10 == map3);
+    }
+
+    PRINT("Test operator=(const container&), operator=(container&&), operator=(std::initializer_list)");
+    {
+        using container_type =
+            sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>>;
+
+        container_type map1({{10, 1}, {20, 1}, {30, 1}});
+        container_type map2({{40, 2}});
+
+        map2 = map1;
+
+        CHECK(map2 == map1);
+        CHECK(map2.size() == 3);
+
+        container_type map3;
+
+        map3 = std::move(map2);
+
+        CHECK(map3 == map1);
+
+        map3 = map3;
+
+        CHECK(map3 == map1);
+
+        map3 = {{50, 5}, {40, 4}};
+
+        CHECK(map3.size() == 2);
+        CHECK(map3.nth(0)->first == 40); CHECK(map3.nth(0)->second == 4);
+        CHECK(map3.nth(1)->first == 50); CHECK(map3.nth(1)->second == 5);
+    }
+
+    PRINT("Test extract() && and replace(key_container_type&&, mapped_container_type&&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 2);
+        map.emplace(30, 3);
+
+        auto containers = std::move(map).extract();
+
+        CHECK(map.empty());
+        CHECK(containers.keys.size() == 3);
+        CHECK(containers.keys[0] == 10);
+        CHECK(containers.keys[1] == 20);
+        CHECK(containers.keys[2] == 30);
+        CHECK(containers.values.size() == 3);
+        CHECK(containers.values[0] == 1);
+        CHECK(containers.values[1] == 2);
+        CHECK(containers.values[2] == 3);
+
+        containers.keys.emplace_back(40);
+        containers.values.emplace_back(4);
+
+        map.replace(std::move(containers.keys), std::move(containers.values));
+
+        CHECK(map.size() == 4);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 2);
+        CHECK(map.nth(2)->first == 30); CHECK(map.nth(2)->second == 3);
+        CHECK(map.nth(3)->first == 40); CHECK(map.nth(3)->second == 4);
+    }
+
+    PRINT("Test NON-MEMBER comparison operators");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        map2.emplace(10, 1);
+        map2.emplace(20, 1);
+        map2.emplace(30, 1);
+        map2.emplace(40, 1);
+        map2.emplace(50, 1);
+
+        CHECK((map1 == map1) == true);
+        CHECK((map1 == map2) == false);
+        CHECK((map2 == map1) == false);
+        CHECK((map2 == map2) == true);
+
+        CHECK((map1 != map1) == false);
+        CHECK((map1 != map2) == true);
+        CHECK((map2 != map1) == true);
+        CHECK((map2 != map2) == false);
+
+        CHECK((map1 < map1) == false);
+        CHECK((map1 < map2) == true);
+        CHECK((map2 < map1) == false);
+        CHECK((map2 < map2) == false);
+
+        CHECK((map1 > map1) == false);
+        CHECK((map1 > map2) == false);
+        CHECK((map2 > map1) == true);
+        CHECK((map2 > map2) == false);
+
+        CHECK((map1 <= map1) == true);
+        CHECK((map1 <= map2) == true);
+        CHECK((map2 <= map1) == false);
+        CHECK((map2 <= map2) == true);
+
+        CHECK((map1 >= map1) == true);
+        CHECK((map1 >= map2) == false);
+        CHECK((map2 >= map1) == true);
+        CHECK((map2 >= map2) == true);
+    }
+
+    PRINT("Test NON-MEMBER swap(container&)");
+    {
+        sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+
+        map2.emplace(40, 2);
+        map2.emplace(50, 2);
+
+        swap(map1, map2);
+
+        CHECK(map1.size() == 2);
+        CHECK(map1.nth(0)->first == 40); CHECK(map1.nth(0)->second == 2);
+        CHECK(map1.nth(1)->first == 50); CHECK(map1.nth(1)->second == 2);
+
+        CHECK(map2.size() == 1);
+        CHECK(map2.nth(0)->first == 10); CHECK(map2.nth(0)->second == 1);
+    }
+
+    PRINT("Test NON-MEMBER erase_if(container&, Predicate)");
+    {
+        using container_type =
+            sfl::static_flat_soa_map<xint, xint, 100, std::less<xint>>;
+
+        using const_reference = typename container_type::const_reference;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 2);
+        map.emplace(30, 3);
+        map.emplace(40, 4);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        CHECK(erase_if(map, [](const_reference& value){ return value.first == 20 || value.second == 4; }) == 2);
+        CHECK(map.size() == 2);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 3);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        CHECK(erase_if(map, [](const_reference& value){ return value.first == 20; }) == 0);
+        CHECK(map.size() == 2);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 3);
+    }
+
+    PRINT("Test lower_bound, upper_bound, equal_range, find with arithmetic keys and std::less (branchless search)");
+    {
+        using container_type = sfl::static_flat_soa_map<int, int, 40, std::less<int>>;
+
+        using const_reference = typename container_type::const_reference;
+
+        for (int n = 0; n <= 20; ++n)
+        {
+            container_type container;
+
+            for (int i = 0; i < n; ++i)
+            {
+                container.emplace(2 * i + 10, i);
+            }
+
+            CHECK(container.size() == std::size_t(1 * n));
+
+            for (int key = 0; key <= 2 * n + 20; ++key)
+            {
+                const auto lower = std::partition_point
+                (
+                    container.begin(),
+                    container.end(),
+                    [key](const_reference value) { return value.first < key; }
+                );
+
+                const auto upper = std::partition_point
+                (
+                    container.begin(),
+                    container.end(),
+                    [key](const_reference value) { return !(key < value.first); }
+                );
+
+                CHECK(container.lower_bound(key) == lower);
+                CHECK(container.upper_bound(key) == upper);
+                CHECK(container.equal_range(key) == std::make_pair(lower, upper));
+                CHECK(container.find(key) == (lower == upper ? container.end() : lower));
+                CHECK(container.count(key) == std::size_t(std::distance(lower, upper)));
+            }
+        }
+    }
+}
+
+int main()
+{
+    test_static_flat_soa_map();
+}
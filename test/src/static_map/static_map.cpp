@@ -6,6 +6,7 @@
 #undef NDEBUG // This is very important. Must be in the first line.
 
 #include "sfl/static_map.hpp"
+#include "sfl/static_multimap.hpp"
 
 #include "check.hpp"
 #include "istream_view.hpp"
@@ -1550,6 +1551,188 @@ void test_static_map()
         CHECK(NTH(map2, 3)->first == 70); CHECK(NTH(map2, 3)->second == 2);
     }
 
+    PRINT("Test extract(const_iterator), insert(node_type&&), insert(const_iterator, node_type&&)");
+    {
+        sfl::static_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        auto nh = map.extract(NTH(map, 1));
+
+        CHECK(!nh.empty());
+        CHECK(nh.key() == 20); CHECK(nh.mapped() == 1);
+        CHECK(map.size() == 2);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 1)->second == 1);
+
+        nh.key() = 40;
+        nh.mapped() = 2;
+
+        {
+            auto res = map.insert(std::move(nh));
+
+            CHECK(res.inserted == true);
+            CHECK(res.position == NTH(map, 2));
+            CHECK(res.node.empty());
+            CHECK(nh.empty());
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 40); CHECK(NTH(map, 2)->second == 2);
+        }
+
+        nh = map.extract(NTH(map, 0));
+        nh.key() = 30;
+
+        {
+            auto res = map.insert(std::move(nh));
+
+            CHECK(res.inserted == false);
+            CHECK(res.position == NTH(map, 0));
+            CHECK(!res.node.empty());
+            CHECK(res.node.key() == 30); CHECK(res.node.mapped() == 1);
+            CHECK(map.size() == 2);
+
+            const auto it1 = map.insert(map.end(), std::move(res.node));
+
+            CHECK(it1 == NTH(map, 0));
+            CHECK(!res.node.empty());
+            CHECK(map.size() == 2);
+
+            res.node.key() = 5;
+
+            const auto it2 = map.insert(map.end(), std::move(res.node));
+
+            CHECK(it2 == NTH(map, 0));
+            CHECK(res.node.empty());
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first ==  5); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 40); CHECK(NTH(map, 2)->second == 2);
+        }
+
+        {
+            auto res = map.insert(std::move(nh));
+
+            CHECK(res.inserted == false);
+            CHECK(res.position == map.end());
+            CHECK(res.node.empty());
+            CHECK(map.size() == 3);
+        }
+    }
+
+    PRINT("Test extract(const Key&)");
+    {
+        sfl::static_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        {
+            const auto nh = map.extract(20);
+
+            CHECK(!nh.empty());
+            CHECK(nh.key() == 20); CHECK(nh.mapped() == 1);
+            CHECK(map.size() == 2);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 1)->second == 1);
+        }
+
+        {
+            const auto nh = map.extract(20);
+
+            CHECK(nh.empty());
+            CHECK(map.size() == 2);
+        }
+    }
+
+    PRINT("Test extract(K&&)");
+    {
+        sfl::static_map<xobj, xint, 32, xobj::less> map;
+
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(10), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(20), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(30), std::forward_as_tuple(1));
+
+        {
+            const auto nh = map.extract(20);
+
+            CHECK(!nh.empty());
+            CHECK(nh.key().value() == 20); CHECK(nh.mapped() == 1);
+            CHECK(map.size() == 2);
+            CHECK(NTH(map, 0)->first.value() == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first.value() == 30); CHECK(NTH(map, 1)->second == 1);
+        }
+
+        {
+            const auto nh = map.extract(20);
+
+            CHECK(nh.empty());
+            CHECK(map.size() == 2);
+        }
+    }
+
+    PRINT("Test merge(container&)");
+    {
+        sfl::static_map<xint, xint, 32, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        map2.emplace(20, 2);
+        map2.emplace(40, 2);
+        map2.emplace(50, 2);
+
+        map1.merge(map2);
+
+        CHECK(map1.size() == 5);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+        CHECK(NTH(map1, 3)->first == 40); CHECK(NTH(map1, 3)->second == 2);
+        CHECK(NTH(map1, 4)->first == 50); CHECK(NTH(map1, 4)->second == 2);
+
+        CHECK(map2.size() == 1);
+        CHECK(NTH(map2, 0)->first == 20); CHECK(NTH(map2, 0)->second == 2);
+
+        map1.merge(std::move(map2));
+
+        CHECK(map1.size() == 5);
+        CHECK(map2.size() == 1);
+
+        map1.merge(map1);
+
+        CHECK(map1.size() == 5);
+    }
+
+    PRINT("Test merge(multi_container&)");
+    {
+        sfl::static_map<xint, xint, 32, std::less<xint>> map1;
+        sfl::static_multimap<xint, xint, 32, std::less<xint>> map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+
+        map2.emplace(10, 2);
+        map2.emplace(30, 2);
+        map2.emplace(30, 3);
+
+        map1.merge(map2);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 2);
+
+        CHECK(map2.size() == 2);
+        CHECK(NTH(map2, 0)->first == 10); CHECK(NTH(map2, 0)->second == 2);
+        CHECK(NTH(map2, 1)->first == 30); CHECK(NTH(map2, 1)->second == 3);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
 
     PRINT("Test at(const Key&)");
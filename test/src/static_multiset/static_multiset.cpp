@@ -6,6 +6,7 @@
 #undef NDEBUG // This is very important. Must be in the first line.
 
 #include "sfl/static_multiset.hpp"
+#include "sfl/static_set.hpp"
 
 #include "check.hpp"
 #include "istream_view.hpp"
@@ -1165,6 +1166,156 @@ void test_static_multiset()
         CHECK(NTH(set2, 3)->first == 70); CHECK(NTH(set2, 3)->second == 2);
     }
 
+    PRINT("Test extract(const_iterator), insert(node_type&&), insert(const_iterator, node_type&&)");
+    {
+        sfl::static_multiset<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        auto nh = set.extract(NTH(set, 1));
+
+        CHECK(!nh.empty());
+        CHECK(nh.value().first == 20); CHECK(nh.value().second == 1);
+        CHECK(set.size() == 2);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+
+        nh.value().first = 10;
+        nh.value().second = 2;
+
+        {
+            const auto res = set.insert(std::move(nh));
+
+            CHECK(res == NTH(set, 1));
+            CHECK(nh.empty());
+            CHECK(set.size() == 3);
+            CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 10); CHECK(NTH(set, 1)->second == 2);
+            CHECK(NTH(set, 2)->first == 30); CHECK(NTH(set, 2)->second == 1);
+        }
+
+        nh = set.extract(NTH(set, 2));
+        nh.value().first = 10;
+        nh.value().second = 3;
+
+        {
+            const auto res = set.insert(set.begin(), std::move(nh));
+
+            CHECK(res == NTH(set, 0));
+            CHECK(nh.empty());
+            CHECK(set.size() == 3);
+            CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 3);
+            CHECK(NTH(set, 1)->first == 10); CHECK(NTH(set, 1)->second == 1);
+            CHECK(NTH(set, 2)->first == 10); CHECK(NTH(set, 2)->second == 2);
+        }
+
+        {
+            const auto res = set.insert(std::move(nh));
+
+            CHECK(res == set.end());
+            CHECK(set.size() == 3);
+        }
+    }
+
+    PRINT("Test extract(const Key&)");
+    {
+        sfl::static_multiset<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        {
+            const auto nh = set.extract(xint_xint(20, 0));
+
+            CHECK(!nh.empty());
+            CHECK(nh.value().first == 20); CHECK(nh.value().second == 1);
+            CHECK(set.size() == 2);
+            CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+        }
+
+        {
+            const auto nh = set.extract(xint_xint(20, 0));
+
+            CHECK(nh.empty());
+            CHECK(set.size() == 2);
+        }
+    }
+
+    PRINT("Test extract(K&&)");
+    {
+        sfl::static_multiset<xobj, 32, xobj::less> set;
+
+        set.emplace(10);
+        set.emplace(20);
+        set.emplace(30);
+
+        {
+            const auto nh = set.extract(20);
+
+            CHECK(!nh.empty());
+            CHECK(nh.value().value() == 20);
+            CHECK(set.size() == 2);
+            CHECK(NTH(set, 0)->value() == 10);
+            CHECK(NTH(set, 1)->value() == 30);
+        }
+
+        {
+            const auto nh = set.extract(20);
+
+            CHECK(nh.empty());
+            CHECK(set.size() == 2);
+        }
+    }
+
+    PRINT("Test merge(container&)");
+    {
+        sfl::static_multiset<xint_xint, 32, std::less<xint_xint>> set1, set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+
+        set2.emplace(10, 2);
+        set2.emplace(40, 2);
+
+        set1.merge(set2);
+
+        CHECK(set1.size() == 4);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 10); CHECK(NTH(set1, 1)->second == 2);
+        CHECK(NTH(set1, 2)->first == 20); CHECK(NTH(set1, 2)->second == 1);
+        CHECK(NTH(set1, 3)->first == 40); CHECK(NTH(set1, 3)->second == 2);
+
+        CHECK(set2.size() == 0);
+
+        set1.merge(set1);
+
+        CHECK(set1.size() == 4);
+    }
+
+    PRINT("Test merge(unique_container&)");
+    {
+        sfl::static_multiset<xint_xint, 32, std::less<xint_xint>> set1;
+        sfl::static_set<xint_xint, 32, std::less<xint_xint>> set2;
+
+        set1.emplace(10, 1);
+
+        set2.emplace(10, 2);
+        set2.emplace(20, 2);
+
+        set1.merge(std::move(set2));
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 10); CHECK(NTH(set1, 1)->second == 2);
+        CHECK(NTH(set1, 2)->first == 20); CHECK(NTH(set1, 2)->second == 2);
+
+        CHECK(set2.size() == 0);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
 
     PRINT("Test NON-MEMBER comparison operators");
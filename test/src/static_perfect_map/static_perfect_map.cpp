@@ -0,0 +1,201 @@
+//
+// g++ -std=c++17 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include static_perfect_map.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/static_perfect_map.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#if SFL_CPP_VERSION >= SFL_CPP_17
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace
+{
+
+enum class color { red, green, blue, cyan, magenta, yellow };
+
+constexpr auto colors = sfl::make_static_perfect_map<std::string_view, color>
+(
+    {
+        {"red",     color::red},
+        {"green",   color::green},
+        {"blue",    color::blue},
+        {"cyan",    color::cyan},
+        {"magenta", color::magenta},
+        {"yellow",  color::yellow}
+    }
+);
+
+constexpr sfl::static_perfect_map<color, std::string_view, 3> primary
+{
+    {color::red,   "red"},
+    {color::green, "green"},
+    {color::blue,  "blue"}
+};
+
+// Lookup is evaluated at compile time.
+static_assert(colors.size() == 6);
+static_assert(colors.at("blue") == color::blue);
+static_assert(colors.contains("black") == false);
+static_assert(primary.at(color::green) == "green");
+static_assert(primary.find(color::cyan) == primary.end());
+
+template <std::size_t... I>
+constexpr auto make_squares(std::index_sequence<I...>)
+{
+    return sfl::static_perfect_map<long, long, sizeof...(I)>
+    (
+        {
+            std::pair<long, long>(long(I) * long(I), long(I))...
+        }
+    );
+}
+
+struct transparent_equal
+{
+    using is_transparent = void;
+
+    constexpr bool operator()(std::string_view x, std::string_view y) const
+    {
+        return x == y;
+    }
+};
+
+} // namespace
+
+void test_static_perfect_map()
+{
+    PRINT("Test static_capacity");
+    {
+        CHECK((sfl::static_perfect_map<int, int, 32>::static_capacity == 32));
+    }
+
+    PRINT("Test size, max_size, empty");
+    {
+        CHECK(colors.size() == 6);
+        CHECK(colors.max_size() == 6);
+        CHECK(colors.empty() == false);
+    }
+
+    PRINT("Test begin, end, cbegin, cend");
+    {
+        int count = 0;
+
+        for (auto it = colors.begin(); it != colors.end(); ++it)
+        {
+            CHECK(colors.find(it->first) == it);
+            ++count;
+        }
+
+        CHECK(count == 6);
+        CHECK(colors.cend() - colors.cbegin() == 6);
+    }
+
+    PRINT("Test find, count, contains, at");
+    {
+        const std::string_view keys[] = {"red", "green", "blue", "cyan", "magenta", "yellow"};
+
+        for (int i = 0; i < 6; ++i)
+        {
+            CHECK(colors.find(keys[i]) != colors.end());
+            CHECK(colors.find(keys[i])->second == color(i));
+            CHECK(colors.count(keys[i]) == 1);
+            CHECK(colors.contains(keys[i]) == true);
+            CHECK(colors.at(keys[i]) == color(i));
+        }
+
+        CHECK(colors.find("") == colors.end());
+        CHECK(colors.find("re") == colors.end());
+        CHECK(colors.find("reds") == colors.end());
+        CHECK(colors.count("black") == 0);
+        CHECK(colors.contains("white") == false);
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            (void)colors.at("black");
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        #endif
+    }
+
+    PRINT("Test find(const K&)");
+    {
+        constexpr auto map = sfl::static_perfect_map<std::string_view, int, 3, sfl::constexpr_hash<std::string_view>, transparent_equal>
+        (
+            {
+                {"one",   1},
+                {"two",   2},
+                {"three", 3}
+            }
+        );
+
+        const std::string two("two");
+
+        CHECK(map.find(two)->second == 2);
+        CHECK(map.count("three") == 1);
+        CHECK(map.contains(std::string("four")) == false);
+        CHECK(map.at("one") == 1);
+    }
+
+    PRINT("Test construction at run time");
+    {
+        const std::pair<std::string_view, int> values[] =
+        {
+            {"x", 10},
+            {"y", 20},
+            {"z", 30}
+        };
+
+        sfl::static_perfect_map<std::string_view, int, 3> map(values);
+
+        CHECK(map.at("x") == 10);
+        CHECK(map.at("y") == 20);
+        CHECK(map.at("z") == 30);
+        CHECK(map.contains("w") == false);
+
+        auto copy = map;
+
+        CHECK(copy.at("y") == 20);
+    }
+
+    PRINT("Test large key set");
+    {
+        static constexpr auto squares = make_squares(std::make_index_sequence<500>());
+
+        for (long i = 0; i < 500; ++i)
+        {
+            CHECK(squares.at(i * i) == i);
+            CHECK(squares.contains(i * i + 2) == false);
+        }
+    }
+}
+
+#else // before C++17
+
+void test_static_perfect_map()
+{
+    PRINT("sfl::static_perfect_map requires C++17");
+}
+
+#endif // before C++17
+
+int main()
+{
+    test_static_perfect_map();
+}
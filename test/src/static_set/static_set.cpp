@@ -6,6 +6,7 @@
 #undef NDEBUG // This is very important. Must be in the first line.
 
 #include "sfl/static_set.hpp"
+#include "sfl/static_multiset.hpp"
 
 #include "check.hpp"
 #include "istream_view.hpp"
@@ -1129,6 +1130,188 @@ void test_static_set()
         CHECK(NTH(set2, 3)->first == 70); CHECK(NTH(set2, 3)->second == 2);
     }
 
+    PRINT("Test extract(const_iterator), insert(node_type&&), insert(const_iterator, node_type&&)");
+    {
+        sfl::static_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        auto nh = set.extract(NTH(set, 1));
+
+        CHECK(!nh.empty());
+        CHECK(nh.value().first == 20); CHECK(nh.value().second == 1);
+        CHECK(set.size() == 2);
+        CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+        CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+
+        nh.value().first = 40;
+        nh.value().second = 2;
+
+        {
+            auto res = set.insert(std::move(nh));
+
+            CHECK(res.inserted == true);
+            CHECK(res.position == NTH(set, 2));
+            CHECK(res.node.empty());
+            CHECK(nh.empty());
+            CHECK(set.size() == 3);
+            CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+            CHECK(NTH(set, 2)->first == 40); CHECK(NTH(set, 2)->second == 2);
+        }
+
+        nh = set.extract(NTH(set, 0));
+        nh.value().first = 30;
+
+        {
+            auto res = set.insert(std::move(nh));
+
+            CHECK(res.inserted == false);
+            CHECK(res.position == NTH(set, 0));
+            CHECK(!res.node.empty());
+            CHECK(res.node.value().first == 30); CHECK(res.node.value().second == 1);
+            CHECK(set.size() == 2);
+
+            const auto it1 = set.insert(set.end(), std::move(res.node));
+
+            CHECK(it1 == NTH(set, 0));
+            CHECK(!res.node.empty());
+            CHECK(set.size() == 2);
+
+            res.node.value().first = 5;
+
+            const auto it2 = set.insert(set.end(), std::move(res.node));
+
+            CHECK(it2 == NTH(set, 0));
+            CHECK(res.node.empty());
+            CHECK(set.size() == 3);
+            CHECK(NTH(set, 0)->first ==  5); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+            CHECK(NTH(set, 2)->first == 40); CHECK(NTH(set, 2)->second == 2);
+        }
+
+        {
+            auto res = set.insert(std::move(nh));
+
+            CHECK(res.inserted == false);
+            CHECK(res.position == set.end());
+            CHECK(res.node.empty());
+            CHECK(set.size() == 3);
+        }
+    }
+
+    PRINT("Test extract(const Key&)");
+    {
+        sfl::static_set<xint_xint, 32, std::less<xint_xint>> set;
+
+        set.emplace(10, 1);
+        set.emplace(20, 1);
+        set.emplace(30, 1);
+
+        {
+            const auto nh = set.extract(xint_xint(20, 0));
+
+            CHECK(!nh.empty());
+            CHECK(nh.value().first == 20); CHECK(nh.value().second == 1);
+            CHECK(set.size() == 2);
+            CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
+            CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
+        }
+
+        {
+            const auto nh = set.extract(xint_xint(20, 0));
+
+            CHECK(nh.empty());
+            CHECK(set.size() == 2);
+        }
+    }
+
+    PRINT("Test extract(K&&)");
+    {
+        sfl::static_set<xobj, 32, xobj::less> set;
+
+        set.emplace(10);
+        set.emplace(20);
+        set.emplace(30);
+
+        {
+            const auto nh = set.extract(20);
+
+            CHECK(!nh.empty());
+            CHECK(nh.value().value() == 20);
+            CHECK(set.size() == 2);
+            CHECK(NTH(set, 0)->value() == 10);
+            CHECK(NTH(set, 1)->value() == 30);
+        }
+
+        {
+            const auto nh = set.extract(20);
+
+            CHECK(nh.empty());
+            CHECK(set.size() == 2);
+        }
+    }
+
+    PRINT("Test merge(container&)");
+    {
+        sfl::static_set<xint_xint, 32, std::less<xint_xint>> set1, set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+        set1.emplace(30, 1);
+
+        set2.emplace(20, 2);
+        set2.emplace(40, 2);
+        set2.emplace(50, 2);
+
+        set1.merge(set2);
+
+        CHECK(set1.size() == 5);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 1);
+        CHECK(NTH(set1, 3)->first == 40); CHECK(NTH(set1, 3)->second == 2);
+        CHECK(NTH(set1, 4)->first == 50); CHECK(NTH(set1, 4)->second == 2);
+
+        CHECK(set2.size() == 1);
+        CHECK(NTH(set2, 0)->first == 20); CHECK(NTH(set2, 0)->second == 2);
+
+        set1.merge(std::move(set2));
+
+        CHECK(set1.size() == 5);
+        CHECK(set2.size() == 1);
+
+        set1.merge(set1);
+
+        CHECK(set1.size() == 5);
+    }
+
+    PRINT("Test merge(multi_container&)");
+    {
+        sfl::static_set<xint_xint, 32, std::less<xint_xint>> set1;
+        sfl::static_multiset<xint_xint, 32, std::less<xint_xint>> set2;
+
+        set1.emplace(10, 1);
+        set1.emplace(20, 1);
+
+        set2.emplace(10, 2);
+        set2.emplace(30, 2);
+        set2.emplace(30, 3);
+
+        set1.merge(set2);
+
+        CHECK(set1.size() == 3);
+        CHECK(NTH(set1, 0)->first == 10); CHECK(NTH(set1, 0)->second == 1);
+        CHECK(NTH(set1, 1)->first == 20); CHECK(NTH(set1, 1)->second == 1);
+        CHECK(NTH(set1, 2)->first == 30); CHECK(NTH(set1, 2)->second == 2);
+
+        CHECK(set2.size() == 2);
+        CHECK(NTH(set2, 0)->first == 10); CHECK(NTH(set2, 0)->second == 2);
+        CHECK(NTH(set2, 1)->first == 30); CHECK(NTH(set2, 1)->second == 3);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
 
     PRINT("Test NON-MEMBER comparison operators");
@@ -2940,6 +2940,140 @@ void test_static_unordered_flat_map()
         CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
         CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 1);
     }
+
+    PRINT("Test lookup policies");
+    {
+        const auto check_keys = [](const std::vector<int>& keys, std::initializer_list<int> expected)
+        {
+            CHECK(keys == std::vector<int>(expected));
+        };
+
+        {
+            using container_type =
+                sfl::static_unordered_flat_map< int,
+                                                int,
+                                                10,
+                                                std::equal_to<int>,
+                                                sfl::lookup_move_to_front >;
+
+            container_type map({{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}});
+
+            const auto keys = [&]()
+            {
+                std::vector<int> result;
+
+                for (const auto& value : map)
+                {
+                    result.push_back(value.first);
+                }
+
+                return result;
+            };
+
+            const container_type& cmap = map;
+
+            CHECK(cmap.find(4) == cmap.nth(3));
+            check_keys(keys(), {1, 2, 3, 4, 5});
+
+            {
+                const auto it = map.find(4);
+                CHECK(it == map.nth(0));
+                CHECK(it->second == 4 * 10);
+                check_keys(keys(), {4, 1, 2, 3, 5});
+            }
+
+            {
+                const auto it = map.find(4);
+                CHECK(it == map.nth(0));
+                CHECK(it->second == 4 * 10);
+                check_keys(keys(), {4, 1, 2, 3, 5});
+            }
+
+            {
+                const auto it = map.find(5);
+                CHECK(it == map.nth(0));
+                CHECK(it->second == 5 * 10);
+                check_keys(keys(), {5, 4, 1, 2, 3});
+            }
+
+            CHECK(map.find(6) == map.end());
+            check_keys(keys(), {5, 4, 1, 2, 3});
+
+            CHECK(map.at(2) == 20);
+            check_keys(keys(), {2, 5, 4, 1, 3});
+
+            map[3] = 33;
+            check_keys(keys(), {3, 2, 5, 4, 1});
+            CHECK(map.nth(0)->second == 33);
+
+            CHECK(map.erase(4) == 1);
+            CHECK(map.size() == 4);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        {
+            using container_type =
+                sfl::static_unordered_flat_map< int,
+                                                int,
+                                                10,
+                                                std::equal_to<int>,
+                                                sfl::lookup_transpose >;
+
+            container_type map({{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}});
+
+            const auto keys = [&]()
+            {
+                std::vector<int> result;
+
+                for (const auto& value : map)
+                {
+                    result.push_back(value.first);
+                }
+
+                return result;
+            };
+
+            const container_type& cmap = map;
+
+            CHECK(cmap.find(4) == cmap.nth(3));
+            check_keys(keys(), {1, 2, 3, 4, 5});
+
+            {
+                const auto it = map.find(4);
+                CHECK(it == map.nth(2));
+                CHECK(it->second == 4 * 10);
+                check_keys(keys(), {1, 2, 4, 3, 5});
+            }
+
+            {
+                const auto it = map.find(4);
+                CHECK(it == map.nth(1));
+                CHECK(it->second == 4 * 10);
+                check_keys(keys(), {1, 4, 2, 3, 5});
+            }
+
+            {
+                const auto it = map.find(1);
+                CHECK(it == map.nth(0));
+                CHECK(it->second == 1 * 10);
+                check_keys(keys(), {1, 4, 2, 3, 5});
+            }
+
+            CHECK(map.find(6) == map.end());
+            check_keys(keys(), {1, 4, 2, 3, 5});
+
+            CHECK(map.at(2) == 20);
+            check_keys(keys(), {1, 2, 4, 3, 5});
+
+            map[5] = 55;
+            check_keys(keys(), {1, 2, 4, 5, 3});
+            CHECK(map.nth(3)->second == 55);
+
+            CHECK(map.erase(4) == 1);
+            CHECK(map.size() == 4);
+        }
+    }
 }
 
 int main()
@@ -18,6 +18,7 @@
 #include "xint_xint.hpp"
 #include "xobj.hpp"
 
+#include <cstdint>
 #include <sstream>
 #include <vector>
 
@@ -2187,6 +2188,154 @@ void test_static_unordered_flat_set()
         CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 1);
         CHECK(set.nth(1)->first == 30); CHECK(set.nth(1)->second == 1);
     }
+
+    PRINT("Test find with integral and pointer keys (SIMD search)");
+    {
+        const int array[200] = {};
+
+        {
+            using container_type = sfl::static_unordered_flat_set<std::uint8_t, 200, std::equal_to<std::uint8_t>>;
+
+            const auto key = [&](int x) { return std::uint8_t(x); };
+
+            container_type set;
+
+            for (int x = 0; x < 200; x += 2)
+            {
+                set.emplace(key(x));
+            }
+
+            for (int x = 0; x < 200; ++x)
+            {
+                if (x % 2 == 0)
+                {
+                    CHECK(set.find(key(x)) == set.nth(x / 2));
+                    CHECK(set.count(key(x)) == 1);
+                }
+                else
+                {
+                    CHECK(set.find(key(x)) == set.end());
+                    CHECK(set.count(key(x)) == 0);
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        {
+            using container_type = sfl::static_unordered_flat_set<short, 200, std::equal_to<short>>;
+
+            const auto key = [&](int x) { return short(x - 100); };
+
+            container_type set;
+
+            for (int x = 0; x < 200; x += 2)
+            {
+                set.emplace(key(x));
+            }
+
+            for (int x = 0; x < 200; ++x)
+            {
+                if (x % 2 == 0)
+                {
+                    CHECK(set.find(key(x)) == set.nth(x / 2));
+                    CHECK(set.count(key(x)) == 1);
+                }
+                else
+                {
+                    CHECK(set.find(key(x)) == set.end());
+                    CHECK(set.count(key(x)) == 0);
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        {
+            using container_type = sfl::static_unordered_flat_set<int, 200, std::equal_to<int>>;
+
+            const auto key = [&](int x) { return int(x) * 1000 - 7; };
+
+            container_type set;
+
+            for (int x = 0; x < 200; x += 2)
+            {
+                set.emplace(key(x));
+            }
+
+            for (int x = 0; x < 200; ++x)
+            {
+                if (x % 2 == 0)
+                {
+                    CHECK(set.find(key(x)) == set.nth(x / 2));
+                    CHECK(set.count(key(x)) == 1);
+                }
+                else
+                {
+                    CHECK(set.find(key(x)) == set.end());
+                    CHECK(set.count(key(x)) == 0);
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        {
+            using container_type = sfl::static_unordered_flat_set<long long, 200, std::equal_to<long long>>;
+
+            const auto key = [&](int x) { return (static_cast<long long>(x) << 32) + 7; };
+
+            container_type set;
+
+            for (int x = 0; x < 200; x += 2)
+            {
+                set.emplace(key(x));
+            }
+
+            for (int x = 0; x < 200; ++x)
+            {
+                if (x % 2 == 0)
+                {
+                    CHECK(set.find(key(x)) == set.nth(x / 2));
+                    CHECK(set.count(key(x)) == 1);
+                }
+                else
+                {
+                    CHECK(set.find(key(x)) == set.end());
+                    CHECK(set.count(key(x)) == 0);
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        {
+            using container_type = sfl::static_unordered_flat_set<const int*, 200, std::equal_to<const int*>>;
+
+            const auto key = [&](int x) { return array + x; };
+
+            container_type set;
+
+            for (int x = 0; x < 200; x += 2)
+            {
+                set.emplace(key(x));
+            }
+
+            for (int x = 0; x < 200; ++x)
+            {
+                if (x % 2 == 0)
+                {
+                    CHECK(set.find(key(x)) == set.nth(x / 2));
+                    CHECK(set.count(key(x)) == 1);
+                }
+                else
+                {
+                    CHECK(set.find(key(x)) == set.end());
+                    CHECK(set.count(key(x)) == 0);
+                }
+            }
+        }
+    }
 }
 
 int main()
@@ -0,0 +1,1261 @@
+//
+// g++ -std=c++11 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include static_unordered_map.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/static_unordered_map.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+void test_static_unordered_map()
+{
+    using sfl::test::xint;
+    using sfl::test::xobj;
+
+    PRINT("Test static_capacity");
+    {
+        CHECK((sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>>::static_capacity == 32));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test container()");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        CHECK(map.empty() == true);
+        CHECK(map.full() == false);
+        CHECK(map.size() == 0);
+        CHECK(map.capacity() == 32);
+        CHECK(map.available() == 32);
+        CHECK(map.begin() == map.end());
+    }
+
+    PRINT("Test container(const Hash&, const KeyEqual&)");
+    {
+        xint::hash hash;
+
+        std::equal_to<xint> equal;
+
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map(hash, equal);
+
+        CHECK(map.size() == 0);
+        CHECK(map.capacity() == 32);
+    }
+
+    PRINT("Test container(InputIt, InputIt)");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 1 20 1 30 1 20 2 20 3");
+
+            sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map
+            (
+                (std::istream_iterator<std::pair<int, int>>(iss)),
+                (std::istream_iterator<std::pair<int, int>>())
+            );
+
+            CHECK(map.size() == 3);
+            CHECK(map.find(10)->second == 1);
+            CHECK(map.find(20)->second == 1);
+            CHECK(map.find(30)->second == 1);
+        }
+
+        // Forward iterator
+        {
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {10, 1},
+                    {20, 1},
+                    {30, 1},
+                    {20, 2},
+                    {20, 3}
+                }
+            );
+
+            sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map(data.begin(), data.end());
+
+            CHECK(map.size() == 3);
+            CHECK(map.find(10)->second == 1);
+            CHECK(map.find(20)->second == 1);
+            CHECK(map.find(30)->second == 1);
+        }
+    }
+
+    PRINT("Test container(std::initializer_list)");
+    {
+        std::initializer_list<std::pair<const xint, xint>> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1},
+            {20, 2},
+            {20, 3}
+        };
+
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map(ilist);
+
+        CHECK(map.size() == 3);
+        CHECK(map.find(10)->second == 1);
+        CHECK(map.find(20)->second == 1);
+        CHECK(map.find(30)->second == 1);
+    }
+
+    PRINT("Test container(const container&)");
+    {
+        for (int n = 0; n < 64; n += 7)
+        {
+            sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map1;
+
+            for (int i = 0; i < n; ++i)
+            {
+                map1.emplace(i, 10 * i);
+            }
+
+            sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map2(map1);
+
+            CHECK(map2.size() == map1.size());
+            CHECK(map2.bucket_count() == map1.bucket_count());
+
+            for (int i = 0; i < n; ++i)
+            {
+                CHECK(map2.find(i)->second == 10 * i);
+            }
+        }
+    }
+
+    PRINT("Test container(container&&)");
+    {
+        for (int n = 0; n < 64; n += 7)
+        {
+            sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map1;
+
+            for (int i = 0; i < n; ++i)
+            {
+                map1.emplace(i, 10 * i);
+            }
+
+            sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map2(std::move(map1));
+
+            CHECK(map1.empty() == true);
+            CHECK(map2.size() == std::size_t(n));
+
+            for (int i = 0; i < n; ++i)
+            {
+                CHECK(map2.find(i)->second == 10 * i);
+            }
+        }
+    }
+
+    PRINT("Test container(sfl::from_range_t, Range&&)");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 1 20 1 30 1 20 2 20 3");
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map
+            (
+                (sfl::from_range_t()),
+                (std::views::istream<std::pair<int, int>>(iss))
+            );
+            #else
+            sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map
+            (
+                (sfl::from_range_t()),
+                (sfl::test::istream_view<std::pair<int, int>>(iss))
+            );
+            #endif
+
+            CHECK(map.size() == 3);
+            CHECK(map.find(10)->second == 1);
+            CHECK(map.find(20)->second == 1);
+            CHECK(map.find(30)->second == 1);
+        }
+
+        // Forward iterator
+        {
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {10, 1},
+                    {20, 1},
+                    {30, 1},
+                    {20, 2},
+                    {20, 3}
+                }
+            );
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map
+            (
+                sfl::from_range_t(),
+                std::views::all(data)
+            );
+            #else
+            sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map
+            (
+                sfl::from_range_t(),
+                data
+            );
+            #endif
+
+            CHECK(map.size() == 3);
+            CHECK(map.find(10)->second == 1);
+            CHECK(map.find(20)->second == 1);
+            CHECK(map.find(30)->second == 1);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test operator=(const container&)");
+    {
+        for (int n1 = 0; n1 < 40; n1 += 13)
+        {
+            for (int n2 = 0; n2 < 40; n2 += 13)
+            {
+                sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map1, map2;
+
+                for (int i = 0; i < n1; ++i)
+                {
+                    map1.emplace(i, 10 * i);
+                }
+
+                for (int i = 0; i < n2; ++i)
+                {
+                    map2.emplace(100 + i, i);
+                }
+
+                map2 = map1;
+
+                CHECK(map1.size() == std::size_t(n1));
+                CHECK(map2.size() == std::size_t(n1));
+
+                for (int i = 0; i < n1; ++i)
+                {
+                    CHECK(map2.find(i)->second == 10 * i);
+                }
+
+                CHECK(map2 == map1);
+            }
+        }
+    }
+
+    PRINT("Test operator=(container&&)");
+    {
+        for (int n1 = 0; n1 < 40; n1 += 13)
+        {
+            for (int n2 = 0; n2 < 40; n2 += 13)
+            {
+                sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map1, map2;
+
+                for (int i = 0; i < n1; ++i)
+                {
+                    map1.emplace(i, 10 * i);
+                }
+
+                for (int i = 0; i < n2; ++i)
+                {
+                    map2.emplace(100 + i, i);
+                }
+
+                map2 = std::move(map1);
+
+                CHECK(map1.empty() == true);
+                CHECK(map2.size() == std::size_t(n1));
+
+                for (int i = 0; i < n1; ++i)
+                {
+                    CHECK(map2.find(i)->second == 10 * i);
+                }
+            }
+        }
+    }
+
+    PRINT("Test operator=(std::initializer_list)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        map.emplace(40, 4);
+        map.emplace(50, 5);
+
+        std::initializer_list<std::pair<const xint, xint>> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1},
+            {20, 2},
+            {20, 3}
+        };
+
+        map = ilist;
+
+        CHECK(map.size() == 3);
+        CHECK(map.find(10)->second == 1);
+        CHECK(map.find(20)->second == 1);
+        CHECK(map.find(30)->second == 1);
+        CHECK(map.contains(40) == false);
+        CHECK(map.contains(50) == false);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test hash_function() and key_eq()");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        auto hash = map.hash_function();
+        auto key_eq = map.key_eq();
+
+        CHECK(hash(10) == xint::hash()(10));
+        CHECK(key_eq(10, 10) == true);
+        CHECK(key_eq(10, 20) == false);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test begin, end, cbegin, cend");
+    {
+        sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map;
+
+        for (int n = 0; n < 50; ++n)
+        {
+            int count = 0;
+
+            for (auto it = map.begin(); it != map.end(); ++it)
+            {
+                ++count;
+                CHECK(map.find(it->first) == it);
+                CHECK(it->first == it->second);
+            }
+
+            CHECK(count == n);
+
+            int ccount = 0;
+
+            for (auto it = map.cbegin(); it != map.cend(); it++)
+            {
+                ++ccount;
+            }
+
+            CHECK(ccount == n);
+
+            map.emplace(n, n);
+        }
+    }
+
+    PRINT("Test find, count, contains");
+    {
+        sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map;
+
+        for (int i = 0; i < 100; i += 2)
+        {
+            map.emplace(i, 10 * i);
+        }
+
+        for (int i = 0; i < 100; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                CHECK(map.find(i) != map.end());
+                CHECK(map.find(i)->first == i);
+                CHECK(map.find(i)->second == 10 * i);
+                CHECK(map.count(i) == 1);
+                CHECK(map.contains(i) == true);
+            }
+            else
+            {
+                CHECK(map.find(i) == map.end());
+                CHECK(map.count(i) == 0);
+                CHECK(map.contains(i) == false);
+            }
+        }
+
+        const auto& cmap = map;
+
+        CHECK(cmap.find(10)->second == 100);
+        CHECK(cmap.find(11) == cmap.end());
+    }
+
+    PRINT("Test find, count, contains (K)");
+    {
+        sfl::static_unordered_map<xobj, xint, 128, xobj::hash, xobj::equal> map;
+
+        for (int i = 0; i < 100; i += 2)
+        {
+            map.emplace(xobj(i), 10 * i);
+        }
+
+        for (int i = 0; i < 100; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                CHECK(map.find(i) != map.end());
+                CHECK(map.find(i)->first.value() == i);
+                CHECK(map.find(i)->second == 10 * i);
+                CHECK(map.count(i) == 1);
+                CHECK(map.contains(i) == true);
+            }
+            else
+            {
+                CHECK(map.find(i) == map.end());
+                CHECK(map.count(i) == 0);
+                CHECK(map.contains(i) == false);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test emplace(Args&&...)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        {
+            const auto res = map.emplace(10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.emplace(20, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(20));
+        }
+
+        {
+            const auto res = map.emplace(10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.emplace(20, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(20));
+        }
+
+        CHECK(map.size() == 2);
+        CHECK(map.find(10)->second == 1);
+        CHECK(map.find(20)->second == 1);
+    }
+
+    PRINT("Test emplace_hint(const_iterator, Args&&...)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        {
+            const auto it = map.emplace_hint(map.end(), 10, 1);
+
+            CHECK(it == map.find(10));
+        }
+
+        {
+            const auto it = map.emplace_hint(map.begin(), 20, 1);
+
+            CHECK(it == map.find(20));
+        }
+
+        {
+            const auto it = map.emplace_hint(map.end(), 10, 2);
+
+            CHECK(it == map.find(10));
+        }
+
+        CHECK(map.size() == 2);
+        CHECK(map.find(10)->second == 1);
+        CHECK(map.find(20)->second == 1);
+    }
+
+    PRINT("Test insert(const value_type&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        using value_type = std::pair<const xint, xint>;
+
+        const value_type value_10_1(10, 1);
+        const value_type value_10_2(10, 2);
+
+        {
+            const auto res = map.insert(value_10_1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.insert(value_10_2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 1);
+        CHECK(value_10_1.first == 10); CHECK(value_10_1.second == 1);
+    }
+
+    PRINT("Test insert(value_type&&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        using value_type = std::pair<const xint, xint>;
+
+        value_type value_10_1(10, 1);
+        value_type value_10_2(10, 2);
+
+        {
+            const auto res = map.insert(std::move(value_10_1));
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.insert(std::move(value_10_2));
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 1);
+        CHECK(value_10_1.second == -1);
+        CHECK(value_10_2.second == +2);
+    }
+
+    PRINT("Test insert(P&&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        std::pair<xint, xint> value_10_1(10, 1);
+        std::pair<xint, xint> value_10_2(10, 2);
+
+        {
+            const auto res = map.insert(std::move(value_10_1));
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.insert(std::move(value_10_2));
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 1);
+        CHECK(value_10_1.first == -10); CHECK(value_10_1.second == -1);
+    }
+
+    PRINT("Test insert(const_iterator, const value_type&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        using value_type = std::pair<const xint, xint>;
+
+        const value_type value_10_1(10, 1);
+        const value_type value_10_2(10, 2);
+
+        {
+            const auto it = map.insert(map.end(), value_10_1);
+
+            CHECK(it == map.find(10));
+        }
+
+        {
+            const auto it = map.insert(map.end(), value_10_2);
+
+            CHECK(it == map.find(10));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 1);
+    }
+
+    PRINT("Test insert(const_iterator, value_type&&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        using value_type = std::pair<const xint, xint>;
+
+        value_type value_10_1(10, 1);
+        value_type value_10_2(10, 2);
+
+        {
+            const auto it = map.insert(map.end(), std::move(value_10_1));
+
+            CHECK(it == map.find(10));
+        }
+
+        {
+            const auto it = map.insert(map.end(), std::move(value_10_2));
+
+            CHECK(it == map.find(10));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 1);
+        CHECK(value_10_1.second == -1);
+        CHECK(value_10_2.second == +2);
+    }
+
+    PRINT("Test insert(const_iterator, P&&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        std::pair<xint, xint> value_10_1(10, 1);
+        std::pair<xint, xint> value_10_2(10, 2);
+
+        {
+            const auto it = map.insert(map.end(), std::move(value_10_1));
+
+            CHECK(it == map.find(10));
+        }
+
+        {
+            const auto it = map.insert(map.end(), std::move(value_10_2));
+
+            CHECK(it == map.find(10));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 1);
+    }
+
+    PRINT("Test insert(InputIt, InputIt)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        std::vector<std::pair<xint, xint>> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1},
+                {20, 2},
+                {20, 3}
+            }
+        );
+
+        map.insert(data.begin(), data.end());
+
+        CHECK(map.size() == 3);
+        CHECK(map.find(10)->second == 1);
+        CHECK(map.find(20)->second == 1);
+        CHECK(map.find(30)->second == 1);
+    }
+
+    PRINT("Test insert(std::initializer_list)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        map.insert
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1},
+                {20, 2},
+                {20, 3}
+            }
+        );
+
+        CHECK(map.size() == 3);
+        CHECK(map.find(10)->second == 1);
+        CHECK(map.find(20)->second == 1);
+        CHECK(map.find(30)->second == 1);
+    }
+
+    PRINT("Test insert_range(Range&&)");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 1 20 1 30 1 20 2 20 3");
+
+            sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            map.insert_range(std::views::istream<std::pair<int, int>>(iss));
+            #else
+            map.insert_range(sfl::test::istream_view<std::pair<int, int>>(iss));
+            #endif
+
+            CHECK(map.size() == 3);
+            CHECK(map.find(10)->second == 1);
+            CHECK(map.find(20)->second == 1);
+            CHECK(map.find(30)->second == 1);
+        }
+
+        // Forward iterator
+        {
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {10, 1},
+                    {20, 1},
+                    {30, 1},
+                    {20, 2},
+                    {20, 3}
+                }
+            );
+
+            sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            map.insert_range(std::views::all(data));
+            #else
+            map.insert_range(data);
+            #endif
+
+            CHECK(map.size() == 3);
+            CHECK(map.find(10)->second == 1);
+            CHECK(map.find(20)->second == 1);
+            CHECK(map.find(30)->second == 1);
+        }
+    }
+
+    PRINT("Test insert_or_assign(const Key&, M&&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        const xint key_10(10);
+
+        {
+            const auto res = map.insert_or_assign(key_10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.insert_or_assign(key_10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto it = map.insert_or_assign(map.end(), key_10, 3);
+
+            CHECK(it == map.find(10));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 3);
+        CHECK(key_10 == 10);
+    }
+
+    PRINT("Test insert_or_assign(Key&&, M&&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        xint key_10_a(10);
+        xint key_10_b(10);
+        xint key_20(20);
+
+        {
+            const auto res = map.insert_or_assign(std::move(key_10_a), 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.insert_or_assign(std::move(key_10_b), 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto it = map.insert_or_assign(map.end(), std::move(key_20), 3);
+
+            CHECK(it == map.find(20));
+        }
+
+        CHECK(map.size() == 2);
+        CHECK(map.find(10)->second == 2);
+        CHECK(map.find(20)->second == 3);
+        CHECK(key_10_a == -10);
+        CHECK(key_10_b == +10);
+        CHECK(key_20 == -20);
+    }
+
+    PRINT("Test insert_or_assign(K&&, M&&)");
+    {
+        sfl::static_unordered_map<xobj, xint, 32, xobj::hash, xobj::equal> map;
+
+        {
+            const auto res = map.insert_or_assign(10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.insert_or_assign(10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto it = map.insert_or_assign(map.end(), 20, 3);
+
+            CHECK(it == map.find(20));
+        }
+
+        CHECK(map.size() == 2);
+        CHECK(map.find(10)->second == 2);
+        CHECK(map.find(20)->second == 3);
+    }
+
+    PRINT("Test try_emplace(const Key&, Args&&...)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        const xint key_10(10);
+
+        {
+            const auto res = map.try_emplace(key_10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.try_emplace(key_10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto it = map.try_emplace(map.end(), key_10, 3);
+
+            CHECK(it == map.find(10));
+        }
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 1);
+    }
+
+    PRINT("Test try_emplace(Key&&, Args&&...)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        xint key_10_a(10);
+        xint key_10_b(10);
+        xint key_20(20);
+
+        {
+            const auto res = map.try_emplace(std::move(key_10_a), 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.try_emplace(std::move(key_10_b), 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto it = map.try_emplace(map.end(), std::move(key_20), 3);
+
+            CHECK(it == map.find(20));
+        }
+
+        CHECK(map.size() == 2);
+        CHECK(map.find(10)->second == 1);
+        CHECK(map.find(20)->second == 3);
+        CHECK(key_10_a == -10);
+        CHECK(key_10_b == +10);
+        CHECK(key_20 == -20);
+    }
+
+    PRINT("Test try_emplace(K&&, Args&&...)");
+    {
+        sfl::static_unordered_map<xobj, xint, 32, xobj::hash, xobj::equal> map;
+
+        {
+            const auto res = map.try_emplace(10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto res = map.try_emplace(10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first == map.find(10));
+        }
+
+        {
+            const auto it = map.try_emplace(map.end(), 20, 3);
+
+            CHECK(it == map.find(20));
+        }
+
+        CHECK(map.size() == 2);
+        CHECK(map.find(10)->second == 1);
+        CHECK(map.find(20)->second == 3);
+    }
+
+    PRINT("Test erase(const_iterator)");
+    {
+        sfl::static_unordered_map<xobj, xint, 128, xobj::hash, xobj::equal> map;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(xobj(i), 10 * i);
+        }
+
+        int erased = 0;
+
+        for (auto it = map.cbegin(); it != map.cend(); )
+        {
+            if (it->first.value() % 3 == 0)
+            {
+                it = map.erase(it);
+                ++erased;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        CHECK(erased == 34);
+        CHECK(map.size() == 66);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(map.contains(i) == (i % 3 != 0));
+        }
+    }
+
+    PRINT("Test erase(const_iterator, const_iterator)");
+    {
+        sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, 10 * i);
+        }
+
+        CHECK(map.erase(map.begin(), map.begin()) == map.begin());
+        CHECK(map.size() == 100);
+
+        CHECK(map.erase(map.begin(), map.end()) == map.end());
+        CHECK(map.empty() == true);
+    }
+
+    PRINT("Test erase(const Key&)");
+    {
+        sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, 10 * i);
+        }
+
+        for (int i = 0; i < 100; i += 2)
+        {
+            CHECK(map.erase(i) == 1);
+            CHECK(map.erase(i) == 0);
+        }
+
+        CHECK(map.size() == 50);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(map.contains(i) == (i % 2 == 1));
+        }
+    }
+
+    PRINT("Test erase(K&&)");
+    {
+        sfl::static_unordered_map<xobj, xint, 128, xobj::hash, xobj::equal> map;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(xobj(i), 10 * i);
+        }
+
+        for (int i = 0; i < 100; i += 2)
+        {
+            CHECK(map.erase(i) == 1);
+            CHECK(map.erase(i) == 0);
+        }
+
+        CHECK(map.size() == 50);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(map.contains(i) == (i % 2 == 1));
+        }
+    }
+
+    PRINT("Test full() and available()");
+    {
+        sfl::static_unordered_map<xint, xint, 16, xint::hash, std::equal_to<xint>> map;
+
+        for (int i = 0; i < 16; ++i)
+        {
+            CHECK(map.full() == false);
+            CHECK(map.available() == std::size_t(16 - i));
+
+            map.emplace(i, i);
+        }
+
+        CHECK(map.full() == true);
+        CHECK(map.available() == 0);
+        CHECK(map.size() == map.max_size());
+
+        map.erase(5);
+
+        CHECK(map.full() == false);
+        CHECK(map.available() == 1);
+    }
+
+    PRINT("Test erase and insert reuse deleted slots");
+    {
+        sfl::static_unordered_map<xint, xint, 16, xint::hash, std::equal_to<xint>> map;
+
+        for (int i = 0; i < 16; ++i)
+        {
+            map.emplace(i, i);
+        }
+
+        const auto bucket_count = map.bucket_count();
+
+        for (int round = 0; round < 100; ++round)
+        {
+            CHECK(map.erase(round) == 1);
+            CHECK(map.emplace(round + 16, round).second == true);
+            CHECK(map.size() == 16);
+            CHECK(map.bucket_count() == bucket_count);
+        }
+
+        for (int i = 0; i < 16; ++i)
+        {
+            CHECK(map.contains(100 + i) == true);
+        }
+    }
+
+    PRINT("Test swap(container&)");
+    {
+        for (int n1 = 0; n1 < 40; n1 += 13)
+        {
+            for (int n2 = 0; n2 < 40; n2 += 13)
+            {
+                sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map1, map2;
+
+                for (int i = 0; i < n1; ++i)
+                {
+                    map1.emplace(i, 10 * i);
+                }
+
+                for (int i = 0; i < n2; ++i)
+                {
+                    map2.emplace(100 + i, i);
+                }
+
+                map1.swap(map2);
+
+                CHECK(map1.size() == std::size_t(n2));
+                CHECK(map2.size() == std::size_t(n1));
+
+                for (int i = 0; i < n1; ++i)
+                {
+                    CHECK(map2.find(i)->second == 10 * i);
+                }
+
+                for (int i = 0; i < n2; ++i)
+                {
+                    CHECK(map1.find(100 + i)->second == i);
+                }
+
+                map1.swap(map1);
+
+                CHECK(map1.size() == std::size_t(n2));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test at(const Key&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+
+        CHECK(map.at(10) == 1);
+        CHECK(map.at(20) == 1);
+
+        map.at(10) = 2;
+
+        const auto& cmap = map;
+
+        CHECK(cmap.at(10) == 2);
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            (void)map.at(30);
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        #endif
+    }
+
+    PRINT("Test at(const K&)");
+    {
+        sfl::static_unordered_map<xobj, xint, 32, xobj::hash, xobj::equal> map;
+
+        map.emplace(xobj(10), 1);
+
+        CHECK(map.at(10) == 1);
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            (void)map.at(30);
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        #endif
+    }
+
+    PRINT("Test operator[](const Key&) and operator[](Key&&)");
+    {
+        sfl::static_unordered_map<xint, xint, 32, xint::hash, std::equal_to<xint>> map;
+
+        const xint key_10(10);
+        xint key_20(20);
+
+        map[key_10] = 1;
+        map[std::move(key_20)] = 2;
+        map[key_10] = 3;
+
+        CHECK(map.size() == 2);
+        CHECK(map.find(10)->second == 3);
+        CHECK(map.find(20)->second == 2);
+        CHECK(key_20 == -20);
+    }
+
+    PRINT("Test operator[](K&&)");
+    {
+        sfl::static_unordered_map<xobj, xint, 32, xobj::hash, xobj::equal> map;
+
+        map[10] = 1;
+        map[10] = 2;
+
+        CHECK(map.size() == 1);
+        CHECK(map.find(10)->second == 2);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test NON-MEMBER comparison operators");
+    {
+        sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map1, map2, map3;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            map1.emplace(i, 10 * i);
+            map2.emplace(19 - i, 10 * (19 - i));
+            map3.emplace(i, i);
+        }
+
+        CHECK((map1 == map2) == true);
+        CHECK((map1 == map3) == false);
+        CHECK((map1 != map2) == false);
+        CHECK((map1 != map3) == true);
+
+        map2.erase(5);
+
+        CHECK((map1 == map2) == false);
+    }
+
+    PRINT("Test NON-MEMBER swap(container&)");
+    {
+        sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map2.emplace(20, 2);
+        map2.emplace(30, 3);
+
+        swap(map1, map2);
+
+        CHECK(map1.size() == 2);
+        CHECK(map2.size() == 1);
+        CHECK(map1.find(20)->second == 2);
+        CHECK(map2.find(10)->second == 1);
+    }
+
+    PRINT("Test NON-MEMBER erase_if(container&, Predicate)");
+    {
+        using value_type = std::pair<const xint, xint>;
+
+        sfl::static_unordered_map<xint, xint, 128, xint::hash, std::equal_to<xint>> map;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, i % 5);
+        }
+
+        CHECK(erase_if(map, [](const value_type& x){ return x.second == 2; }) == 20);
+        CHECK(erase_if(map, [](const value_type& x){ return x.second == 2; }) == 0);
+        CHECK(map.size() == 80);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(map.contains(i) == (i % 5 != 2));
+        }
+    }
+}
+
+int main()
+{
+    test_static_unordered_map();
+}
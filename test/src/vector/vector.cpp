@@ -13,7 +13,9 @@
 #include "print.hpp"
 
 #include "xint.hpp"
+#include "xrint.hpp"
 
+#include "expandable_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
@@ -57,6 +59,13 @@ void test_vector_5()
     #include "vector.inc"
 }
 
+void test_vector_6()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::expandable_alloc
+    #include "vector.inc"
+}
+
 int main()
 {
     test_vector_1();
@@ -64,4 +73,5 @@ int main()
     test_vector_3();
     test_vector_4();
     test_vector_5();
+    test_vector_6();
 }